@@ -1,3 +1,5 @@
+PRAGMA user_version = 1;
+
 CREATE TABLE IF NOT EXISTS Position
 (
   PositionId INTEGER NOT NULL UNIQUE,
@@ -12,9 +14,13 @@ CREATE TABLE IF NOT EXISTS Track
   Name       TEXT    NOT NULL,
   Finishline INTEGER NOT NULL,
   Startline  INTEGER NULL    ,
+  -- 0 circuit, 1 point to point
+  Topology   INTEGER NOT NULL DEFAULT 0,
+  PitLanePositionId INTEGER NULL,
   PRIMARY KEY (TrackId AUTOINCREMENT),
   FOREIGN KEY (Finishline) REFERENCES Position (PositionId) ON DELETE CASCADE,
-  FOREIGN KEY (Startline) REFERENCES Position (PositionId) ON DELETE CASCADE
+  FOREIGN KEY (Startline) REFERENCES Position (PositionId) ON DELETE CASCADE,
+  FOREIGN KEY (PitLanePositionId) REFERENCES Position (PositionId) ON DELETE CASCADE
 );
 
 CREATE TABLE IF NOT EXISTS Session
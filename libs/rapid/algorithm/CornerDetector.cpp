@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "CornerDetector.hpp"
+#include "Heading.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+using namespace Rapid::Common;
+using namespace Rapid::Algorithm::Heading;
+
+namespace Rapid::Algorithm
+{
+
+namespace
+{
+
+/**
+ * A corner that is still growing during the detection.
+ */
+struct CornerCandidate
+{
+    std::size_t entry{0};
+    std::size_t exit{0};
+    bool rightHand{false};
+    float headingChange{0.0f};
+    float headingChangeToExit{0.0f};
+};
+
+} // namespace
+
+CornerDetector::CornerDetector(TrackData const& track)
+    : CornerDetector{track, Thresholds{}}
+{
+}
+
+CornerDetector::CornerDetector(TrackData const& track, Thresholds const& thresholds)
+    : mComparison{track}
+    , mThresholds{thresholds}
+{
+}
+
+std::vector<Corner> CornerDetector::detect(ResampledLap const& lap) const
+{
+    auto const count = lap.size();
+    if ((count < 3) || (lap.gridSpacing <= 0.0f)) {
+        return {};
+    }
+
+    auto const maximumGap = static_cast<std::size_t>(mThresholds.maximumGap / lap.gridSpacing);
+    auto layout = std::vector<Corner>{};
+    auto candidate = std::optional<CornerCandidate>{};
+    auto const finishCandidate = [&] {
+        if (candidate.has_value() && (std::abs(candidate->headingChangeToExit) >= mThresholds.minimumHeadingChange)) {
+            layout.push_back(Corner{.entryDistance = static_cast<float>(candidate->entry) * lap.gridSpacing,
+                                    .exitDistance = static_cast<float>(candidate->exit) * lap.gridSpacing});
+        }
+        candidate.reset();
+    };
+
+    for (std::size_t index = 1; index + 1 < count; ++index) {
+        auto const curvature =
+            getHeadingChangeInRadian(lap.headings[index - 1], lap.headings[index + 1]) / (2.0f * lap.gridSpacing);
+        auto const turning = std::abs(curvature) >= mThresholds.minimumCurvature;
+        if (candidate.has_value()) {
+            candidate->headingChange += getHeadingChangeInDegree(lap.headings[index - 1], lap.headings[index]);
+            // A straight or a turn into the other direction ends the corner.
+            if ((index - candidate->exit > maximumGap) || (turning && ((curvature > 0.0f) != candidate->rightHand))) {
+                finishCandidate();
+            }
+        }
+        if (!turning) {
+            continue;
+        }
+        if (!candidate.has_value()) {
+            candidate = CornerCandidate{.entry = index, .exit = index, .rightHand = curvature > 0.0f};
+        }
+        candidate->exit = index;
+        candidate->headingChangeToExit = candidate->headingChange;
+    }
+    finishCandidate();
+
+    return measure(lap, layout);
+}
+
+std::vector<Corner> CornerDetector::detect(LapTelemetryView const& telemetry) const
+{
+    return detect(mComparison.resample(telemetry));
+}
+
+std::vector<Corner> CornerDetector::measure(ResampledLap const& lap, std::span<Corner const> layout) const
+{
+    auto corners = std::vector<Corner>{};
+    if ((lap.size() < 2) || (lap.gridSpacing <= 0.0f)) {
+        return corners;
+    }
+    corners.reserve(layout.size());
+
+    auto const getIndex = [&](float distance) {
+        return static_cast<std::size_t>(std::max(std::lround(distance / lap.gridSpacing), 0L));
+    };
+    auto const getDistance = [&](std::size_t index) {
+        return static_cast<float>(index) * lap.gridSpacing;
+    };
+
+    // The braking is scanned once from the exit of the previous corner to the apex of the next corner.
+    auto index = std::size_t{0};
+    auto previousExit = std::size_t{0};
+    auto braking = false;
+    auto brakingStart = std::optional<std::size_t>{};
+    for (auto const& layoutCorner : layout) {
+        auto const entry = getIndex(layoutCorner.entryDistance);
+        auto const exit = getIndex(layoutCorner.exitDistance);
+        if ((exit >= lap.size()) || (entry > exit)) {
+            break;
+        }
+
+        auto const speeds = std::span{lap.speeds}.subspan(entry, exit - entry + 1);
+        auto const apex = entry + static_cast<std::size_t>(std::ranges::distance(speeds.begin(),
+                                                                                 std::ranges::min_element(speeds)));
+        for (; index <= apex; ++index) {
+            auto const isBraking = lap.longitudinalAccelerations[index] <= mThresholds.brakingDeceleration;
+            if (isBraking && (!braking || (index == previousExit))) {
+                brakingStart = index;
+            }
+            braking = isBraking;
+        }
+
+        auto headingChange = 0.0f;
+        for (auto point = entry + 1; point <= exit; ++point) {
+            headingChange += getHeadingChangeInDegree(lap.headings[point - 1], lap.headings[point]);
+        }
+
+        auto corner = Corner{.entryDistance = getDistance(entry),
+                             .apexDistance = getDistance(apex),
+                             .exitDistance = getDistance(exit),
+                             .entrySpeed = lap.speeds[entry],
+                             .apexSpeed = lap.speeds[apex],
+                             .exitSpeed = lap.speeds[exit],
+                             .duration = lap.times[exit] - lap.times[entry],
+                             .headingChange = headingChange};
+        if (brakingStart.has_value() && (*brakingStart >= previousExit)) {
+            corner.brakingDistance = getDistance(*brakingStart);
+        }
+        corners.push_back(corner);
+        previousExit = std::max(previousExit, exit);
+    }
+    return corners;
+}
+
+std::vector<CornerRanking> CornerDetector::rank(SessionData const& session) const
+{
+    auto const& laps = session.getLaps();
+    auto const hasTelemetry = [&](std::size_t lap) {
+        return laps[lap].getTelemetry().size() >= 2;
+    };
+    auto fastest = std::optional<std::size_t>{};
+    for (std::size_t lap = 0; lap < laps.size(); ++lap) {
+        if (hasTelemetry(lap) && (!fastest.has_value() || (laps[lap].getLaptime() < laps[*fastest].getLaptime()))) {
+            fastest = lap;
+        }
+    }
+    if (!fastest.has_value()) {
+        return {};
+    }
+
+    auto rankings = std::vector<CornerRanking>{};
+    for (auto const& corner : detect(laps[*fastest].getTelemetry().getView())) {
+        rankings.push_back(CornerRanking{.layout = corner, .results = {}});
+    }
+    auto layout = std::vector<Corner>{};
+    layout.reserve(rankings.size());
+    std::ranges::transform(rankings, std::back_inserter(layout), &CornerRanking::layout);
+
+    // Only a single resampled lap is kept at a time.
+    for (std::size_t lap = 0; lap < laps.size(); ++lap) {
+        if (!hasTelemetry(lap)) {
+            continue;
+        }
+        auto const corners = measure(mComparison.resample(laps[lap].getTelemetry().getView()), layout);
+        for (std::size_t corner = 0; corner < corners.size(); ++corner) {
+            rankings[corner].results.push_back(CornerResult{.lap = lap, .corner = corners[corner]});
+        }
+    }
+
+    for (auto& ranking : rankings) {
+        std::ranges::stable_sort(ranking.results, {}, [](CornerResult const& result) {
+            return result.corner.duration;
+        });
+    }
+    return rankings;
+}
+
+} // namespace Rapid::Algorithm
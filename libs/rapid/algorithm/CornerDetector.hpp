@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_CORNERDETECTOR_HPP
+#define RAPID_ALGORITHM_CORNERDETECTOR_HPP
+
+#include "LapComparison.hpp"
+#include <optional>
+#include <span>
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * A corner of a lap, the distances are measured from the finish gate like the grid of a @ref ResampledLap.
+ */
+struct Corner
+{
+    /**
+     * The distance of the corner entry in meter.
+     */
+    float entryDistance{0.0f};
+
+    /**
+     * The distance of the apex, the slowest point of the corner, in meter.
+     */
+    float apexDistance{0.0f};
+
+    /**
+     * The distance of the corner exit in meter.
+     */
+    float exitDistance{0.0f};
+
+    /**
+     * The speed at the corner entry in m/s.
+     */
+    float entrySpeed{0.0f};
+
+    /**
+     * The speed at the apex in m/s.
+     */
+    float apexSpeed{0.0f};
+
+    /**
+     * The speed at the corner exit in m/s.
+     */
+    float exitSpeed{0.0f};
+
+    /**
+     * The distance in meter where the braking for the corner starts, std::nullopt when the corner is taken without
+     * braking.
+     */
+    std::optional<float> brakingDistance;
+
+    /**
+     * The time from the corner entry to the corner exit in milliseconds.
+     */
+    float duration{0.0f};
+
+    /**
+     * The change of the heading in the corner in degree, positive for right hand corners.
+     */
+    float headingChange{0.0f};
+};
+
+/**
+ * The corner of a lap in a @ref CornerRanking.
+ */
+struct CornerResult
+{
+    /**
+     * The index of the lap in the session.
+     */
+    std::size_t lap{0};
+
+    /**
+     * The corner as driven in the lap.
+     */
+    Corner corner;
+};
+
+/**
+ * The leaderboard of a corner over all laps of a session.
+ */
+struct CornerRanking
+{
+    /**
+     * The corner as detected in the fastest lap, its entry and exit are used to measure the corner in all laps.
+     */
+    Corner layout;
+
+    /**
+     * The corner in every lap, sorted by the time spent in the corner, fastest first.
+     */
+    std::vector<CornerResult> results;
+};
+
+/**
+ * Splits laps into corners and straights without sections in the @ref Common::TrackData.
+ * A corner is a part of the lap where the heading changes faster than the minimum curvature, parts with a short
+ * gap between them that turn in the same direction are one corner. The apex is the speed minimum of the corner and
+ * the braking point is the begin of the last braking between the previous corner and the apex.
+ * The laps are resampled on the distance grid of a @ref LapComparison, the detection is a single pass over the grid
+ * and only keeps the corners.
+ */
+class CornerDetector final
+{
+public:
+    /**
+     * The thresholds of the corner detection.
+     */
+    struct Thresholds
+    {
+        /**
+         * The minimum curvature of a corner in 1/m, the inverse of the largest corner radius.
+         */
+        float minimumCurvature{1.0f / 300.0f};
+
+        /**
+         * The minimum change of the heading of a corner in degree.
+         */
+        float minimumHeadingChange{15.0f};
+
+        /**
+         * The maximum length in meter of a straighter part between two parts of one corner.
+         */
+        float maximumGap{30.0f};
+
+        /**
+         * The deceleration in m/s² from which the vehicle is braking, a negative value.
+         */
+        float brakingDeceleration{-3.0f};
+    };
+
+    /**
+     * Creates a corner detector with the default thresholds.
+     * @param track The track whose finish gate aligns the laps.
+     */
+    explicit CornerDetector(Common::TrackData const& track);
+
+    /**
+     * Creates a corner detector.
+     * @param track The track whose finish gate aligns the laps.
+     * @param thresholds The thresholds of the corner detection.
+     */
+    CornerDetector(Common::TrackData const& track, Thresholds const& thresholds);
+
+    /**
+     * Detects the corners of a lap.
+     * @param lap The resampled lap.
+     * @return The corners in the order of the lap.
+     */
+    [[nodiscard]] std::vector<Corner> detect(ResampledLap const& lap) const;
+
+    /**
+     * Detects the corners of a lap.
+     * @param telemetry The log points of the lap in the order they were recorded.
+     * @return The corners in the order of the lap.
+     */
+    [[nodiscard]] std::vector<Corner> detect(Common::LapTelemetryView const& telemetry) const;
+
+    /**
+     * Measures a lap in the corners of another lap, so the corners of different laps are comparable.
+     * @param lap The resampled lap.
+     * @param layout The corners whose entries and exits are used, in the order of the lap.
+     * @return The corners of the layout as driven in the lap, the corners behind the end of the lap are left out.
+     */
+    [[nodiscard]] std::vector<Corner> measure(ResampledLap const& lap, std::span<Corner const> layout) const;
+
+    /**
+     * Creates the leaderboard of every corner of a session. The corners are detected in the fastest lap and all
+     * laps are measured in these corners.
+     * @param session The session whose laps are ranked.
+     * @return The leaderboard of every corner in the order of the lap, empty when the session has no lap with
+     *         telemetry.
+     */
+    [[nodiscard]] std::vector<CornerRanking> rank(Common::SessionData const& session) const;
+
+private:
+    LapComparison mComparison;
+    Thresholds mThresholds;
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_CORNERDETECTOR_HPP
@@ -0,0 +1,283 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DerivedChannelEngine.hpp"
+#include "DistanceCalculator.hpp"
+#include "Heading.hpp"
+#include <algorithm>
+#include <cmath>
+#include <common/TrackGeometry.hpp>
+#include <iterator>
+
+using namespace Rapid::Common;
+using namespace Rapid::Algorithm::Heading;
+
+namespace Rapid::Algorithm
+{
+
+namespace
+{
+
+/**
+ * Gives the times of the log points in seconds since the first log point.
+ */
+std::vector<float> getSeconds(LapTelemetry const& telemetry)
+{
+    auto const times = telemetry.getTimes();
+    auto seconds = std::vector<float>(times.size());
+    for (std::size_t index = 0; index < times.size(); ++index) {
+        seconds[index] = static_cast<float>((times[index] - times[0]).toMilliseconds()) / 1000.0f;
+    }
+    return seconds;
+}
+
+/**
+ * Visits the log points with the log points at least the heading baseline before and after them. The window is
+ * moved forward with two cursors, so the visit is linear in the number of log points.
+ */
+template <typename Visitor>
+void visitWindows(std::span<float const> distances, Visitor&& visitor)
+{
+    auto previous = std::size_t{0};
+    auto next = std::size_t{0};
+    for (std::size_t index = 0; index < distances.size(); ++index) {
+        while ((previous + 1 < index) &&
+               (distances[index] - distances[previous + 1] >= DerivedChannelEngine::HeadingBaseline)) {
+            ++previous;
+        }
+        next = std::max(next, index);
+        while ((next + 1 < distances.size()) &&
+               (distances[next] - distances[index] < DerivedChannelEngine::HeadingBaseline)) {
+            ++next;
+        }
+        visitor(index, previous, next);
+    }
+}
+
+void computeDistance(LapTelemetry const& telemetry, std::span<std::span<float const> const>, std::span<float> values)
+{
+    DistanceCalculator::calculateCumulativeDistances(telemetry.getLatitudes(), telemetry.getLongitudes(), values);
+}
+
+/**
+ * Gives the speeds of the log points in m/s.
+ */
+std::vector<float> getSpeeds(LapTelemetry const& telemetry)
+{
+    auto const velocities = telemetry.getVelocities();
+    auto speeds = std::vector<float>(velocities.size());
+    std::ranges::transform(velocities, speeds.begin(), [](auto velocity) {
+        return static_cast<float>(velocity);
+    });
+    return speeds;
+}
+
+void computeHeading(LapTelemetry const& telemetry,
+                    std::span<std::span<float const> const> dependencies,
+                    std::span<float> values)
+{
+    auto const latitudes = telemetry.getLatitudes();
+    auto const longitudes = telemetry.getLongitudes();
+    auto const projection = LocalProjection{PositionData{latitudes[0], longitudes[0]}};
+    auto points = std::vector<LocalPoint>(values.size());
+    for (std::size_t index = 0; index < points.size(); ++index) {
+        points[index] = projection.project(PositionData{latitudes[index], longitudes[index]});
+    }
+    DerivedChannelEngine::deriveHeadings(points, dependencies[0], values);
+}
+
+void computeLongitudinalAcceleration(LapTelemetry const& telemetry,
+                                     std::span<std::span<float const> const>,
+                                     std::span<float> values)
+{
+    DerivedChannelEngine::deriveLongitudinalAccelerations(getSpeeds(telemetry), getSeconds(telemetry), values);
+    std::ranges::transform(values, values.begin(), [](float acceleration) {
+        return acceleration / DerivedChannelEngine::Gravity;
+    });
+}
+
+void computeLateralAcceleration(LapTelemetry const& telemetry,
+                                std::span<std::span<float const> const> dependencies,
+                                std::span<float> values)
+{
+    DerivedChannelEngine::deriveLateralAccelerations(
+        getSpeeds(telemetry), getSeconds(telemetry), dependencies[0], dependencies[1], values);
+    std::ranges::transform(values, values.begin(), [](float acceleration) {
+        return acceleration / DerivedChannelEngine::Gravity;
+    });
+}
+
+void computeLeanAngle(LapTelemetry const&,
+                      std::span<std::span<float const> const> dependencies,
+                      std::span<float> values)
+{
+    // The motorcycle leans so that the resulting force of gravity and the lateral acceleration points through the
+    // contact patches, tan(lean) = lateral acceleration / gravity.
+    std::ranges::transform(dependencies[0], values.begin(), [](float lateralAcceleration) {
+        return std::atan(lateralAcceleration) * DegreePerRadian;
+    });
+}
+
+} // namespace
+
+DerivedChannelEngine::DerivedChannelEngine(std::size_t cacheCapacity)
+    : mCacheCapacity{std::max(cacheCapacity, std::size_t{1})}
+{
+    addChannel(ChannelDefinition{.name = std::string{DistanceChannel}, .dependencies = {}, .compute = computeDistance});
+    addChannel(ChannelDefinition{.name = std::string{HeadingChannel},
+                                 .dependencies = {std::string{DistanceChannel}},
+                                 .compute = computeHeading});
+    addChannel(ChannelDefinition{.name = std::string{LongitudinalAccelerationChannel},
+                                 .dependencies = {},
+                                 .compute = computeLongitudinalAcceleration});
+    addChannel(ChannelDefinition{.name = std::string{LateralAccelerationChannel},
+                                 .dependencies = {std::string{DistanceChannel}, std::string{HeadingChannel}},
+                                 .compute = computeLateralAcceleration});
+    addChannel(ChannelDefinition{.name = std::string{LeanAngleChannel},
+                                 .dependencies = {std::string{LateralAccelerationChannel}},
+                                 .compute = computeLeanAngle});
+}
+
+bool DerivedChannelEngine::addChannel(ChannelDefinition definition)
+{
+    if (hasChannel(definition.name) || !definition.compute) {
+        return false;
+    }
+    auto dependencies = std::vector<std::size_t>{};
+    dependencies.reserve(definition.dependencies.size());
+    for (auto const& dependency : definition.dependencies) {
+        auto const channel = findChannel(dependency);
+        if (!channel.has_value()) {
+            return false;
+        }
+        dependencies.push_back(*channel);
+    }
+
+    mDefinitions.push_back(std::move(definition));
+    mDependencies.push_back(std::move(dependencies));
+    for (auto& entry : mCache) {
+        entry.channels.resize(mDefinitions.size());
+    }
+    return true;
+}
+
+bool DerivedChannelEngine::hasChannel(std::string_view name) const noexcept
+{
+    return findChannel(name).has_value();
+}
+
+std::vector<std::string> DerivedChannelEngine::getChannelNames() const
+{
+    auto names = std::vector<std::string>{};
+    names.reserve(mDefinitions.size());
+    std::ranges::transform(mDefinitions, std::back_inserter(names), &ChannelDefinition::name);
+    return names;
+}
+
+std::span<float const> DerivedChannelEngine::getChannel(LapTelemetry const& telemetry, std::string_view name)
+{
+    auto const channel = findChannel(name);
+    if (!channel.has_value()) {
+        return {};
+    }
+    return compute(telemetry, getCacheEntry(telemetry), *channel);
+}
+
+void DerivedChannelEngine::clearCache() noexcept
+{
+    mCache.clear();
+}
+
+void DerivedChannelEngine::deriveHeadings(std::span<LocalPoint const> points,
+                                          std::span<float const> distances,
+                                          std::span<float> headings)
+{
+    auto heading = 0.0f;
+    visitWindows(distances, [&](std::size_t index, std::size_t previous, std::size_t next) {
+        auto const chord = points[next] - points[previous];
+        // A standing vehicle keeps its heading.
+        if (length(chord) > 0.0f) {
+            heading = getHeadingInDegree(chord);
+        }
+        headings[index] = heading;
+    });
+}
+
+void DerivedChannelEngine::deriveLongitudinalAccelerations(std::span<float const> speeds,
+                                                           std::span<float const> seconds,
+                                                           std::span<float> accelerations) noexcept
+{
+    auto const count = accelerations.size();
+    for (std::size_t index = 0; index < count; ++index) {
+        auto const previous = index > 0 ? index - 1 : index;
+        auto const next = std::min(index + 1, count - 1);
+        auto const duration = seconds[next] - seconds[previous];
+        accelerations[index] = duration > 0.0f ? (speeds[next] - speeds[previous]) / duration : 0.0f;
+    }
+}
+
+void DerivedChannelEngine::deriveLateralAccelerations(std::span<float const> speeds,
+                                                      std::span<float const> seconds,
+                                                      std::span<float const> distances,
+                                                      std::span<float const> headings,
+                                                      std::span<float> accelerations) noexcept
+{
+    visitWindows(distances, [&](std::size_t index, std::size_t previous, std::size_t next) {
+        auto const duration = seconds[next] - seconds[previous];
+        auto const yawRate =
+            duration > 0.0f ? getHeadingChangeInRadian(headings[previous], headings[next]) / duration : 0.0f;
+        accelerations[index] = speeds[index] * yawRate;
+    });
+}
+
+std::optional<std::size_t> DerivedChannelEngine::findChannel(std::string_view name) const noexcept
+{
+    auto const definition = std::ranges::find(mDefinitions, name, &ChannelDefinition::name);
+    if (definition == mDefinitions.cend()) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(std::distance(mDefinitions.cbegin(), definition));
+}
+
+DerivedChannelEngine::CacheEntry& DerivedChannelEngine::getCacheEntry(LapTelemetry const& telemetry)
+{
+    // Moving an entry to the end keeps the buffers of its channels, the given out values stay valid.
+    auto const entry = std::ranges::find(mCache, telemetry.getRevision(), &CacheEntry::revision);
+    if (entry != mCache.end()) {
+        std::rotate(entry, std::next(entry), mCache.end());
+        return mCache.back();
+    }
+
+    if (mCache.size() >= mCacheCapacity) {
+        mCache.erase(mCache.begin());
+    }
+    mCache.push_back(CacheEntry{.revision = telemetry.getRevision(), .channels = {}});
+    mCache.back().channels.resize(mDefinitions.size());
+    return mCache.back();
+}
+
+std::span<float const> DerivedChannelEngine::compute(LapTelemetry const& telemetry,
+                                                     CacheEntry& entry,
+                                                     std::size_t channel)
+{
+    auto& values = entry.channels[channel];
+    if (values.has_value()) {
+        return *values;
+    }
+
+    auto dependencies = std::vector<std::span<float const>>{};
+    dependencies.reserve(mDependencies[channel].size());
+    for (auto const dependency : mDependencies[channel]) {
+        dependencies.push_back(compute(telemetry, entry, dependency));
+    }
+
+    auto result = std::vector<float>(telemetry.size(), 0.0f);
+    if (!telemetry.empty()) {
+        mDefinitions[channel].compute(telemetry, dependencies, result);
+    }
+    values = std::move(result);
+    return *values;
+}
+
+} // namespace Rapid::Algorithm
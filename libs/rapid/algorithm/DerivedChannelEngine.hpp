@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_DERIVEDCHANNELENGINE_HPP
+#define RAPID_ALGORITHM_DERIVEDCHANNELENGINE_HPP
+
+#include <common/LapTelemetry.hpp>
+#include <common/TrackGeometry.hpp>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * Computes channels that are derived from the log points of a lap, e.g. the heading or the lateral acceleration.
+ * Every channel is declared by name together with the channels it depends on, so views and exports request a
+ * channel by name instead of deriving it by themselves.
+ * The channels are computed lazily, when a channel of a lap is requested for the first time its dependencies and
+ * the channel are computed and cached. The cache is keyed by the revision of the @ref Common::LapTelemetry, so a
+ * modification of the log points invalidates the cached channels of the lap. The cache keeps the channels of the
+ * most recently computed laps up to the cache capacity.
+ * The engine isn't thread safe.
+ */
+class DerivedChannelEngine final
+{
+public:
+    /**
+     * The distance along the lap from the first log point in meter.
+     */
+    static constexpr auto DistanceChannel = std::string_view{"distance"};
+
+    /**
+     * The direction of travel in degree, clockwise from north in the range of [0, 360).
+     */
+    static constexpr auto HeadingChannel = std::string_view{"heading"};
+
+    /**
+     * The acceleration in the direction of travel in g, braking is negative.
+     */
+    static constexpr auto LongitudinalAccelerationChannel = std::string_view{"g_long"};
+
+    /**
+     * The acceleration across the direction of travel in g, positive in right hand corners.
+     */
+    static constexpr auto LateralAccelerationChannel = std::string_view{"g_lat"};
+
+    /**
+     * The lean angle of a motorcycle estimated from the lateral acceleration in degree, positive to the right.
+     */
+    static constexpr auto LeanAngleChannel = std::string_view{"lean"};
+
+    /**
+     * The standard gravity in m/s².
+     */
+    static constexpr auto Gravity = 9.80665f;
+
+    /**
+     * The distance in meter before and after a log point over which the heading and the yaw rate are measured.
+     * The positions have float precision, neighbour log points are too close for a stable heading.
+     */
+    static constexpr auto HeadingBaseline = 10.0f;
+
+    /**
+     * The default number of laps whose channels are cached.
+     */
+    static constexpr std::size_t DefaultCacheCapacity = 64;
+
+    /**
+     * Computes the values of a derived channel.
+     * The first parameter is the telemetry of the lap, the second parameter are the values of the dependencies in
+     * the declared order and the third parameter are the values of the channel, one per log point.
+     */
+    using Compute = std::function<void(
+        Common::LapTelemetry const&, std::span<std::span<float const> const>, std::span<float>)>;
+
+    /**
+     * The declaration of a derived channel.
+     */
+    struct ChannelDefinition
+    {
+        /**
+         * The unique name of the channel.
+         */
+        std::string name;
+
+        /**
+         * The names of the channels the channel is computed from.
+         */
+        std::vector<std::string> dependencies;
+
+        /**
+         * The computation of the channel.
+         */
+        Compute compute;
+    };
+
+    /**
+     * Creates an engine with the distance, heading, acceleration and lean angle channels.
+     * @param cacheCapacity The number of laps whose channels are cached.
+     */
+    explicit DerivedChannelEngine(std::size_t cacheCapacity = DefaultCacheCapacity);
+
+    /**
+     * Adds a derived channel. The dependencies must be added before the channel, so the channels can't have
+     * cyclic dependencies.
+     * @param definition The declaration of the channel.
+     * @return true The channel is added.
+     * @return false A channel with the name exists, a dependency is unknown or the computation is empty.
+     */
+    bool addChannel(ChannelDefinition definition);
+
+    /**
+     * Checks if a derived channel with the name exists.
+     * @param name The name of the channel.
+     * @return true The channel exists.
+     * @return false The channel doesn't exist.
+     */
+    [[nodiscard]] bool hasChannel(std::string_view name) const noexcept;
+
+    /**
+     * Gives the names of all derived channels in the order they were added.
+     * @return The names of the channels.
+     */
+    [[nodiscard]] std::vector<std::string> getChannelNames() const;
+
+    /**
+     * Gives the values of a derived channel of a lap, the channel is computed when it isn't cached.
+     * The values stay valid until the channels of more laps than the cache capacity are computed or the cache is
+     * cleared.
+     * @param telemetry The log points of the lap.
+     * @param name The name of the channel.
+     * @return The values of the channel, one per log point, or an empty span when the channel doesn't exist.
+     */
+    [[nodiscard]] std::span<float const> getChannel(Common::LapTelemetry const& telemetry, std::string_view name);
+
+    /**
+     * Removes the cached channels of all laps.
+     */
+    void clearCache() noexcept;
+
+    /**
+     * Derives the headings of a path, the heading channel is computed with it. The heading of a point is the
+     * direction of the chord between the points @ref HeadingBaseline before and after it, a standing vehicle keeps
+     * its heading.
+     * @param points The points of the path in the local plane.
+     * @param distances The distance of every point along the path in meter.
+     * @param headings The headings in degree, one per point.
+     */
+    static void deriveHeadings(std::span<Common::LocalPoint const> points,
+                               std::span<float const> distances,
+                               std::span<float> headings);
+
+    /**
+     * Derives the accelerations in the direction of travel with central differences, the points at the begin and
+     * the end use one sided differences.
+     * @param speeds The speed of every point in m/s.
+     * @param seconds The time of every point in seconds.
+     * @param accelerations The accelerations in m/s², one per point.
+     */
+    static void deriveLongitudinalAccelerations(std::span<float const> speeds,
+                                                std::span<float const> seconds,
+                                                std::span<float> accelerations) noexcept;
+
+    /**
+     * Derives the accelerations across the direction of travel as speed times yaw rate. The yaw rate is measured
+     * over the same baseline as the headings.
+     * @param speeds The speed of every point in m/s.
+     * @param seconds The time of every point in seconds.
+     * @param distances The distance of every point along the path in meter.
+     * @param headings The heading of every point in degree.
+     * @param accelerations The accelerations in m/s², one per point.
+     */
+    static void deriveLateralAccelerations(std::span<float const> speeds,
+                                           std::span<float const> seconds,
+                                           std::span<float const> distances,
+                                           std::span<float const> headings,
+                                           std::span<float> accelerations) noexcept;
+
+private:
+    struct CacheEntry
+    {
+        std::uint64_t revision{0};
+        std::vector<std::optional<std::vector<float>>> channels;
+    };
+
+    std::optional<std::size_t> findChannel(std::string_view name) const noexcept;
+    CacheEntry& getCacheEntry(Common::LapTelemetry const& telemetry);
+    std::span<float const> compute(Common::LapTelemetry const& telemetry, CacheEntry& entry, std::size_t channel);
+
+private:
+    std::vector<ChannelDefinition> mDefinitions;
+    std::vector<std::vector<std::size_t>> mDependencies;
+    // The most recently used entry is at the end.
+    std::vector<CacheEntry> mCache;
+    std::size_t mCacheCapacity;
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_DERIVEDCHANNELENGINE_HPP
@@ -3,11 +3,167 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "DistanceCalculator.hpp"
+#include <algorithm>
 #include <cmath>
+#include <common/TrackGeometry.hpp>
+#include <numbers>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace Rapid::Algorithm::DistanceCalculator
 {
 
+namespace
+{
+
+/**
+ * The number of positions that share the cosine of the latitude.
+ * A block of a log spans a few hundred meter, the error of the shared cosine is far below the GPS accuracy.
+ */
+constexpr std::size_t BlockSize = 64;
+
+template <typename T>
+constexpr auto MetersPerDegree = static_cast<T>(Common::LocalProjection::MetersPerDegree);
+
+template <typename T>
+void calculateDistancesScalar(T const* latitudes, T const* longitudes, T* distances, std::size_t count, T scale)
+{
+    for (std::size_t index = 0; index < count; ++index) {
+        auto const dx = (longitudes[index + 1] - longitudes[index]) * scale;
+        auto const dy = (latitudes[index + 1] - latitudes[index]) * MetersPerDegree<T>;
+        distances[index] = std::sqrt((dx * dx) + (dy * dy));
+    }
+}
+
+/**
+ * Calculates the distances with the widest available vector instructions.
+ * @return The number of calculated distances, the remaining distances are calculated by the scalar kernel.
+ */
+std::size_t calculateDistancesVector(float const* latitudes,
+                                     float const* longitudes,
+                                     float* distances,
+                                     std::size_t count,
+                                     float scale)
+{
+    auto index = std::size_t{0};
+#if defined(__AVX2__)
+    auto const scaleX = _mm256_set1_ps(scale);
+    auto const scaleY = _mm256_set1_ps(MetersPerDegree<float>);
+    for (; index + 8 <= count; index += 8) {
+        auto const dx = _mm256_mul_ps(
+            _mm256_sub_ps(_mm256_loadu_ps(longitudes + index + 1), _mm256_loadu_ps(longitudes + index)), scaleX);
+        auto const dy = _mm256_mul_ps(
+            _mm256_sub_ps(_mm256_loadu_ps(latitudes + index + 1), _mm256_loadu_ps(latitudes + index)), scaleY);
+        _mm256_storeu_ps(distances + index,
+                         _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy))));
+    }
+#elif defined(__SSE2__)
+    auto const scaleX = _mm_set1_ps(scale);
+    auto const scaleY = _mm_set1_ps(MetersPerDegree<float>);
+    for (; index + 4 <= count; index += 4) {
+        auto const dx =
+            _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(longitudes + index + 1), _mm_loadu_ps(longitudes + index)), scaleX);
+        auto const dy =
+            _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(latitudes + index + 1), _mm_loadu_ps(latitudes + index)), scaleY);
+        _mm_storeu_ps(distances + index, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))));
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    auto const scaleY = vdupq_n_f32(MetersPerDegree<float>);
+    for (; index + 4 <= count; index += 4) {
+        auto const dx = vmulq_n_f32(vsubq_f32(vld1q_f32(longitudes + index + 1), vld1q_f32(longitudes + index)), scale);
+        auto const dy = vmulq_f32(vsubq_f32(vld1q_f32(latitudes + index + 1), vld1q_f32(latitudes + index)), scaleY);
+        vst1q_f32(distances + index, vsqrtq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy))));
+    }
+#endif
+    return index;
+}
+
+/**
+ * Double precision variant of the vector kernel.
+ */
+std::size_t calculateDistancesVector(double const* latitudes,
+                                     double const* longitudes,
+                                     double* distances,
+                                     std::size_t count,
+                                     double scale)
+{
+    auto index = std::size_t{0};
+#if defined(__AVX2__)
+    auto const scaleX = _mm256_set1_pd(scale);
+    auto const scaleY = _mm256_set1_pd(MetersPerDegree<double>);
+    for (; index + 4 <= count; index += 4) {
+        auto const dx = _mm256_mul_pd(
+            _mm256_sub_pd(_mm256_loadu_pd(longitudes + index + 1), _mm256_loadu_pd(longitudes + index)), scaleX);
+        auto const dy = _mm256_mul_pd(
+            _mm256_sub_pd(_mm256_loadu_pd(latitudes + index + 1), _mm256_loadu_pd(latitudes + index)), scaleY);
+        _mm256_storeu_pd(distances + index,
+                         _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))));
+    }
+#elif defined(__SSE2__)
+    auto const scaleX = _mm_set1_pd(scale);
+    auto const scaleY = _mm_set1_pd(MetersPerDegree<double>);
+    for (; index + 2 <= count; index += 2) {
+        auto const dx =
+            _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(longitudes + index + 1), _mm_loadu_pd(longitudes + index)), scaleX);
+        auto const dy =
+            _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(latitudes + index + 1), _mm_loadu_pd(latitudes + index)), scaleY);
+        _mm_storeu_pd(distances + index, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    auto const scaleY = vdupq_n_f64(MetersPerDegree<double>);
+    for (; index + 2 <= count; index += 2) {
+        auto const dx = vmulq_n_f64(vsubq_f64(vld1q_f64(longitudes + index + 1), vld1q_f64(longitudes + index)), scale);
+        auto const dy = vmulq_f64(vsubq_f64(vld1q_f64(latitudes + index + 1), vld1q_f64(latitudes + index)), scaleY);
+        vst1q_f64(distances + index, vsqrtq_f64(vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy))));
+    }
+#endif
+    return index;
+}
+
+template <typename T>
+void calculateDistances(std::span<T const> latitudes, std::span<T const> longitudes, std::span<T> distances)
+{
+    auto const positions = std::min(latitudes.size(), longitudes.size());
+    if (positions < 2) {
+        return;
+    }
+
+    auto const count = std::min(positions - 1, distances.size());
+    for (std::size_t begin = 0; begin < count; begin += BlockSize) {
+        auto const blockCount = std::min(BlockSize, count - begin);
+        auto const scale =
+            MetersPerDegree<T> * static_cast<T>(std::cos(latitudes[begin] * std::numbers::pi_v<T> / T{180}));
+        auto const* blockLatitudes = latitudes.data() + begin;
+        auto const* blockLongitudes = longitudes.data() + begin;
+        auto* blockDistances = distances.data() + begin;
+        auto const done = calculateDistancesVector(blockLatitudes, blockLongitudes, blockDistances, blockCount, scale);
+        calculateDistancesScalar(
+            blockLatitudes + done, blockLongitudes + done, blockDistances + done, blockCount - done, scale);
+    }
+}
+
+template <typename T>
+void calculateCumulativeDistances(std::span<T const> latitudes, std::span<T const> longitudes, std::span<T> distances)
+{
+    if (distances.empty()) {
+        return;
+    }
+
+    // The distances between the positions are calculated behind the first element and summed up in place.
+    distances[0] = T{0};
+    calculateDistances(latitudes, longitudes, distances.subspan(1));
+    auto const count = std::min({latitudes.size(), longitudes.size(), distances.size()});
+    for (std::size_t index = 1; index < count; ++index) {
+        distances[index] += distances[index - 1];
+    }
+}
+
+} // namespace
+
 float calculateDistance(Common::PositionData const& pos1, Common::PositionData const& pos2)
 {
     float lat = (pos1.getLatitude() + pos2.getLatitude()) / 2 * 0.01745f;
@@ -18,4 +174,32 @@ float calculateDistance(Common::PositionData const& pos1, Common::PositionData c
     return distance;
 }
 
+void calculateDistances(std::span<float const> latitudes,
+                        std::span<float const> longitudes,
+                        std::span<float> distances) noexcept
+{
+    calculateDistances<float>(latitudes, longitudes, distances);
+}
+
+void calculateDistances(std::span<double const> latitudes,
+                        std::span<double const> longitudes,
+                        std::span<double> distances) noexcept
+{
+    calculateDistances<double>(latitudes, longitudes, distances);
+}
+
+void calculateCumulativeDistances(std::span<float const> latitudes,
+                                  std::span<float const> longitudes,
+                                  std::span<float> distances) noexcept
+{
+    calculateCumulativeDistances<float>(latitudes, longitudes, distances);
+}
+
+void calculateCumulativeDistances(std::span<double const> latitudes,
+                                  std::span<double const> longitudes,
+                                  std::span<double> distances) noexcept
+{
+    calculateCumulativeDistances<double>(latitudes, longitudes, distances);
+}
+
 }; // namespace Rapid::Algorithm::DistanceCalculator
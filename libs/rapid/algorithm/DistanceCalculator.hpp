@@ -5,6 +5,7 @@
 #pragma once
 
 #include <common/PositionData.hpp>
+#include <span>
 
 namespace Rapid::Algorithm::DistanceCalculator
 {
@@ -16,4 +17,44 @@ namespace Rapid::Algorithm::DistanceCalculator
  * @return float  The distance between the to points.
  */
 float calculateDistance(Common::PositionData const& pos1, Common::PositionData const& pos2);
+
+/**
+ * Calculates the distances between consecutive positions of contiguous latitude and longitude arrays.
+ * The distances are equirectangular like @ref calculateDistance, the cosine of the latitude is calculated once
+ * for a block of positions, so the kernel is vectorized (AVX2 or SSE2 on x86, NEON on ARM64) with a scalar
+ * fallback. The distances are only accurate for consecutive positions of a log, e.g. a few km apart.
+ * @param latitudes The latitudes of the positions in degree.
+ * @param longitudes The longitudes of the positions in degree, same size as the latitudes.
+ * @param distances Receives the distance in meter between the position i and i + 1, must hold one element
+ *                  less than the positions. Additional elements are untouched.
+ */
+void calculateDistances(std::span<float const> latitudes,
+                        std::span<float const> longitudes,
+                        std::span<float> distances) noexcept;
+
+/**
+ * Double precision variant of
+ * @ref calculateDistances(std::span<float const>, std::span<float const>, std::span<float>)
+ */
+void calculateDistances(std::span<double const> latitudes,
+                        std::span<double const> longitudes,
+                        std::span<double> distances) noexcept;
+
+/**
+ * Calculates the distance along the positions from the first position to every position.
+ * @param latitudes The latitudes of the positions in degree.
+ * @param longitudes The longitudes of the positions in degree, same size as the latitudes.
+ * @param distances Receives the distance in meter from the first position, must hold one element per position.
+ */
+void calculateCumulativeDistances(std::span<float const> latitudes,
+                                  std::span<float const> longitudes,
+                                  std::span<float> distances) noexcept;
+
+/**
+ * Double precision variant of
+ * @ref calculateCumulativeDistances(std::span<float const>, std::span<float const>, std::span<float>)
+ */
+void calculateCumulativeDistances(std::span<double const> latitudes,
+                                  std::span<double const> longitudes,
+                                  std::span<double> distances) noexcept;
 }; // namespace Rapid::Algorithm::DistanceCalculator
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GateCrossing.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace Rapid::Common;
+
+namespace Rapid::Algorithm::GateCrossing
+{
+
+double elapsed(double from, double to) noexcept
+{
+    auto const difference = to - from;
+    return difference < 0.0 ? difference + static_cast<double>(Timestamp::MillisecondsPerDay) : difference;
+}
+
+Timestamp toTimestamp(double milliseconds) noexcept
+{
+    return Timestamp::fromMilliseconds(std::llround(milliseconds));
+}
+
+std::optional<double> getCrossingTime(Gate const& gate,
+                                      LocalPoint const& heading,
+                                      LocalPoint const& from,
+                                      double fromTime,
+                                      LocalPoint const& to,
+                                      double toTime) noexcept
+{
+    auto const movement = to - from;
+    auto const movementLength = squaredLength(movement);
+    if (movementLength <= 0.0f) {
+        return std::nullopt;
+    }
+    // Driving back over a gate isn't a crossing.
+    if (gate.hasDirection() && dot(movement, gate.direction) <= 0.0f) {
+        return std::nullopt;
+    }
+
+    // A position exactly on the gate is counted for the movement that ends on it and not for the next one.
+    auto const previousHeading = heading != LocalPoint{} ? heading : movement;
+    if (dot(gate.center - from, previousHeading) <= 0.0f || dot(gate.center - to, movement) > 0.0f) {
+        return std::nullopt;
+    }
+
+    // The gate is crossed at the point of the movement that is closest to the gate position.
+    auto const fraction = std::clamp(dot(gate.center - from, movement) / movementLength, 0.0f, 1.0f);
+    if (gate.distanceTo(from + (movement * fraction)) > gate.halfWidth) {
+        return std::nullopt;
+    }
+
+    auto const crossingTime = fromTime + (static_cast<double>(fraction) * elapsed(fromTime, toTime));
+    return std::fmod(crossingTime, static_cast<double>(Timestamp::MillisecondsPerDay));
+}
+
+} // namespace Rapid::Algorithm::GateCrossing
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <common/Timestamp.hpp>
+#include <common/TrackGeometry.hpp>
+#include <optional>
+
+/**
+ * The crossing detection of the line crossing laptimers. The times are milliseconds of the day as double, so the
+ * interpolated crossings keep their sub-millisecond precision until they are reported.
+ */
+namespace Rapid::Algorithm::GateCrossing
+{
+/**
+ * Gives the elapsed milliseconds between two times of day, passing midnight is handled.
+ * @param from The earlier time in milliseconds of the day.
+ * @param to The later time in milliseconds of the day.
+ * @return The elapsed milliseconds.
+ */
+double elapsed(double from, double to) noexcept;
+
+/**
+ * Rounds elapsed milliseconds to a Timestamp.
+ * @param milliseconds The elapsed milliseconds.
+ * @return The rounded Timestamp.
+ */
+Common::Timestamp toTimestamp(double milliseconds) noexcept;
+
+/**
+ * Checks if the movement between two positions crosses the gate.
+ * The gate is crossed perpendicular to the heading that is driven through it: the gate position is ahead of the
+ * previous position in the heading that led to it and behind the new position in the heading of the movement. So a
+ * crossing in a corner between two movements is found as well. A gate with direction is only crossed in the
+ * direction of travel.
+ * @param gate The gate that shall be checked.
+ * @param heading The movement that led to the previous position or a null vector when it is unknown.
+ * @param from The previous position in the local plane of the track.
+ * @param fromTime The time of the previous position in milliseconds of the day.
+ * @param to The new position in the local plane of the track.
+ * @param toTime The time of the new position in milliseconds of the day.
+ * @return The interpolated time of the crossing in milliseconds of the day or std::nullopt when the gate
+ *         isn't crossed.
+ */
+std::optional<double> getCrossingTime(Common::Gate const& gate,
+                                      Common::LocalPoint const& heading,
+                                      Common::LocalPoint const& from,
+                                      double fromTime,
+                                      Common::LocalPoint const& to,
+                                      double toTime) noexcept;
+}; // namespace Rapid::Algorithm::GateCrossing
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Heading.hpp"
+#include <cmath>
+
+namespace Rapid::Algorithm::Heading
+{
+
+float getHeadingInDegree(Common::LocalPoint const& direction) noexcept
+{
+    auto const heading = std::atan2(direction.x, direction.y) * DegreePerRadian;
+    return heading < 0.0f ? heading + 360.0f : heading;
+}
+
+float getHeadingChangeInDegree(float from, float to) noexcept
+{
+    auto change = to - from;
+    if (change > 180.0f) {
+        change -= 360.0f;
+    } else if (change < -180.0f) {
+        change += 360.0f;
+    }
+    return change;
+}
+
+float getHeadingChangeInRadian(float from, float to) noexcept
+{
+    return getHeadingChangeInDegree(from, to) / DegreePerRadian;
+}
+
+} // namespace Rapid::Algorithm::Heading
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <common/TrackGeometry.hpp>
+#include <numbers>
+
+/**
+ * The headings of the derived channels, the lap comparison and the corner detection. A heading is given in degree,
+ * clockwise from north in the range of [0, 360).
+ */
+namespace Rapid::Algorithm::Heading
+{
+/**
+ * The factor that converts radian to degree.
+ */
+constexpr auto DegreePerRadian = 180.0f / std::numbers::pi_v<float>;
+
+/**
+ * Gives the heading of a direction in the local plane.
+ * @param direction The direction, it must not be the null vector.
+ * @return The heading in degree in the range of [0, 360).
+ */
+float getHeadingInDegree(Common::LocalPoint const& direction) noexcept;
+
+/**
+ * Gives the shortest change from one heading to another, passing north is handled.
+ * @param from The first heading in degree.
+ * @param to The second heading in degree.
+ * @return The change in degree in the range of [-180, 180], positive is clockwise.
+ */
+float getHeadingChangeInDegree(float from, float to) noexcept;
+
+/**
+ * Gives the shortest change from one heading to another, passing north is handled.
+ * @param from The first heading in degree.
+ * @param to The second heading in degree.
+ * @return The change in radian in the range of [-pi, pi], positive is clockwise.
+ */
+float getHeadingChangeInRadian(float from, float to) noexcept;
+} // namespace Rapid::Algorithm::Heading
@@ -47,6 +47,13 @@ public:
      */
     virtual bool isOnTrack(Common::TrackData const& track, Common::PositionData const& position) const = 0;
 
+    /**
+     * Gives the maximum distance of a position to the bounding box of a track at which the position can be
+     * on the track. Positions that are further away are never detected on the track.
+     * @return The detection radius in meter.
+     */
+    virtual float getDetectionRadius() const = 0;
+
 protected:
     /**
      * Default constructor
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "LapComparison.hpp"
+#include "DistanceCalculator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <span>
+#include <thread>
+
+using namespace Rapid::Common;
+
+namespace Rapid::Algorithm
+{
+
+LapComparison::LapComparison(TrackData const& track, float gridSpacing)
+    : mFinishGate{track.getGeometry().getFinishGate()}
+    , mProjection{track.getGeometry().getProjection()}
+    , mGridSpacing{gridSpacing}
+{
+}
+
+ResampledLap LapComparison::resample(LapTelemetryView const& telemetry) const
+{
+    auto result = ResampledLap{.gridSpacing = mGridSpacing};
+    auto const count = telemetry.size();
+    if ((count < 2) || (mGridSpacing <= 0.0f)) {
+        return result;
+    }
+
+    auto const latitudes = telemetry.getLatitudes();
+    auto const longitudes = telemetry.getLongitudes();
+    auto const velocities = telemetry.getVelocities();
+    auto const timestamps = telemetry.getTimes();
+    auto distances = std::vector<float>(count);
+    DistanceCalculator::calculateCumulativeDistances(latitudes, longitudes, distances);
+
+    // The first log point is a bit behind the finish gate, the distance and the time to the gate are added to the
+    // log points, so every lap starts at the gate.
+    auto const project = [&](std::size_t index) {
+        return mProjection.project(PositionData{latitudes[index], longitudes[index]});
+    };
+    // The direction of travel through the gate is the heading of the first segment of the lap.
+    auto const firstSegment = project(1) - project(0);
+    auto const firstSegmentLength = length(firstSegment);
+    auto const offset = firstSegmentLength > 0.0f
+                            ? dot(project(0) - mFinishGate.center, firstSegment) / firstSegmentLength
+                            : 0.0f;
+    auto const firstSpeed = static_cast<float>(velocities[0]);
+    auto const timeOffset = firstSpeed > 0.0f ? offset / firstSpeed * 1000.0f : 0.0f;
+    auto const getTime = [&](std::size_t index) {
+        return static_cast<float>((timestamps[index] - timestamps[0]).toMilliseconds()) + timeOffset;
+    };
+
+    auto const lapLength = distances.back() + offset;
+    if (lapLength < 0.0f) {
+        return result;
+    }
+    auto const gridCount = static_cast<std::size_t>(lapLength / mGridSpacing) + 1;
+    result.times.resize(gridCount);
+    result.speeds.resize(gridCount);
+    auto points = std::vector<LocalPoint>(gridCount);
+
+    // The grid points in front of the first and behind the last log point are extrapolated from the first and the
+    // last segment.
+    auto segment = std::size_t{0};
+    auto from = project(0);
+    auto to = project(1);
+    for (std::size_t gridPoint = 0; gridPoint < gridCount; ++gridPoint) {
+        auto const distance = (static_cast<float>(gridPoint) * mGridSpacing) - offset;
+        if ((segment + 2 < count) && (distances[segment + 1] < distance)) {
+            while ((segment + 2 < count) && (distances[segment + 1] < distance)) {
+                ++segment;
+            }
+            from = project(segment);
+            to = project(segment + 1);
+        }
+
+        auto const segmentLength = distances[segment + 1] - distances[segment];
+        auto const fraction = segmentLength > 0.0f ? (distance - distances[segment]) / segmentLength : 0.0f;
+        auto const fromSpeed = static_cast<float>(velocities[segment]);
+        auto const toSpeed = static_cast<float>(velocities[segment + 1]);
+        result.times[gridPoint] = std::lerp(getTime(segment), getTime(segment + 1), fraction);
+        result.speeds[gridPoint] = std::max(std::lerp(fromSpeed, toSpeed, fraction), 0.0f);
+        points[gridPoint] = from + ((to - from) * fraction);
+    }
+
+    // The channels are derived like the channels of the DerivedChannelEngine, but from the grid points.
+    auto gridDistances = std::vector<float>(gridCount);
+    auto seconds = std::vector<float>(gridCount);
+    for (std::size_t gridPoint = 0; gridPoint < gridCount; ++gridPoint) {
+        gridDistances[gridPoint] = static_cast<float>(gridPoint) * mGridSpacing;
+        seconds[gridPoint] = result.times[gridPoint] / 1000.0f;
+    }
+    result.headings.resize(gridCount);
+    result.longitudinalAccelerations.resize(gridCount);
+    result.lateralAccelerations.resize(gridCount);
+    DerivedChannelEngine::deriveHeadings(points, gridDistances, result.headings);
+    DerivedChannelEngine::deriveLongitudinalAccelerations(result.speeds, seconds, result.longitudinalAccelerations);
+    DerivedChannelEngine::deriveLateralAccelerations(
+        result.speeds, seconds, gridDistances, result.headings, result.lateralAccelerations);
+    return result;
+}
+
+LapDifference LapComparison::compare(ResampledLap const& reference, ResampledLap const& lap)
+{
+    auto const count = std::min(reference.size(), lap.size());
+    auto result = LapDifference{};
+    result.deltaTimes.resize(count);
+    result.speedDifferences.resize(count);
+    std::ranges::transform(std::span{lap.times}.first(count),
+                           std::span{reference.times}.first(count),
+                           result.deltaTimes.begin(),
+                           std::minus{});
+    std::ranges::transform(std::span{lap.speeds}.first(count),
+                           std::span{reference.speeds}.first(count),
+                           result.speedDifferences.begin(),
+                           std::minus{});
+    return result;
+}
+
+std::vector<LapDifference> LapComparison::compareSession(SessionData const& session,
+                                                         std::size_t referenceLap,
+                                                         std::size_t threadCount) const
+{
+    auto const& laps = session.getLaps();
+    if (referenceLap >= laps.size()) {
+        return {};
+    }
+
+    auto results = std::vector<LapDifference>(laps.size());
+    if (threadCount == 0) {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threadCount = std::min(threadCount, laps.size());
+
+    auto const reference = resample(laps[referenceLap].getTelemetry().getView());
+    auto nextLap = std::atomic<std::size_t>{0};
+    auto const worker = [this, &laps, &reference, &results, &nextLap] {
+        // Every result is only written by the thread that took the index of the lap.
+        for (auto index = nextLap.fetch_add(1, std::memory_order_relaxed); index < laps.size();
+             index = nextLap.fetch_add(1, std::memory_order_relaxed)) {
+            results[index] = compare(reference, resample(laps[index].getTelemetry().getView()));
+        }
+    };
+
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(threadCount);
+    for (std::size_t thread = 1; thread < threadCount; ++thread) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return results;
+}
+
+} // namespace Rapid::Algorithm
@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_LAPCOMPARISON_HPP
+#define RAPID_ALGORITHM_LAPCOMPARISON_HPP
+
+#include "DerivedChannelEngine.hpp"
+#include <common/LapTelemetry.hpp>
+#include <common/SessionData.hpp>
+#include <common/TrackData.hpp>
+#include <vector>
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * The channels of a lap resampled onto a distance grid.
+ * The value at index i belongs to the distance i * gridSpacing from the finish gate.
+ */
+struct ResampledLap
+{
+    /**
+     * The distance between two grid points in meter.
+     */
+    float gridSpacing{0.0f};
+
+    /**
+     * The time since the crossing of the finish gate in milliseconds.
+     */
+    std::vector<float> times;
+
+    /**
+     * The speed in m/s.
+     */
+    std::vector<float> speeds;
+
+    /**
+     * The direction of travel in degree, clockwise from north in the range of [0, 360).
+     */
+    std::vector<float> headings;
+
+    /**
+     * The acceleration in the direction of travel in m/s², braking is negative.
+     */
+    std::vector<float> longitudinalAccelerations;
+
+    /**
+     * The acceleration across the direction of travel in m/s², positive in right hand corners.
+     */
+    std::vector<float> lateralAccelerations;
+
+    /**
+     * @return The number of grid points.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return times.size();
+    }
+};
+
+/**
+ * The difference of a lap to a reference lap at the same distance from the finish gate.
+ * The traces cover the distance of the shorter lap.
+ */
+struct LapDifference
+{
+    /**
+     * The time of the lap minus the time of the reference lap in milliseconds, positive when the lap is slower.
+     */
+    std::vector<float> deltaTimes;
+
+    /**
+     * The speed of the lap minus the speed of the reference lap in m/s.
+     */
+    std::vector<float> speedDifferences;
+};
+
+/**
+ * Compares laps by distance instead of time.
+ * The log points of a lap are resampled onto a common distance grid, the distance is measured from the finish
+ * gate of the track, so the grid points of all laps are at the same place of the track. The distances are
+ * calculated with the batch kernels of the DistanceCalculator, the resampling is a single forward pass.
+ * The comparison is immutable after construction and can be used by multiple threads at the same time.
+ */
+class LapComparison final
+{
+public:
+    /**
+     * The default distance between two grid points in meter.
+     */
+    static constexpr auto DefaultGridSpacing = 1.0f;
+
+    /**
+     * The distance in meter before and after a grid point over which the heading and the yaw rate are measured.
+     * It's the baseline of the @ref DerivedChannelEngine, which derives the channels of the grid points.
+     */
+    static constexpr auto HeadingBaseline = DerivedChannelEngine::HeadingBaseline;
+
+    /**
+     * Creates a comparison for the laps of a track.
+     * @param track The track whose finish gate aligns the laps.
+     * @param gridSpacing The distance between two grid points in meter.
+     */
+    explicit LapComparison(Common::TrackData const& track, float gridSpacing = DefaultGridSpacing);
+
+    /**
+     * Resamples the log points of a lap onto the distance grid.
+     * @param telemetry The log points of the lap in the order they were recorded.
+     * @return The resampled channels, empty when the lap has less than two log points.
+     */
+    [[nodiscard]] ResampledLap resample(Common::LapTelemetryView const& telemetry) const;
+
+    /**
+     * Compares a lap to a reference lap.
+     * @param reference The resampled reference lap.
+     * @param lap The resampled lap, must use the same grid spacing as the reference lap.
+     * @return The difference traces of the lap.
+     */
+    [[nodiscard]] static LapDifference compare(ResampledLap const& reference, ResampledLap const& lap);
+
+    /**
+     * Compares all laps of a session to a reference lap of the session. The laps are distributed over the
+     * threads one by one.
+     * @param session The session whose laps are compared.
+     * @param referenceLap The index of the reference lap in the session.
+     * @param threadCount The number of threads, 0 uses one thread per core.
+     * @return The difference traces of every lap in the order of the session, empty when the reference lap
+     *         doesn't exist.
+     */
+    [[nodiscard]] std::vector<LapDifference> compareSession(Common::SessionData const& session,
+                                                            std::size_t referenceLap,
+                                                            std::size_t threadCount = 0) const;
+
+private:
+    Common::Gate mFinishGate;
+    Common::LocalProjection mProjection;
+    float mGridSpacing;
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_LAPCOMPARISON_HPP
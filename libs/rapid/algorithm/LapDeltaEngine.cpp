@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "LapDeltaEngine.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace Rapid::Common;
+
+namespace Rapid::Algorithm
+{
+
+LapDeltaEngine::LapDeltaEngine() = default;
+
+void LapDeltaEngine::setReferenceLap(LapData const& lap)
+{
+    auto const& telemetry = lap.getTelemetry();
+    auto const latitudes = telemetry.getLatitudes();
+    auto const longitudes = telemetry.getLongitudes();
+    auto const times = telemetry.getTimes();
+
+    mPoints.clear();
+    mDistances.clear();
+    mElapsedTimes.clear();
+    mPoints.reserve(telemetry.size());
+    mDistances.reserve(telemetry.size());
+    mElapsedTimes.reserve(telemetry.size());
+    mReferenceLaptime = lap.getLaptime();
+    startLap();
+    if (telemetry.empty()) {
+        return;
+    }
+
+    mProjection = LocalProjection{PositionData{latitudes[0], longitudes[0]}};
+    for (std::size_t index = 0; index < telemetry.size(); ++index) {
+        auto const point = mProjection.project(PositionData{latitudes[index], longitudes[index]});
+        auto const distance = mPoints.empty() ? 0.0f : mDistances.back() + length(point - mPoints.back());
+        mPoints.push_back(point);
+        mDistances.push_back(distance);
+        mElapsedTimes.push_back((times[index] - times[0]).toMilliseconds());
+    }
+}
+
+bool LapDeltaEngine::hasReferenceLap() const noexcept
+{
+    return mPoints.size() >= 2;
+}
+
+Timestamp LapDeltaEngine::getReferenceLaptime() const noexcept
+{
+    return mReferenceLaptime;
+}
+
+void LapDeltaEngine::startLap() noexcept
+{
+    mCursor = 0;
+    mLapStartTime.reset();
+}
+
+std::optional<LapDelta> LapDeltaEngine::update(GpsPositionData const& position) noexcept
+{
+    if (!hasReferenceLap()) {
+        return std::nullopt;
+    }
+    if (!mLapStartTime.has_value()) {
+        mLapStartTime = position.getTime();
+    }
+
+    // The cursor follows the closest reference point. The reference points are passed in order, so the cursor
+    // moves only a few points per update.
+    auto const point = mProjection.project(position.getPosition());
+    auto const lastIndex = mPoints.size() - 1;
+    while (mCursor < lastIndex &&
+           squaredLength(mPoints[mCursor + 1] - point) <= squaredLength(mPoints[mCursor] - point)) {
+        ++mCursor;
+    }
+
+    // The position is interpolated on the reference segment before or after the cursor, depending on which side
+    // of the closest reference point the position is.
+    auto begin = std::min(mCursor, lastIndex - 1);
+    if (mCursor > 0 && mCursor < lastIndex &&
+        dot(point - mPoints[mCursor], mPoints[mCursor + 1] - mPoints[mCursor]) < 0.0f) {
+        begin = mCursor - 1;
+    }
+    auto const segment = mPoints[begin + 1] - mPoints[begin];
+    auto const segmentLength = squaredLength(segment);
+    auto const fraction =
+        segmentLength > 0.0f ? std::clamp(dot(point - mPoints[begin], segment) / segmentLength, 0.0f, 1.0f) : 0.0f;
+    if (length(point - (mPoints[begin] + (segment * fraction))) > MaximumDeviation) {
+        return std::nullopt;
+    }
+
+    auto const referenceElapsed =
+        static_cast<double>(mElapsedTimes[begin]) +
+        (static_cast<double>(fraction) * static_cast<double>(mElapsedTimes[begin + 1] - mElapsedTimes[begin]));
+    auto const elapsed = (position.getTime() - *mLapStartTime).toMilliseconds();
+    auto const delta = static_cast<std::int32_t>(std::llround(static_cast<double>(elapsed) - referenceElapsed));
+    auto const predictedLaptime = std::max(mReferenceLaptime.toMilliseconds() + delta, std::int64_t{0});
+    return LapDelta{.deltaInMilliseconds = delta,
+                    .predictedLaptime = Timestamp::fromMilliseconds(predictedLaptime),
+                    .distance = mDistances[begin] + (fraction * (mDistances[begin + 1] - mDistances[begin]))};
+}
+
+} // namespace Rapid::Algorithm
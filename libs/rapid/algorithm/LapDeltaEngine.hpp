@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_LAPDELTAENGINE_HPP
+#define RAPID_ALGORITHM_LAPDELTAENGINE_HPP
+
+#include <common/GpsPositionData.hpp>
+#include <common/LapData.hpp>
+#include <common/TrackGeometry.hpp>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * The difference of the current lap to the reference lap at the current position.
+ */
+struct LapDelta
+{
+    /**
+     * The time difference to the reference lap in milliseconds, positive values are slower than the reference.
+     */
+    std::int32_t deltaInMilliseconds{0};
+
+    /**
+     * The laptime of the current lap when the difference to the reference stays the same until the finish.
+     */
+    Common::Timestamp predictedLaptime;
+
+    /**
+     * The distance along the reference lap in meter at which the current position was matched.
+     */
+    float distance{0.0f};
+};
+
+/**
+ * Calculates the live delta of the current lap to a reference lap.
+ * The log points of the reference lap are projected once into a local plane together with the cumulative
+ * distance and the elapsed time of every log point. A position of the current lap is matched to the reference
+ * lap by a cursor that only moves forward, so an update is amortized constant time and doesn't allocate.
+ * The elapsed times of both laps are measured from the first log point of the lap.
+ */
+class LapDeltaEngine final
+{
+public:
+    /**
+     * The maximum distance in meter of a position to the reference lap at which the position is matched.
+     */
+    static constexpr auto MaximumDeviation = 100.0f;
+
+    /**
+     * Creates an engine without reference lap.
+     */
+    LapDeltaEngine();
+
+    /**
+     * Sets the lap the current lap is compared to.
+     * The log points are copied, the lap can be destroyed afterwards.
+     * @param lap The reference lap with its log points and laptime.
+     */
+    void setReferenceLap(Common::LapData const& lap);
+
+    /**
+     * Checks if a reference lap with at least two log points is set.
+     * @return true A delta can be calculated.
+     * @return false No delta can be calculated.
+     */
+    [[nodiscard]] bool hasReferenceLap() const noexcept;
+
+    /**
+     * Gives the laptime of the reference lap.
+     * @return The laptime of the reference lap, zero when no reference lap is set.
+     */
+    [[nodiscard]] Common::Timestamp getReferenceLaptime() const noexcept;
+
+    /**
+     * Starts a new lap, the next positions are matched from the begin of the reference lap.
+     */
+    void startLap() noexcept;
+
+    /**
+     * Matches the position of the current lap to the reference lap.
+     * The first position after @ref LapDeltaEngine::startLap is the begin of the current lap.
+     * @param position The new position of the current lap.
+     * @return The delta at the position or std::nullopt when there is no reference lap or the position is too far
+     *         away from the reference lap.
+     */
+    [[nodiscard]] std::optional<LapDelta> update(Common::GpsPositionData const& position) noexcept;
+
+private:
+    Common::LocalProjection mProjection;
+    std::vector<Common::LocalPoint> mPoints;
+    std::vector<float> mDistances;
+    std::vector<std::int64_t> mElapsedTimes;
+    Common::Timestamp mReferenceLaptime;
+
+    std::size_t mCursor{0};
+    std::optional<Common::Timestamp> mLapStartTime;
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_LAPDELTAENGINE_HPP
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "LapReplayEngine.hpp"
+#include "GateCrossing.hpp"
+#include "LineCrossingDetector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+using namespace Rapid::Common;
+using namespace Rapid::Algorithm::GateCrossing;
+
+namespace Rapid::Algorithm
+{
+
+struct LapReplayEngine::State
+{
+    explicit State(TrackGeometry const& geometry)
+        : detector{geometry}
+    {
+    }
+
+    LineCrossingDetector detector;
+    std::vector<LapData> laps;
+    std::vector<Timestamp> sectorTimes;
+    double lapStartedTime{0.0};
+    std::int64_t sectorStartedOffset{0};
+
+    void startLap(double crossingTime) noexcept
+    {
+        lapStartedTime = crossingTime;
+        sectorStartedOffset = 0;
+        sectorTimes.clear();
+    }
+
+    void finishSector(double crossingTime)
+    {
+        // The sector is rounded from the start of the lap, so the rounding errors don't add up over the lap.
+        auto const offset = std::llround(elapsed(lapStartedTime, crossingTime));
+        sectorTimes.push_back(Timestamp::fromMilliseconds(offset - sectorStartedOffset));
+        sectorStartedOffset = offset;
+    }
+};
+
+LapReplayEngine::LapReplayEngine(TrackData const& track)
+    : mGeometry{track.getGeometry()}
+{
+}
+
+LapReplayEngine::~LapReplayEngine() = default;
+LapReplayEngine::LapReplayEngine(LapReplayEngine const& other) = default;
+LapReplayEngine& LapReplayEngine::operator=(LapReplayEngine const& other) = default;
+LapReplayEngine::LapReplayEngine(LapReplayEngine&& other) noexcept = default;
+LapReplayEngine& LapReplayEngine::operator=(LapReplayEngine&& other) noexcept = default;
+
+std::vector<LapData> LapReplayEngine::replay(LapTelemetryView const& telemetry) const
+{
+    auto state = State{mGeometry};
+    replay(state, telemetry);
+    return std::move(state.laps);
+}
+
+std::vector<LapData> LapReplayEngine::replay(SessionData const& session) const
+{
+    auto state = State{mGeometry};
+    for (auto const& lap : session.getLaps()) {
+        replay(state, lap.getTelemetry().getView());
+    }
+    return std::move(state.laps);
+}
+
+std::vector<std::vector<LapData>> LapReplayEngine::replaySessions(TrackData const& track,
+                                                                  std::span<SessionData const> sessions,
+                                                                  std::size_t threadCount)
+{
+    auto results = std::vector<std::vector<LapData>>(sessions.size());
+    if (threadCount == 0) {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threadCount = std::min(threadCount, sessions.size());
+
+    auto const engine = LapReplayEngine{track};
+    auto nextSession = std::atomic<std::size_t>{0};
+    auto const worker = [&engine, &sessions, &results, &nextSession] {
+        // Every result is only written by the thread that took the index of the session.
+        for (auto index = nextSession.fetch_add(1, std::memory_order_relaxed); index < sessions.size();
+             index = nextSession.fetch_add(1, std::memory_order_relaxed)) {
+            results[index] = engine.replay(sessions[index]);
+        }
+    };
+
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(threadCount);
+    for (std::size_t thread = 1; thread < threadCount; ++thread) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return results;
+}
+
+void LapReplayEngine::replay(State& state, LapTelemetryView const& telemetry) const
+{
+    auto const latitudes = telemetry.getLatitudes();
+    auto const longitudes = telemetry.getLongitudes();
+    auto const times = telemetry.getTimes();
+    for (std::size_t index = 0; index < telemetry.size(); ++index) {
+        auto const crossing = state.detector.update(PositionData{latitudes[index], longitudes[index]},
+                                                    static_cast<double>(times[index].toMilliseconds()));
+        if (!crossing.has_value()) {
+            continue;
+        }
+
+        if (crossing->line == LineCrossingDetector::Line::Start) {
+            state.startLap(crossing->time);
+        } else if (crossing->line == LineCrossingDetector::Line::Section) {
+            state.finishSector(crossing->time);
+        } else {
+            state.finishSector(crossing->time);
+            state.laps.emplace_back(std::move(state.sectorTimes));
+            if (state.detector.isLapActive()) {
+                state.startLap(crossing->time);
+            }
+        }
+    }
+}
+
+} // namespace Rapid::Algorithm
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_LAPREPLAYENGINE_HPP
+#define RAPID_ALGORITHM_LAPREPLAYENGINE_HPP
+
+#include <common/LapData.hpp>
+#include <common/SessionData.hpp>
+#include <common/TrackData.hpp>
+#include <span>
+#include <vector>
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * Recomputes the laps and sectors of stored telemetry for a track, e.g. after the gates of the track were
+ * corrected. The engine drives the @ref LineCrossingDetector of the @ref LineCrossingLaptimer in a tight loop over
+ * the columns of the telemetry, there are no signals or properties and the only allocations are the created laps.
+ * A replay of the same positions gives the same lap times as the @ref LineCrossingLaptimer. The sector times
+ * are rounded from the start of the lap, so the sector times of a lap always sum up to the lap time.
+ * The engine is immutable after construction and can be used by multiple threads at the same time.
+ */
+class LapReplayEngine final
+{
+public:
+    /**
+     * Creates an engine for the gates of the track.
+     * @param track The track whose gates are used to detect the laps.
+     */
+    explicit LapReplayEngine(Common::TrackData const& track);
+
+    /**
+     * Default destructor
+     */
+    ~LapReplayEngine();
+
+    /**
+     * Default copy constructor
+     */
+    LapReplayEngine(LapReplayEngine const& other);
+
+    /**
+     * Default copy assignment operator
+     */
+    LapReplayEngine& operator=(LapReplayEngine const& other);
+
+    /**
+     * Default move constructor
+     */
+    LapReplayEngine(LapReplayEngine&& other) noexcept;
+
+    /**
+     * Default move assignment operator
+     */
+    LapReplayEngine& operator=(LapReplayEngine&& other) noexcept;
+
+    /**
+     * Replays contiguous log points.
+     * @param telemetry The log points in the order they were recorded.
+     * @return The finished laps with their sector times. A lap that isn't finished at the end is dropped.
+     */
+    [[nodiscard]] std::vector<Common::LapData> replay(Common::LapTelemetryView const& telemetry) const;
+
+    /**
+     * Replays the log points of all laps of a session as one contiguous recording.
+     * @param session The session whose log points shall be replayed.
+     * @return The finished laps with their sector times. A lap that isn't finished at the end is dropped.
+     */
+    [[nodiscard]] std::vector<Common::LapData> replay(Common::SessionData const& session) const;
+
+    /**
+     * Replays many sessions in parallel. The sessions are distributed over the threads one by one, so long
+     * and short sessions are balanced between the threads.
+     * @param track The track whose gates are used to detect the laps of all sessions.
+     * @param sessions The sessions that shall be replayed.
+     * @param threadCount The number of threads, 0 uses one thread per core.
+     * @return The replayed laps of every session, in the order of the sessions.
+     */
+    [[nodiscard]] static std::vector<std::vector<Common::LapData>> replaySessions(
+        Common::TrackData const& track, std::span<Common::SessionData const> sessions, std::size_t threadCount = 0);
+
+private:
+    struct State;
+    void replay(State& state, Common::LapTelemetryView const& telemetry) const;
+
+private:
+    Common::TrackGeometry mGeometry;
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_LAPREPLAYENGINE_HPP
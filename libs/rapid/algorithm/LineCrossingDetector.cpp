@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "LineCrossingDetector.hpp"
+#include "GateCrossing.hpp"
+
+using namespace Rapid::Common;
+
+namespace Rapid::Algorithm
+{
+
+LineCrossingDetector::LineCrossingDetector() = default;
+
+LineCrossingDetector::LineCrossingDetector(TrackGeometry const& geometry)
+    : mProjection{geometry.getProjection()}
+    , mTopology{geometry.getTopology()}
+    , mFinishGate{geometry.getFinishGate()}
+    , mSectionGates{geometry.getSectionGates().begin(), geometry.getSectionGates().end()}
+{
+    if (geometry.hasStartGate()) {
+        mStartGate = geometry.getStartGate();
+    }
+    if (geometry.getPitLaneGate() != nullptr) {
+        mPitLaneGate = *geometry.getPitLaneGate();
+    }
+}
+
+bool LineCrossingDetector::isLapActive() const noexcept
+{
+    return mLapState != LapState::WaitingForFirstStart;
+}
+
+std::optional<LineCrossingDetector::Crossing> LineCrossingDetector::update(PositionData const& position, double time)
+{
+    auto const point = mProjection.project(position);
+    if (!mLastPoint.has_value()) {
+        mLastPoint = point;
+        mLastTime = time;
+        return std::nullopt;
+    }
+
+    if (length(point - *mLastPoint) > MaximumMovement) {
+        mLastPoint = point;
+        mLastHeading = {};
+        mLastTime = time;
+        return std::nullopt;
+    }
+
+    auto crossing = std::optional<Crossing>{};
+    auto const sectionCount = mSectionGates.size();
+    auto const firstState = (sectionCount > 0) ? LapState::IteratingTrackPoints : LapState::WaitingForFinish;
+    if (mLapState == LapState::WaitingForFirstStart) {
+        if (auto const crossingTime = cross(getStartGate(), point, time)) {
+            mLapState = firstState;
+            mCurrentTrackPoint = 0;
+            crossing = Crossing{.line = Line::Start, .time = *crossingTime};
+        }
+    } else if (mLapState == LapState::IteratingTrackPoints) {
+        if (auto const crossingTime = cross(mSectionGates[mCurrentTrackPoint], point, time)) {
+            ++mCurrentTrackPoint;
+            if (mCurrentTrackPoint >= sectionCount) {
+                mLapState = LapState::WaitingForFinish;
+            }
+            crossing = Crossing{.line = Line::Section, .time = *crossingTime};
+        }
+    } else if (mLapState == LapState::WaitingForFinish) {
+        // The pit lane gate bypasses the finish gate, only one of them is crossed.
+        auto crossingTime = cross(mFinishGate, point, time);
+        if (!crossingTime.has_value() && mPitLaneGate.has_value()) {
+            crossingTime = cross(*mPitLaneGate, point, time);
+        }
+        if (crossingTime.has_value()) {
+            mCurrentTrackPoint = 0;
+            mLapState = (mTopology == TrackTopology::PointToPoint) ? LapState::WaitingForFirstStart : firstState;
+            crossing = Crossing{.line = Line::Finish, .time = *crossingTime};
+        }
+    }
+
+    if (point != *mLastPoint) {
+        mLastHeading = point - *mLastPoint;
+    }
+    mLastPoint = point;
+    mLastTime = time;
+    return crossing;
+}
+
+Gate& LineCrossingDetector::getStartGate() noexcept
+{
+    return mStartGate.has_value() ? *mStartGate : mFinishGate;
+}
+
+std::optional<double> LineCrossingDetector::cross(Gate& gate, LocalPoint const& point, double time) noexcept
+{
+    auto const crossingTime = GateCrossing::getCrossingTime(gate, mLastHeading, *mLastPoint, mLastTime, point, time);
+    if (crossingTime.has_value() && !gate.hasDirection()) {
+        gate.setDirection(point - *mLastPoint);
+    }
+    return crossingTime;
+}
+
+} // namespace Rapid::Algorithm
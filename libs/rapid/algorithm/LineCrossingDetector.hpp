@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_LINECROSSINGDETECTOR_HPP
+#define RAPID_ALGORITHM_LINECROSSINGDETECTOR_HPP
+
+#include <common/GpsPositionData.hpp>
+#include <common/TrackGeometry.hpp>
+#include <optional>
+#include <vector>
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * The lap state machine of the line crossing laptimers.
+ * The detector is fed with the positions in the order they are recorded and reports when the next expected gate of
+ * the topology of the track is crossed (see @ref Common::TrackTopology). The @ref LineCrossingLaptimer drives the
+ * detector with the live positions and the @ref LapReplayEngine with stored telemetry, so both detect the same laps.
+ * The detector only tracks the gates, the lap and sector times are calculated by the callers from the crossing times.
+ * The gates of the geometry have no direction of travel, every gate takes the heading of its first crossing, so driving
+ * back over a gate later isn't a crossing.
+ */
+class LineCrossingDetector final
+{
+public:
+    /**
+     * The line that is crossed by a movement.
+     */
+    enum class Line
+    {
+        /**
+         * The start line is crossed, a lap is started.
+         */
+        Start,
+
+        /**
+         * The next section line of the lap is crossed.
+         */
+        Section,
+
+        /**
+         * The finish line or the pit lane line is crossed. The next lap of a circuit starts at the same time, the
+         * detector waits for the start line of a point to point track.
+         */
+        Finish
+    };
+
+    /**
+     * The crossing of a line.
+     */
+    struct Crossing
+    {
+        /**
+         * The crossed line.
+         */
+        Line line{Line::Start};
+
+        /**
+         * The interpolated time of the crossing in milliseconds of the day.
+         */
+        double time{0.0};
+    };
+
+    /**
+     * The maximum distance in meter between two positions of a movement that can cross a gate, this is more than
+     * 500 km/h at 1 Hz. A longer movement is a gap of the positions or an outlier.
+     */
+    static constexpr auto MaximumMovement = 150.0f;
+
+    /**
+     * Creates a detector for an empty track.
+     */
+    LineCrossingDetector();
+
+    /**
+     * Creates a detector for the gates of a track.
+     * @param geometry The geometry of the track.
+     */
+    explicit LineCrossingDetector(Common::TrackGeometry const& geometry);
+
+    /**
+     * Checks if a lap is in progress.
+     * @return true A lap is started and not finished yet.
+     * @return false The detector waits for the start line.
+     */
+    [[nodiscard]] bool isLapActive() const noexcept;
+
+    /**
+     * Updates the detector with the next position.
+     * The movement from the previous position is checked against the next expected gate, so at most one gate is
+     * crossed per position. A movement longer than @ref MaximumMovement doesn't cross a gate.
+     * @param position The new position.
+     * @param time The time of the position in milliseconds of the day.
+     * @return The crossed line or std::nullopt when no line is crossed.
+     */
+    std::optional<Crossing> update(Common::PositionData const& position, double time);
+
+private:
+    enum LapState
+    {
+        WaitingForFirstStart,
+        IteratingTrackPoints,
+        WaitingForFinish
+    };
+
+    Common::Gate& getStartGate() noexcept;
+    std::optional<double> cross(Common::Gate& gate, Common::LocalPoint const& point, double time) noexcept;
+
+private:
+    Common::LocalProjection mProjection;
+    Common::TrackTopology mTopology{Common::TrackTopology::Circuit};
+    Common::Gate mFinishGate;
+    std::optional<Common::Gate> mStartGate;
+    std::vector<Common::Gate> mSectionGates;
+    std::optional<Common::Gate> mPitLaneGate;
+    std::optional<Common::LocalPoint> mLastPoint;
+    Common::LocalPoint mLastHeading;
+    double mLastTime{0.0};
+    LapState mLapState{WaitingForFirstStart};
+    std::size_t mCurrentTrackPoint{0};
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_LINECROSSINGDETECTOR_HPP
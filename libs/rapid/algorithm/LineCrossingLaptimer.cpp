@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "LineCrossingLaptimer.hpp"
+#include "GateCrossing.hpp"
+
+using namespace Rapid::Common;
+using namespace Rapid::Algorithm::GateCrossing;
+
+namespace Rapid::Algorithm
+{
+
+LineCrossingLaptimer::LineCrossingLaptimer() = default;
+
+void LineCrossingLaptimer::setTrack(Common::TrackData const& track)
+{
+    // A lap of the previous track is not continued, its gates don't exist on the new track.
+    mDetector = LineCrossingDetector{track.getGeometry()};
+    mLapStartedTime = 0.0;
+    mSectorStartedTime = 0.0;
+    currentLaptime.set(Timestamp{});
+    currentSectorTime.set(Timestamp{});
+}
+
+void LineCrossingLaptimer::updatePositionAndTime(Common::GpsPositionData const& data)
+{
+    auto const time = static_cast<double>(data.getTime().toMilliseconds());
+    auto const lapActive = mDetector.isLapActive();
+    auto const crossing = mDetector.update(data.getPosition(), time);
+
+    // Update currentLaptime
+    if (lapActive) {
+        currentLaptime.set(toTimestamp(elapsed(mLapStartedTime, time)));
+        currentSectorTime.set(toTimestamp(elapsed(mSectorStartedTime, time)));
+    }
+    if (!crossing.has_value()) {
+        return;
+    }
+
+    if (crossing->line == LineCrossingDetector::Line::Start) {
+        mLapStartedTime = crossing->time;
+        mSectorStartedTime = crossing->time;
+        currentLaptime.set(toTimestamp(elapsed(crossing->time, time)));
+        currentSectorTime.set(toTimestamp(elapsed(crossing->time, time)));
+        lapStarted.emit();
+    } else if (crossing->line == LineCrossingDetector::Line::Section) {
+        mLastSectorTime = toTimestamp(elapsed(mSectorStartedTime, crossing->time));
+        mSectorStartedTime = crossing->time;
+        currentSectorTime.set(toTimestamp(elapsed(crossing->time, time)));
+        sectorFinished.emit();
+    } else {
+        mLastLapTime = toTimestamp(elapsed(mLapStartedTime, crossing->time));
+        mLastSectorTime = toTimestamp(elapsed(mSectorStartedTime, crossing->time));
+        if (!mDetector.isLapActive()) {
+            // A point to point track waits for the start line again.
+            currentLaptime.set(Timestamp{});
+            currentSectorTime.set(Timestamp{});
+            lapFinished.emit();
+        } else {
+            mLapStartedTime = crossing->time;
+            mSectorStartedTime = crossing->time;
+            currentLaptime.set(toTimestamp(elapsed(crossing->time, time)));
+            currentSectorTime.set(toTimestamp(elapsed(crossing->time, time)));
+            lapFinished.emit();
+            lapStarted.emit();
+        }
+    }
+}
+
+Common::Timestamp LineCrossingLaptimer::getLastLaptime() const
+{
+    return mLastLapTime;
+}
+
+Common::Timestamp LineCrossingLaptimer::getLastSectorTime() const
+{
+    return mLastSectorTime;
+}
+
+} // namespace Rapid::Algorithm
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_LINECROSSINGLAPTIMER_HPP
+#define RAPID_ALGORITHM_LINECROSSINGLAPTIMER_HPP
+
+#include "ILaptimer.hpp"
+#include "LineCrossingDetector.hpp"
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * A laptimer that detects the crossing of the start, finish and section lines as segment intersection.
+ * The gates of the track are line segments in the local plane of the track (see @ref Common::TrackGeometry).
+ * Every movement between two consecutive positions is tested against the next expected gate and the
+ * moment of the crossing is interpolated between the times of the two positions. So the lap and sector
+ * times aren't quantized to the update rate of the GPS receiver. The crossing times are kept with
+ * sub-millisecond precision, only the reported times are rounded to the resolution of @ref Common::Timestamp.
+ * An update is constant time and doesn't allocate, only the next expected gate of the topology of the track
+ * is checked by the @ref LineCrossingDetector.
+ */
+class LineCrossingLaptimer final : public ILaptimer
+{
+public:
+    /**
+     * Default constructor
+     */
+    LineCrossingLaptimer();
+
+    /**
+     * Disabled copy operator
+     */
+    LineCrossingLaptimer(LineCrossingLaptimer const&) = delete;
+
+    /**
+     * Disabled copy operator
+     */
+    LineCrossingLaptimer& operator=(LineCrossingLaptimer const&) = delete;
+
+    /**
+     * Default move operator
+     */
+    LineCrossingLaptimer(LineCrossingLaptimer&&) noexcept = default;
+
+    /**
+     * Default move operator
+     */
+    LineCrossingLaptimer& operator=(LineCrossingLaptimer&&) noexcept = default;
+
+    /**
+     * Default destructor
+     */
+    ~LineCrossingLaptimer() override = default;
+
+    /**
+     * @copydoc ILaptimer::setTrack(const Common::TrackData &track)
+     */
+    void setTrack(Common::TrackData const& track) override;
+
+    /**
+     * @copydoc ILaptimer::updatePositionAndTime(const Common::GpsPositionData &data)
+     */
+    void updatePositionAndTime(Common::GpsPositionData const& data) override;
+
+    /**
+     * @copydoc ILaptimer::getLastLaptime()
+     */
+    Common::Timestamp getLastLaptime() const override;
+
+    /**
+     * @copydoc ILaptimer::getLastSectorTime()
+     */
+    Common::Timestamp getLastSectorTime() const override;
+
+private:
+    LineCrossingDetector mDetector;
+    double mLapStartedTime{0.0};
+    double mSectorStartedTime{0.0};
+    Common::Timestamp mLastLapTime;
+    Common::Timestamp mLastSectorTime;
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_LINECROSSINGLAPTIMER_HPP
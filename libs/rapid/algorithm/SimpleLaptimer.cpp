@@ -3,8 +3,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "SimpleLaptimer.hpp"
-#include "DistanceCalculator.hpp"
 #include <algorithm>
+#include <array>
+#include <iterator>
 
 using namespace Rapid::Common;
 
@@ -16,14 +17,14 @@ SimpleLaptimer::SimpleLaptimer() = default;
 void SimpleLaptimer::setTrack(Common::TrackData const& track)
 {
     mTrackData = track;
+    // The buffered points are projected with the geometry of the previous track.
+    mCurrentPoints.clear();
 }
 
 void SimpleLaptimer::updatePositionAndTime(Common::GpsPositionData const& data)
 {
-    mCurrentPoints.push_front(data.getPosition());
-    if (mCurrentPoints.size() > 4) {
-        mCurrentPoints.pop_back();
-    } else if (mCurrentPoints.size() < 4) {
+    auto const& geometry = mTrackData.getGeometry();
+    if (!updateWindow(geometry.getProjection().project(data.getPosition()), data.getTime())) {
         return;
     }
 
@@ -37,50 +38,52 @@ void SimpleLaptimer::updatePositionAndTime(Common::GpsPositionData const& data)
     }
 
     if (mLapState == LapState::WaitingForFirstStart) {
-        auto const useFinishLineAsStartline = mTrackData.getStartline() == Common::PositionData{};
-        auto const startLine = useFinishLineAsStartline ? mTrackData.getFinishline() : mTrackData.getStartline();
-        if (passedPoint(startLine)) {
+        if (passedPoint(geometry.getStartGate())) {
             mLapState =
                 (mTrackData.getNumberOfSections() > 0) ? LapState::IteratingTrackPoints : LapState::WaitingForFinish;
             mCurrentTrackPoint = 0;
-            currentLaptime.set(Timestamp{"00:00:00.000"});
-            currentSectorTime.set(Timestamp{"00:00:00.000"});
+            currentLaptime.set(Timestamp{});
+            currentSectorTime.set(Timestamp{});
             mLapStartedTimestamp = data.getTime();
             mSectorStartedTimestamp = data.getTime();
             lapStarted.emit();
         }
     } else if (mLapState == LapState::IteratingTrackPoints) {
-        if (passedPoint(mTrackData.getSection(mCurrentTrackPoint))) {
+        if (passedPoint(geometry.getSectionGates()[mCurrentTrackPoint])) {
             ++mCurrentTrackPoint;
             if (mCurrentTrackPoint >= mTrackData.getNumberOfSections()) {
                 mLapState = LapState::WaitingForFinish;
             }
             mLastSectorTime = currentSectorTime.get();
             mSectorStartedTimestamp = data.getTime();
-            currentSectorTime.set(Timestamp{"00:00:00.000"});
+            currentSectorTime.set(Timestamp{});
             sectorFinished.emit();
         }
     } else if (mLapState == LapState::WaitingForFinish) {
-        auto const finishLine = mTrackData.getFinishline();
-        if (passedPoint(finishLine)) {
+        // The pit lane gate bypasses the finish gate, only one of them is passed.
+        auto const* pitLaneGate = geometry.getPitLaneGate();
+        if (passedPoint(geometry.getFinishGate()) || ((pitLaneGate != nullptr) && passedPoint(*pitLaneGate))) {
             mLastLapTime = currentLaptime.get();
             mLastSectorTime = currentSectorTime.get();
             mLapStartedTimestamp = data.getTime();
             mSectorStartedTimestamp = data.getTime();
-            currentLaptime.set(Timestamp{"00:00:00.000"});
-            currentSectorTime.set(Timestamp{"00:00:00.000"});
-
-            // TODO: Only works with with a circuit. Additional check is needed in the future when the finish line
-            // and start line is not the same.
-            if (mTrackData.getNumberOfSections() > 0) {
-                mCurrentTrackPoint = 0;
-                mLapState = LapState::IteratingTrackPoints;
-            } else {
+            currentLaptime.set(Timestamp{});
+            currentSectorTime.set(Timestamp{});
+
+            if (geometry.getTopology() == TrackTopology::PointToPoint) {
                 mCurrentPoints.clear();
+                mLapState = LapState::WaitingForFirstStart;
+                lapFinished.emit();
+            } else {
+                if (mTrackData.getNumberOfSections() > 0) {
+                    mCurrentTrackPoint = 0;
+                    mLapState = LapState::IteratingTrackPoints;
+                } else {
+                    mCurrentPoints.clear();
+                }
+                lapFinished.emit();
+                lapStarted.emit();
             }
-
-            lapFinished.emit();
-            lapStarted.emit();
         }
     }
 }
@@ -95,29 +98,53 @@ Common::Timestamp SimpleLaptimer::getLastSectorTime() const
     return mLastSectorTime;
 }
 
-bool SimpleLaptimer::passedPoint(Common::PositionData const& point) const
+bool SimpleLaptimer::updateWindow(Common::LocalPoint const& point, Common::Timestamp const& time)
 {
-    constexpr std::uint8_t range = 50;
-    bool pointsInRange = std::all_of(mCurrentPoints.cbegin(), mCurrentPoints.cend(), [=](Common::PositionData pos) {
-        return DistanceCalculator::calculateDistance(pos, point) <= range;
-    });
+    mCurrentPoints.push_front(WindowPoint{.point = point, .time = time});
+    // The oldest position is removed when the remaining positions still cover the window. Positions without
+    // time have no span and keep the minimum number of positions.
+    while ((mCurrentPoints.size() > MaximumWindowPoints) ||
+           ((mCurrentPoints.size() > MinimumWindowPoints) &&
+            ((getWindowSpan(mCurrentPoints.size() - 2) >= WindowDuration) ||
+             (getWindowSpan(mCurrentPoints.size() - 2) <= std::chrono::milliseconds{0})))) {
+        mCurrentPoints.pop_back();
+    }
 
-    if (!pointsInRange) {
+    if (mCurrentPoints.size() < MinimumWindowPoints) {
         return false;
     }
+    auto const span = getWindowSpan(mCurrentPoints.size() - 1);
+    return (span >= WindowDuration) || (span <= std::chrono::milliseconds{0}) ||
+           (mCurrentPoints.size() == MaximumWindowPoints);
+}
+
+std::chrono::milliseconds SimpleLaptimer::getWindowSpan(std::size_t index) const noexcept
+{
+    // The difference of the timestamps wraps at midnight.
+    return std::chrono::milliseconds{(mCurrentPoints.front().time - mCurrentPoints[index].time).toMilliseconds()};
+}
 
-    std::array<float, 4> distances{};
-    for (size_t i = 0; i < 4; ++i) {
-        distances[i] = DistanceCalculator::calculateDistance(mCurrentPoints[i], point);
+bool SimpleLaptimer::passedPoint(Common::Gate const& gate) const
+{
+    auto distances = std::array<float, MaximumWindowPoints>{};
+    auto const count = mCurrentPoints.size();
+    for (size_t i = 0; i < count; ++i) {
+        distances[i] = gate.distanceTo(mCurrentPoints[i].point);
+        if (distances[i] > GateRange) {
+            return false;
+        }
     }
 
-    bool lastDistance = distances[2] < distances[3];
+    bool lastDistance = distances[count - 2] < distances[count - 1];
     bool firstDistance = distances[0] > distances[1];
-    if (firstDistance and lastDistance and ((distances[1] < distances[2]) or (distances[1] > distances[2]))) {
-        return true;
+    if (!firstDistance or !lastDistance) {
+        return false;
     }
 
-    return false;
+    // The closest position is between the latest and the oldest position, a standing vehicle doesn't pass the gate.
+    auto const closest = static_cast<std::size_t>(
+        std::distance(distances.cbegin(), std::min_element(distances.cbegin(), distances.cbegin() + count)));
+    return distances[closest] != distances[closest + 1];
 }
 
 } // namespace Rapid::Algorithm
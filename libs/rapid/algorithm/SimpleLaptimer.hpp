@@ -6,14 +6,42 @@
 #define SIMPLELAPTIMER_HPP
 
 #include "ILaptimer.hpp"
+#include <chrono>
 #include <deque>
 
 namespace Rapid::Algorithm
 {
 
+/**
+ * A laptimer that detects the passing of a gate by the closest approach of the latest positions to the gate.
+ * The positions are kept in a window over a fixed duration instead of a fixed number of positions, so the
+ * detection behaves the same for GPS receivers with 10 Hz up to 100 Hz. The window is capped, so the cost of an
+ * update is independent of the rate.
+ */
 class SimpleLaptimer final : public ILaptimer
 {
 public:
+    /**
+     * The minimum number of positions that are checked for a passed gate.
+     */
+    static constexpr std::size_t MinimumWindowPoints = 4;
+
+    /**
+     * The maximum number of positions that are checked for a passed gate, this is a window of 320 ms at 100 Hz.
+     */
+    static constexpr std::size_t MaximumWindowPoints = 32;
+
+    /**
+     * The duration that is covered by the positions that are checked for a passed gate. This are 4 positions at
+     * 25 Hz, positions without time or with a lower rate fall back to the minimum number of positions.
+     */
+    static constexpr auto WindowDuration = std::chrono::milliseconds{120};
+
+    /**
+     * The distance in meter in which all positions of the window must be to the gate.
+     */
+    static constexpr auto GateRange = 50.0f;
+
     /**
      * Default constructor
      */
@@ -65,20 +93,42 @@ public:
     Common::Timestamp getLastSectorTime() const override;
 
 private:
+    struct WindowPoint
+    {
+        Common::LocalPoint point;
+        Common::Timestamp time;
+    };
+
+    /**
+     * Adds a position to the window and removes the positions that are no longer needed to cover the window
+     * duration.
+     * @param point The position projected into the local plane of the track.
+     * @param time The time of the position.
+     * @return True if the window covers the window duration, False otherwise.
+     */
+    bool updateWindow(Common::LocalPoint const& point, Common::Timestamp const& time);
+
+    /**
+     * Gives the time between the latest position and the position at the index.
+     */
+    std::chrono::milliseconds getWindowSpan(std::size_t index) const noexcept;
+
     /**
-     * Checks if the last 4 positions stored in mCurrentPoints passed the point specified.
-     * @param point The point the shall be checked against the last 4 known positions.
-     * @return True if the point specified was passed, False otherwise.
+     * Checks if the positions stored in mCurrentPoints passed the gate specified. The gate is passed when the
+     * oldest positions approach the gate, the latest positions move away from the gate and the closest position is
+     * between them.
+     * @param gate The gate the shall be checked against the known positions.
+     * @return True if the gate specified was passed, False otherwise.
      */
-    bool passedPoint(Common::PositionData const& point) const;
+    bool passedPoint(Common::Gate const& gate) const;
 
 private:
     Common::TrackData mTrackData;
     size_t mCurrentTrackPoint{0};
 
-    /* This double ended que contains the last 4 track points. The point at position 0 is the latest one
-    and the point at position 3 is the oldest respectively. */
-    std::deque<Common::PositionData> mCurrentPoints;
+    /* This double ended que contains the track points of the window projected into the local plane of the track.
+    The point at position 0 is the latest one and the point at the back is the oldest respectively. */
+    std::deque<WindowPoint> mCurrentPoints;
 
     enum LapState
     {
@@ -3,8 +3,6 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "TrackDetection.hpp"
-#include "DistanceCalculator.hpp"
-#include <cmath>
 
 using namespace Rapid::Common;
 
@@ -18,8 +16,19 @@ TrackDetection::TrackDetection(std::uint16_t detectRadiusInMeter)
 
 bool TrackDetection::isOnTrack(TrackData const& track, PositionData const& position) const
 {
-    auto distance = static_cast<std::uint16_t>(DistanceCalculator::calculateDistance(track.getFinishline(), position));
+    auto const& geometry = track.getGeometry();
+    auto const point = geometry.getProjection().project(position);
+    // The finish line is inside the bounding box, positions outside of the enlarged box can't be in the radius.
+    if (!geometry.getBoundingBox().contains(point, static_cast<float>(mDetectionRadius))) {
+        return false;
+    }
+    auto distance = static_cast<std::uint16_t>(geometry.getFinishGate().distanceTo(point));
     return distance <= mDetectionRadius;
 }
 
+float TrackDetection::getDetectionRadius() const
+{
+    return static_cast<float>(mDetectionRadius);
+}
+
 } // namespace Rapid::Algorithm
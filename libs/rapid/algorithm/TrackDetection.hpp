@@ -24,6 +24,11 @@ public:
      */
     bool isOnTrack(Common::TrackData const& track, Common::PositionData const& position) const override;
 
+    /**
+     * @copydoc ITrackDetection::getDetectionRadius()
+     */
+    float getDetectionRadius() const override;
+
 private:
     std::uint16_t mDetectionRadius;
 };
@@ -0,0 +1,271 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "TrackGenerator.hpp"
+#include "DistanceCalculator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+using namespace Rapid::Common;
+
+namespace Rapid::Algorithm
+{
+
+namespace
+{
+
+/**
+ * The minimum cosine of the angle between the directions of travel of two passes of the same place.
+ */
+constexpr auto MinimumHeadingCosine = 0.7f;
+
+struct Sample
+{
+    LocalPoint point;
+    float distance{0.0f};
+};
+
+/**
+ * The spatial hash of the samples. The samples are sorted by the key of their cell, the samples of a cell are
+ * found with a binary search.
+ */
+class SampleGrid
+{
+public:
+    explicit SampleGrid(std::span<Sample const> samples)
+    {
+        mEntries.reserve(samples.size());
+        for (std::size_t index = 0; index < samples.size(); ++index) {
+            mEntries.push_back(Entry{.key = getKey(getCell(samples[index].point.x), getCell(samples[index].point.y)),
+                                     .sample = static_cast<std::uint32_t>(index)});
+        }
+        std::ranges::sort(mEntries, {}, &Entry::key);
+    }
+
+    template <typename Visitor>
+    void visitNeighbours(LocalPoint const& point, Visitor&& visitor) const
+    {
+        auto const cellX = getCell(point.x);
+        auto const cellY = getCell(point.y);
+        for (auto x = cellX - 1; x <= cellX + 1; ++x) {
+            for (auto y = cellY - 1; y <= cellY + 1; ++y) {
+                auto const range = std::ranges::equal_range(mEntries, getKey(x, y), {}, &Entry::key);
+                for (auto const& entry : range) {
+                    visitor(entry.sample);
+                }
+            }
+        }
+    }
+
+private:
+    struct Entry
+    {
+        std::uint64_t key{0};
+        std::uint32_t sample{0};
+    };
+
+    static std::int32_t getCell(float coordinate) noexcept
+    {
+        return static_cast<std::int32_t>(std::floor(coordinate / TrackGenerator::ClosingDistance));
+    }
+
+    static std::uint64_t getKey(std::int32_t x, std::int32_t y) noexcept
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32U) | static_cast<std::uint32_t>(y);
+    }
+
+    std::vector<Entry> mEntries;
+};
+
+std::optional<LocalPoint> normalize(LocalPoint const& vector) noexcept
+{
+    auto const vectorLength = length(vector);
+    if (vectorLength <= std::numeric_limits<float>::epsilon()) {
+        return std::nullopt;
+    }
+    return vector * (1.0f / vectorLength);
+}
+
+LocalPoint getDirection(std::span<Sample const> samples, std::size_t index) noexcept
+{
+    auto const previous = index > 0 ? index - 1 : index;
+    auto const next = std::min(index + 1, samples.size() - 1);
+    return normalize(samples[next].point - samples[previous].point).value_or(LocalPoint{});
+}
+
+/**
+ * Finds the first closed lap of the samples.
+ * @return The samples of the lap, the first and the last sample are close to each other. The span is empty when
+ *         the samples contain no lap.
+ */
+std::span<Sample const> findLap(std::span<Sample const> samples)
+{
+    auto const grid = SampleGrid{samples};
+    auto const isSamePlace = [&](std::size_t earlier, std::size_t later, float minimumDistance) {
+        return (samples[later].distance - samples[earlier].distance >= minimumDistance) &&
+               (length(samples[later].point - samples[earlier].point) <= TrackGenerator::ClosingDistance) &&
+               (dot(getDirection(samples, earlier), getDirection(samples, later)) >= MinimumHeadingCosine);
+    };
+
+    for (std::size_t end = 0; end < samples.size(); ++end) {
+        auto begin = std::optional<std::size_t>{};
+        auto closestDistance = std::numeric_limits<float>::max();
+        grid.visitNeighbours(samples[end].point, [&](std::uint32_t candidate) {
+            auto const distance = length(samples[end].point - samples[candidate].point);
+            if ((candidate < end) && isSamePlace(candidate, end, TrackGenerator::MinimumLapLength) &&
+                (distance < closestDistance)) {
+                closestDistance = distance;
+                begin = candidate;
+            }
+        });
+        if (!begin.has_value()) {
+            continue;
+        }
+
+        // A short loop that is driven a few times returns after the minimum lap length too, but it passes the
+        // begin of the loop in between.
+        auto passedInBetween = false;
+        grid.visitNeighbours(samples[*begin].point, [&](std::uint32_t between) {
+            passedInBetween = passedInBetween ||
+                              ((between > *begin) && (between < end) &&
+                               isSamePlace(*begin, between, 2.0f * TrackGenerator::ClosingDistance));
+        });
+        if (passedInBetween) {
+            continue;
+        }
+
+        // The first close sample is still in front of the earlier pass, the lap ends at the closest sample.
+        auto const closing = [&](std::size_t sample) {
+            return length(samples[sample].point - samples[*begin].point);
+        };
+        while ((end + 1 < samples.size()) && (closing(end + 1) < closing(end))) {
+            ++end;
+        }
+        return samples.subspan(*begin, end - *begin + 1);
+    }
+    return {};
+}
+
+/**
+ * A point on the lap between the samples.
+ */
+struct LapPoint
+{
+    LocalPoint point;
+    LocalPoint direction;
+};
+
+/**
+ * Gives the point at a distance along the closed lap, interpolated between the samples.
+ */
+LapPoint getLapPoint(std::span<Sample const> lap, float lapLength, float offset) noexcept
+{
+    auto const distance = lap.front().distance + std::fmod(offset, lapLength);
+    auto const next = std::ranges::lower_bound(lap, distance, {}, &Sample::distance);
+    if (next == lap.begin()) {
+        return LapPoint{.point = lap.front().point,
+                        .direction = normalize(lap[1].point - lap.front().point).value_or(LocalPoint{})};
+    }
+
+    // Behind the last sample the lap is closed by the gap to the first sample.
+    auto const& from = *std::prev(next);
+    auto const& to = next != lap.end() ? *next : lap.front();
+    auto const segmentLength = next != lap.end() ? to.distance - from.distance : length(to.point - from.point);
+    auto const fraction = segmentLength > 0.0f ? (distance - from.distance) / segmentLength : 0.0f;
+    return LapPoint{.point = from.point + ((to.point - from.point) * std::min(fraction, 1.0f)),
+                    .direction = normalize(to.point - from.point).value_or(LocalPoint{})};
+}
+
+/**
+ * Places the gates evenly spaced on the lap, the first gate is the finish line at the begin of the lap.
+ * @return The points of the gates with the direction of travel of the lap.
+ */
+std::vector<LapPoint> placeGates(std::span<Sample const> lap, float lapLength, std::size_t gateCount)
+{
+    auto const spacing = lapLength / static_cast<float>(gateCount);
+    auto gates = std::vector<LapPoint>{};
+    gates.reserve(gateCount);
+    for (std::size_t gate = 0; gate < gateCount; ++gate) {
+        gates.push_back(getLapPoint(lap, lapLength, static_cast<float>(gate) * spacing));
+    }
+    return gates;
+}
+
+} // namespace
+
+TrackGenerator::TrackGenerator(std::size_t sectionCount) noexcept
+    : mSectionCount{sectionCount}
+{
+}
+
+std::optional<GeneratedTrack> TrackGenerator::generate(std::span<float const> latitudes,
+                                                       std::span<float const> longitudes) const
+{
+    auto const count = std::min(latitudes.size(), longitudes.size());
+    if (count < 2) {
+        return std::nullopt;
+    }
+
+    // Downsample the recording by the distance along the recording. The distances of the samples are measured
+    // between the samples, so the noise of the positions doesn't lengthen the lap.
+    auto distances = std::vector<float>(count);
+    DistanceCalculator::calculateCumulativeDistances(latitudes.first(count), longitudes.first(count), distances);
+    auto const projection = LocalProjection{PositionData{latitudes[0], longitudes[0]}};
+    auto samples = std::vector<Sample>{};
+    samples.reserve(static_cast<std::size_t>(distances.back() / SampleSpacing) + 2);
+    auto lastSampleDistance = 0.0f;
+    for (std::size_t index = 0; index < count; ++index) {
+        if (!samples.empty() && (distances[index] - lastSampleDistance < SampleSpacing)) {
+            continue;
+        }
+        auto const point = projection.project(PositionData{latitudes[index], longitudes[index]});
+        auto const distance = samples.empty() ? 0.0f : samples.back().distance + length(point - samples.back().point);
+        samples.push_back(Sample{.point = point, .distance = distance});
+        lastSampleDistance = distances[index];
+    }
+
+    auto const lap = findLap(samples);
+    if (lap.empty()) {
+        return std::nullopt;
+    }
+
+    // The lap is closed, the gap between the last and the first sample belongs to the lap.
+    auto const lapLength = lap.back().distance - lap.front().distance + length(lap.back().point - lap.front().point);
+    auto const gates = placeGates(lap, lapLength, mSectionCount + 1);
+    auto sections = std::vector<PositionData>{};
+    sections.reserve(mSectionCount);
+    for (std::size_t gate = 1; gate < gates.size(); ++gate) {
+        sections.push_back(projection.unproject(gates[gate].point));
+    }
+
+    auto result = GeneratedTrack{};
+    result.track.setFinishline(projection.unproject(gates.front().point));
+    result.track.setSections(std::move(sections));
+    result.track.setTopology(TrackTopology::Circuit);
+    result.finishGate = result.track.getGeometry().getFinishGate();
+    result.finishGate.setDirection(gates.front().direction);
+    result.lapLength = lapLength;
+    return result;
+}
+
+std::optional<GeneratedTrack> TrackGenerator::generate(LapTelemetryView const& telemetry) const
+{
+    return generate(telemetry.getLatitudes(), telemetry.getLongitudes());
+}
+
+std::optional<GeneratedTrack> TrackGenerator::generate(SessionData const& session) const
+{
+    auto latitudes = std::vector<float>{};
+    auto longitudes = std::vector<float>{};
+    for (auto const& lap : session.getLaps()) {
+        auto const& telemetry = lap.getTelemetry();
+        latitudes.insert(latitudes.end(), telemetry.getLatitudes().begin(), telemetry.getLatitudes().end());
+        longitudes.insert(longitudes.end(), telemetry.getLongitudes().begin(), telemetry.getLongitudes().end());
+    }
+    return generate(latitudes, longitudes);
+}
+
+} // namespace Rapid::Algorithm
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_TRACKGENERATOR_HPP
+#define RAPID_ALGORITHM_TRACKGENERATOR_HPP
+
+#include <common/LapTelemetry.hpp>
+#include <common/SessionData.hpp>
+#include <common/TrackData.hpp>
+#include <optional>
+#include <span>
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * A track generated from a recording.
+ */
+struct GeneratedTrack
+{
+    /**
+     * The track with the finish line and the evenly spaced sections of the lap.
+     */
+    Common::TrackData track;
+
+    /**
+     * The finish gate of the generated track, in the projection of the track geometry. The direction of the gate is
+     * the heading of the lap at the finish line.
+     */
+    Common::Gate finishGate;
+
+    /**
+     * The length of the lap in meter.
+     */
+    float lapLength{0.0f};
+};
+
+/**
+ * Creates a circuit from a recording, e.g. an outlap followed by a few laps, instead of entering the positions
+ * of the finish line and the sections by hand.
+ * The recording is downsampled to a sample every few meter and the samples are stored in a spatial hash.
+ * The lap is closed at the first sample that returns close to an earlier sample in the same direction of
+ * travel after at least the minimum lap length. The finish line and the sections are spaced evenly by distance
+ * along the lap from the closing sample. The work is linear in the number of positions plus the number of samples
+ * of one lap.
+ */
+class TrackGenerator final
+{
+public:
+    /**
+     * The default number of sections of a generated track.
+     */
+    static constexpr std::size_t DefaultSectionCount = 2;
+
+    /**
+     * The distance between two samples of the recording in meter.
+     */
+    static constexpr auto SampleSpacing = 5.0f;
+
+    /**
+     * The maximum distance in meter between two passes of the same place of the track.
+     */
+    static constexpr auto ClosingDistance = 15.0f;
+
+    /**
+     * The minimum length of a lap in meter, shorter loops, e.g. in the paddock, aren't a lap.
+     */
+    static constexpr auto MinimumLapLength = 250.0f;
+
+    /**
+     * Creates a track generator.
+     * @param sectionCount The number of sections of a generated track.
+     */
+    explicit TrackGenerator(std::size_t sectionCount = DefaultSectionCount) noexcept;
+
+    /**
+     * Generates a track from a recording.
+     * @param latitudes The latitudes of the recorded positions in the order of the recording.
+     * @param longitudes The longitudes of the recorded positions, same size as the latitudes.
+     * @return The generated track or std::nullopt when the recording doesn't contain a closed lap.
+     */
+    [[nodiscard]] std::optional<GeneratedTrack> generate(std::span<float const> latitudes,
+                                                         std::span<float const> longitudes) const;
+
+    /**
+     * Generates a track from recorded log points.
+     * @param telemetry The log points in the order they were recorded.
+     * @return The generated track or std::nullopt when the recording doesn't contain a closed lap.
+     */
+    [[nodiscard]] std::optional<GeneratedTrack> generate(Common::LapTelemetryView const& telemetry) const;
+
+    /**
+     * Generates a track from the log points of all laps of a session as one contiguous recording.
+     * @param session The recorded session.
+     * @return The generated track or std::nullopt when the recording doesn't contain a closed lap.
+     */
+    [[nodiscard]] std::optional<GeneratedTrack> generate(Common::SessionData const& session) const;
+
+private:
+    std::size_t mSectionCount;
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_TRACKGENERATOR_HPP
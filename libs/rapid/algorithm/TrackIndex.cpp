@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "TrackIndex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace Rapid::Common;
+
+namespace Rapid::Algorithm
+{
+
+namespace
+{
+
+constexpr auto Rows = static_cast<std::int32_t>(180.0 / TrackIndex::CellSizeInDegree);
+constexpr auto Columns = static_cast<std::int32_t>(360.0 / TrackIndex::CellSizeInDegree);
+
+std::int32_t getRow(double latitude) noexcept
+{
+    return std::clamp(static_cast<std::int32_t>(std::floor((latitude + 90.0) / TrackIndex::CellSizeInDegree)),
+                      0,
+                      Rows - 1);
+}
+
+std::int32_t getColumn(double longitude) noexcept
+{
+    return std::clamp(static_cast<std::int32_t>(std::floor((longitude + 180.0) / TrackIndex::CellSizeInDegree)),
+                      0,
+                      Columns - 1);
+}
+
+std::uint32_t getCell(std::int32_t row, std::int32_t column) noexcept
+{
+    return (static_cast<std::uint32_t>(row) * static_cast<std::uint32_t>(Columns)) +
+           static_cast<std::uint32_t>(column);
+}
+
+} // namespace
+
+TrackIndex::TrackIndex()
+    : mOffsets{0}
+{
+}
+
+TrackIndex::TrackIndex(std::span<TrackData const> tracks, float searchRadiusInMeter)
+{
+    auto entries = std::vector<std::pair<std::uint32_t, std::uint32_t>>{};
+    for (std::size_t index = 0; index < tracks.size(); ++index) {
+        auto const& geometry = tracks[index].getGeometry();
+        auto const& box = geometry.getBoundingBox();
+        auto const margin = LocalPoint{.x = searchRadiusInMeter, .y = searchRadiusInMeter};
+        auto const southWest = geometry.getProjection().unproject(box.min - margin);
+        auto const northEast = geometry.getProjection().unproject(box.max + margin);
+        for (auto row = getRow(southWest.getLatitude()); row <= getRow(northEast.getLatitude()); ++row) {
+            for (auto column = getColumn(southWest.getLongitude()); column <= getColumn(northEast.getLongitude());
+                 ++column) {
+                entries.emplace_back(getCell(row, column), static_cast<std::uint32_t>(index));
+            }
+        }
+    }
+    // Sorted by cell and then by track, so the candidates of a cell keep the order of the tracks.
+    std::ranges::sort(entries);
+
+    mTracks.reserve(entries.size());
+    for (auto const& [cell, track] : entries) {
+        if (mCells.empty() || mCells.back() != cell) {
+            mCells.push_back(cell);
+            mOffsets.push_back(static_cast<std::uint32_t>(mTracks.size()));
+        }
+        mTracks.push_back(track);
+    }
+    mOffsets.push_back(static_cast<std::uint32_t>(mTracks.size()));
+}
+
+std::span<std::uint32_t const> TrackIndex::getCandidates(PositionData const& position) const noexcept
+{
+    auto const cell = getCell(getRow(position.getLatitude()), getColumn(position.getLongitude()));
+    auto const found = std::ranges::lower_bound(mCells, cell);
+    if (found == mCells.end() || *found != cell) {
+        return {};
+    }
+    auto const index = static_cast<std::size_t>(found - mCells.begin());
+    return std::span<std::uint32_t const>{mTracks}.subspan(mOffsets[index], mOffsets[index + 1] - mOffsets[index]);
+}
+
+} // namespace Rapid::Algorithm
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_ALGORITHM_TRACKINDEX_HPP
+#define RAPID_ALGORITHM_TRACKINDEX_HPP
+
+#include <common/PositionData.hpp>
+#include <common/TrackData.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Rapid::Algorithm
+{
+
+/**
+ * A static spatial index that gives the tracks near a position.
+ * The earth is divided into a grid of cells of @ref TrackIndex::CellSizeInDegree. Every track is registered in
+ * all cells that are covered by its bounding box, enlarged by the search radius. A query is only a division
+ * per axis and a binary search over the occupied cells, there is no trigonometry and no allocation.
+ * The index is built once and must be rebuilt when the tracks change.
+ */
+class TrackIndex final
+{
+public:
+    /**
+     * The edge length of a grid cell in degree, about 11 km in north south direction.
+     */
+    static constexpr auto CellSizeInDegree = 0.1;
+
+    /**
+     * Creates an empty index.
+     */
+    TrackIndex();
+
+    /**
+     * Creates the index for the tracks.
+     * @param tracks The tracks of the index, the candidates are indices into this list.
+     * @param searchRadiusInMeter The distance around the bounding box of a track in which it's a candidate.
+     */
+    TrackIndex(std::span<Common::TrackData const> tracks, float searchRadiusInMeter);
+
+    /**
+     * Gives the tracks whose enlarged bounding box may contain the position.
+     * The candidates can contain tracks that are further away, but never miss a track that is within the search
+     * radius. The candidates are in the order of the tracks the index was created with.
+     * @param position The position to look up.
+     * @return The indices of the candidate tracks, the span is valid as long as the index is alive.
+     */
+    [[nodiscard]] std::span<std::uint32_t const> getCandidates(Common::PositionData const& position) const noexcept;
+
+private:
+    std::vector<std::uint32_t> mCells;
+    std::vector<std::uint32_t> mOffsets;
+    std::vector<std::uint32_t> mTracks;
+};
+
+} // namespace Rapid::Algorithm
+
+#endif // !RAPID_ALGORITHM_TRACKINDEX_HPP
@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "BinarySerializer.hpp"
+#include "BinarySessionFormat.hpp"
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <spdlog/spdlog.h>
+
+namespace Rapid::Common::BinarySerializer
+{
+
+namespace
+{
+
+using namespace BinarySessionFormat;
+
+class ByteWriter
+{
+public:
+    template <typename T>
+    void write(T value)
+    {
+        auto const offset = mBytes.size();
+        mBytes.resize(offset + sizeof(T));
+        patch(offset, value);
+    }
+
+    template <typename T>
+    void write(std::span<T const> values)
+    {
+        auto const offset = mBytes.size();
+        mBytes.resize(offset + values.size_bytes());
+        if constexpr ((sizeof(T) == 1) || (std::endian::native == std::endian::little)) {
+            // The memory layout is already the little endian encoding.
+            if (!values.empty()) {
+                std::memcpy(mBytes.data() + offset, values.data(), values.size_bytes());
+            }
+        } else {
+            for (std::size_t index = 0; index < values.size(); ++index) {
+                patch(offset + (index * sizeof(T)), values[index]);
+            }
+        }
+    }
+
+    template <typename T>
+    void patch(std::size_t offset, T value) noexcept
+    {
+        storeLittleEndian(std::span<std::byte, sizeof(T)>{mBytes.data() + offset, sizeof(T)}, value);
+    }
+
+    void writeVarint(std::uint64_t value)
+    {
+        while (value >= 0x80U) {
+            mBytes.push_back(static_cast<std::byte>((value & 0x7FU) | 0x80U));
+            value >>= 7U;
+        }
+        mBytes.push_back(static_cast<std::byte>(value));
+    }
+
+    void pad()
+    {
+        mBytes.resize(align(mBytes.size()));
+    }
+
+    std::size_t size() const noexcept
+    {
+        return mBytes.size();
+    }
+
+    std::vector<std::byte>& bytes() noexcept
+    {
+        return mBytes;
+    }
+
+private:
+    std::vector<std::byte> mBytes;
+};
+
+void writeColumnHeader(ByteWriter& writer,
+                       ColumnType type,
+                       ColumnEncoding encoding,
+                       std::string_view name,
+                       std::uint64_t dataSize)
+{
+    writer.write(static_cast<std::uint16_t>(type));
+    writer.write(static_cast<std::uint16_t>(encoding));
+    writer.write(static_cast<std::uint32_t>(name.size()));
+    writer.write(dataSize);
+    writer.write(std::span<char const>{name});
+    writer.pad();
+}
+
+template <typename T>
+void writeRawColumn(ByteWriter& writer, ColumnType type, std::string_view name, std::span<T const> values)
+{
+    writeColumnHeader(writer, type, ColumnEncoding::Raw, name, values.size_bytes());
+    writer.write(values);
+    writer.pad();
+}
+
+void writeTimeColumn(ByteWriter& writer, std::span<Timestamp const> times)
+{
+    auto data = ByteWriter{};
+    auto previous = std::int64_t{0};
+    for (auto const& time : times) {
+        auto const delta = time.toMilliseconds() - previous;
+        previous = time.toMilliseconds();
+        data.writeVarint((static_cast<std::uint64_t>(delta) << 1U) ^ static_cast<std::uint64_t>(delta >> 63));
+    }
+
+    writeColumnHeader(writer, ColumnType::Time, ColumnEncoding::DeltaVarint, {}, data.size());
+    writer.write(std::span<std::byte const>{data.bytes()});
+    writer.pad();
+}
+
+void writeDateColumn(ByteWriter& writer, std::span<Date const> dates)
+{
+    auto data = ByteWriter{};
+    auto index = std::size_t{0};
+    while (index < dates.size()) {
+        auto const& date = dates[index];
+        auto count = std::uint32_t{0};
+        while ((index < dates.size()) && (dates[index] == date)) {
+            ++count;
+            ++index;
+        }
+        data.write(date.getYear());
+        data.write(date.getMonth());
+        data.write(date.getDay());
+        data.write(count);
+    }
+
+    writeColumnHeader(writer, ColumnType::Date, ColumnEncoding::RunLength, {}, data.size());
+    writer.write(std::span<std::byte const>{data.bytes()});
+    writer.pad();
+}
+
+void writeLap(ByteWriter& writer, LapData const& lap)
+{
+    auto const& telemetry = lap.getTelemetry();
+    auto const channelNames = telemetry.getChannelNames();
+    auto const& sectorTimes = lap.getSectorTimes();
+
+    writer.write(static_cast<std::uint32_t>(sectorTimes.size()));
+    writer.write(static_cast<std::uint32_t>(telemetry.size()));
+    writer.write(static_cast<std::uint32_t>(5 + channelNames.size()));
+    writer.write(std::uint32_t{0});
+    for (auto const& sectorTime : sectorTimes) {
+        writer.write(sectorTime.toMilliseconds());
+    }
+
+    writeRawColumn(writer, ColumnType::Latitude, {}, telemetry.getLatitudes());
+    writeRawColumn(writer, ColumnType::Longitude, {}, telemetry.getLongitudes());
+    writeRawColumn(writer, ColumnType::Velocity, {}, telemetry.getVelocities());
+    writeTimeColumn(writer, telemetry.getTimes());
+    writeDateColumn(writer, telemetry.getDates());
+    for (auto const& name : channelNames) {
+        writeRawColumn(writer, ColumnType::Channel, name, telemetry.getChannel(name));
+    }
+}
+
+void writePosition(ByteWriter& writer, PositionData const& position)
+{
+    writer.write(position.getLatitude());
+    writer.write(position.getLongitude());
+}
+
+} // namespace
+
+namespace Session
+{
+
+std::vector<std::byte> serialize(SessionData const& session)
+{
+    auto writer = ByteWriter{};
+    auto const& laps = session.getLaps();
+
+    // Header, the file size, the lap index offset and the checksum are patched at the end.
+    writer.write(std::span<char const>{Magic});
+    writer.write(Version);
+    writer.write(static_cast<std::uint16_t>(HeaderSize));
+    writer.write(static_cast<std::uint32_t>(laps.size()));
+    writer.write(std::uint32_t{0});
+    writer.write(std::uint64_t{0});
+    writer.write(std::uint64_t{0});
+
+    auto const date = session.getSessionDate();
+    writer.write(static_cast<std::uint64_t>(session.getId()));
+    writer.write(session.getSessionTime().toMilliseconds());
+    writer.write(date.getYear());
+    writer.write(date.getMonth());
+    writer.write(date.getDay());
+    writer.write(std::uint32_t{0});
+
+    auto const& track = session.getTrack();
+    auto const& trackName = track.getTrackName();
+    writePosition(writer, track.getFinishline());
+    writePosition(writer, track.getStartline());
+    auto const& pitLaneLine = track.getPitLaneLine();
+    writePosition(writer, pitLaneLine.value_or(PositionData{}));
+    writer.write(static_cast<std::uint16_t>(track.getTopology()));
+    writer.write(pitLaneLine.has_value() ? TrackHasPitLaneLine : std::uint16_t{0});
+    writer.write(static_cast<std::uint32_t>(track.getSections().size()));
+    writer.write(static_cast<std::uint32_t>(trackName.size()));
+    for (auto const& section : track.getSections()) {
+        writePosition(writer, section);
+    }
+    writer.write(std::span<char const>{trackName});
+    writer.pad();
+
+    auto const lapIndexOffset = writer.size();
+    for (std::size_t index = 0; index < laps.size(); ++index) {
+        writer.write(std::uint64_t{0});
+        writer.write(std::uint64_t{0});
+    }
+
+    for (std::size_t index = 0; index < laps.size(); ++index) {
+        auto const lapOffset = writer.size();
+        writeLap(writer, laps[index]);
+        writer.pad();
+        writer.patch(lapIndexOffset + (index * LapIndexEntrySize), static_cast<std::uint64_t>(lapOffset));
+        writer.patch(lapIndexOffset + (index * LapIndexEntrySize) + sizeof(std::uint64_t),
+                     static_cast<std::uint64_t>(writer.size() - lapOffset));
+    }
+
+    auto& bytes = writer.bytes();
+    writer.patch(16, static_cast<std::uint64_t>(bytes.size()));
+    writer.patch(24, static_cast<std::uint64_t>(lapIndexOffset));
+    // The checksum field is still zero, so the checksum covers the whole file.
+    writer.patch(ChecksumOffset, crc32(bytes));
+    return std::move(bytes);
+}
+
+bool serialize(SessionData const& session, std::filesystem::path const& file) noexcept
+{
+    try {
+        auto const bytes = serialize(session);
+        auto stream = std::ofstream{file, std::ios::binary | std::ios::trunc};
+        stream.write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!stream) {
+            SPDLOG_ERROR("Failed to write binary session file {}", file.string());
+            return false;
+        }
+        return true;
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to serialize session into {}. Error: {}", file.string(), e.what());
+        return false;
+    }
+}
+
+} // namespace Session
+
+} // namespace Rapid::Common::BinarySerializer
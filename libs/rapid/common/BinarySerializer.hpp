@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_BINARYSERIALIZER_HPP
+#define RAPID_COMMON_BINARYSERIALIZER_HPP
+
+#include "SessionData.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+namespace Rapid::Common::BinarySerializer
+{
+
+namespace Session
+{
+
+/**
+ * @brief Serialize the passed session into the binary session container.
+ * The layout of the container is described in @ref BinarySessionFormat.hpp.
+ * @return The bytes of the container.
+ */
+std::vector<std::byte> serialize(SessionData const& session);
+
+/**
+ * @brief Serialize the passed session into a binary session file.
+ * @param session The session that shall be written.
+ * @param file The path of the file, an existing file is overwritten.
+ * @return true The session is written.
+ * @return false The file couldn't be written.
+ */
+bool serialize(SessionData const& session, std::filesystem::path const& file) noexcept;
+
+} // namespace Session
+
+} // namespace Rapid::Common::BinarySerializer
+
+#endif // !RAPID_COMMON_BINARYSERIALIZER_HPP
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "BinarySessionFormat.hpp"
+
+namespace Rapid::Common::BinarySessionFormat
+{
+
+namespace
+{
+
+constexpr auto Crc32Table = [] {
+    constexpr auto Polynomial = std::uint32_t{0xEDB88320};
+    auto table = std::array<std::uint32_t, 256>{};
+    for (std::uint32_t index = 0; index < table.size(); ++index) {
+        auto value = index;
+        for (auto bit = 0; bit < 8; ++bit) {
+            value = (value & 1U) != 0 ? (value >> 1U) ^ Polynomial : value >> 1U;
+        }
+        table[index] = value;
+    }
+    return table;
+}();
+
+} // namespace
+
+std::uint32_t crc32(std::span<std::byte const> data, std::uint32_t crc) noexcept
+{
+    crc ^= 0xFFFFFFFF;
+    for (auto const byte : data) {
+        crc = Crc32Table[(crc ^ static_cast<std::uint32_t>(byte)) & 0xFFU] ^ (crc >> 8U);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+} // namespace Rapid::Common::BinarySessionFormat
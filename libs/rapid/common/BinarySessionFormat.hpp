@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_BINARYSESSIONFORMAT_HPP
+#define RAPID_COMMON_BINARYSESSIONFORMAT_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+/**
+ * The binary session container.
+ * All values are little endian and all blocks start at an offset that is a multiple of 8, so raw
+ * columns can be used in place from a memory mapped file on little endian hosts.
+ *
+ * | Block        | Content                                                                          |
+ * |--------------|----------------------------------------------------------------------------------|
+ * | Header       | magic, version, header size, lap count, CRC-32, file size, lap index offset      |
+ * | Session      | id (u64), time in ms (i64), year (u16), month (u8), day (u8), reserved (u32)     |
+ * | Track        | finish, start and pit lane line (6 x f32), topology (u16), flags (u16),          |
+ * |              | section count (u32), name length (u32), sections (2 x f32 each), name            |
+ * | Lap index    | offset (u64) and size (u64) of every lap block                                   |
+ * | Lap blocks   | sector count, log point count, column count (u32 each), reserved (u32),          |
+ * |              | sector times in ms (i64 each), columns                                           |
+ *
+ * A column starts with its type (u16), encoding (u16), name length (u32) and data size (u64),
+ * followed by the name and the data. Readers skip column types they don't know, so new channels
+ * can be added without a new version. The CRC-32 covers the whole file with the checksum field set to zero.
+ */
+namespace Rapid::Common::BinarySessionFormat
+{
+
+/**
+ * The magic bytes at the begin of the container.
+ */
+constexpr auto Magic = std::array<char, 4>{'R', 'P', 'S', 'N'};
+
+/**
+ * The version written by the serializer.
+ */
+constexpr auto Version = std::uint16_t{3};
+
+/**
+ * The alignment of all blocks and column data.
+ */
+constexpr auto Alignment = std::size_t{8};
+
+/**
+ * The size of the header in byte.
+ */
+constexpr auto HeaderSize = std::size_t{32};
+
+/**
+ * The offset of the CRC-32 in the header.
+ */
+constexpr auto ChecksumOffset = std::size_t{12};
+
+/**
+ * The size of the session block in byte.
+ */
+constexpr auto SessionBlockSize = std::size_t{24};
+
+/**
+ * The size of the fixed part of the track block in byte.
+ */
+constexpr auto TrackBlockSize = std::size_t{36};
+
+/**
+ * The flag of the track block for a track with a pit lane line. The pit lane line is zero without the flag.
+ */
+constexpr auto TrackHasPitLaneLine = std::uint16_t{1};
+
+/**
+ * The size of an entry of the lap index in byte.
+ */
+constexpr auto LapIndexEntrySize = std::size_t{16};
+
+/**
+ * The size of the fixed part of a lap block in byte.
+ */
+constexpr auto LapBlockSize = std::size_t{16};
+
+/**
+ * The size of a column header in byte.
+ */
+constexpr auto ColumnHeaderSize = std::size_t{16};
+
+/**
+ * The content of a column.
+ */
+enum class ColumnType : std::uint16_t
+{
+    Latitude = 1,
+    Longitude = 2,
+    Velocity = 3,
+    Time = 4,
+    Date = 5,
+    Channel = 6,
+};
+
+/**
+ * The encoding of the column data.
+ */
+enum class ColumnEncoding : std::uint16_t
+{
+    /**
+     * The values are stored as array, f32 for positions and channels, f64 for velocities.
+     */
+    Raw = 0,
+
+    /**
+     * The difference to the previous value in ms as zig zag encoded variable length integer.
+     */
+    DeltaVarint = 1,
+
+    /**
+     * Runs of equal dates as year (u16), month (u8), day (u8) and count (u32).
+     */
+    RunLength = 2,
+};
+
+/**
+ * Gives the number of bytes that are needed to align the size.
+ * @param size The unaligned size.
+ * @return The size rounded up to the next multiple of @ref Alignment.
+ */
+constexpr std::size_t align(std::size_t size) noexcept
+{
+    return (size + Alignment - 1) & ~(Alignment - 1);
+}
+
+/**
+ * The unsigned integer with the size of a value, used to encode the value byte by byte.
+ */
+template <typename T>
+using UnsignedOf =
+    std::conditional_t<sizeof(T) == 1,
+                       std::uint8_t,
+                       std::conditional_t<sizeof(T) == 2,
+                                          std::uint16_t,
+                                          std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+/**
+ * Writes a value in little endian byte order.
+ * @param bytes The destination of the value.
+ * @param value The value to write.
+ */
+template <typename T>
+void storeLittleEndian(std::span<std::byte, sizeof(T)> bytes, T value) noexcept
+{
+    static_assert(std::is_arithmetic_v<T> && (sizeof(UnsignedOf<T>) == sizeof(T)));
+    auto const bits = std::bit_cast<UnsignedOf<T>>(value);
+    for (std::size_t index = 0; index < sizeof(T); ++index) {
+        bytes[index] = static_cast<std::byte>((bits >> (8U * index)) & 0xFFU);
+    }
+}
+
+/**
+ * Reads a value in little endian byte order.
+ * @param bytes The bytes of the value.
+ * @return The value.
+ */
+template <typename T>
+T loadLittleEndian(std::span<std::byte const, sizeof(T)> bytes) noexcept
+{
+    static_assert(std::is_arithmetic_v<T> && (sizeof(UnsignedOf<T>) == sizeof(T)));
+    auto bits = UnsignedOf<T>{0};
+    for (std::size_t index = 0; index < sizeof(T); ++index) {
+        bits |= static_cast<UnsignedOf<T>>(static_cast<UnsignedOf<T>>(bytes[index]) << (8U * index));
+    }
+    return std::bit_cast<T>(bits);
+}
+
+/**
+ * Calculates the CRC-32 (IEEE 802.3) of the data.
+ * @param data The data for the checksum.
+ * @param crc The checksum of the preceding data to continue it, 0 for the begin of the data.
+ * @return The checksum.
+ */
+std::uint32_t crc32(std::span<std::byte const> data, std::uint32_t crc = 0) noexcept;
+
+} // namespace Rapid::Common::BinarySessionFormat
+
+#endif // !RAPID_COMMON_BINARYSESSIONFORMAT_HPP
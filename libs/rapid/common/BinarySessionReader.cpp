@@ -0,0 +1,615 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "BinarySessionReader.hpp"
+#include "BinarySessionFormat.hpp"
+#include "SessionArena.hpp"
+#include "TrackRegistry.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fcntl.h>
+#include <spdlog/spdlog.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Rapid::Common
+{
+
+namespace
+{
+
+using namespace BinarySessionFormat;
+
+class ByteReader
+{
+public:
+    ByteReader(std::span<std::byte const> bytes, std::size_t offset = 0) noexcept
+        : mBytes{bytes}
+        , mOffset{offset}
+    {
+    }
+
+    template <typename T>
+    std::optional<T> read() noexcept
+    {
+        if (!hasBytes(sizeof(T))) {
+            return std::nullopt;
+        }
+        auto const value = loadLittleEndian<T>(mBytes.subspan(mOffset).template first<sizeof(T)>());
+        mOffset += sizeof(T);
+        return value;
+    }
+
+    std::optional<std::span<std::byte const>> readBytes(std::size_t size) noexcept
+    {
+        if (!hasBytes(size)) {
+            return std::nullopt;
+        }
+        auto const bytes = mBytes.subspan(mOffset, size);
+        mOffset += size;
+        return bytes;
+    }
+
+    std::optional<std::uint64_t> readVarint() noexcept
+    {
+        auto value = std::uint64_t{0};
+        for (auto shift = 0U; shift < 64U; shift += 7U) {
+            auto const byte = read<std::uint8_t>();
+            if (!byte.has_value()) {
+                return std::nullopt;
+            }
+            value |= static_cast<std::uint64_t>(*byte & 0x7FU) << shift;
+            if ((*byte & 0x80U) == 0) {
+                return value;
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool skip(std::size_t size) noexcept
+    {
+        if (!hasBytes(size)) {
+            return false;
+        }
+        mOffset += size;
+        return true;
+    }
+
+    bool pad() noexcept
+    {
+        return skip(align(mOffset) - mOffset);
+    }
+
+    bool atEnd() const noexcept
+    {
+        return mOffset >= mBytes.size();
+    }
+
+private:
+    bool hasBytes(std::size_t size) const noexcept
+    {
+        return (mOffset <= mBytes.size()) && (size <= mBytes.size() - mOffset);
+    }
+
+    std::span<std::byte const> mBytes;
+    std::size_t mOffset{0};
+};
+
+std::string_view toStringView(std::span<std::byte const> bytes) noexcept
+{
+    return std::string_view{reinterpret_cast<char const*>(bytes.data()), bytes.size()};
+}
+
+std::optional<PositionData> readPosition(ByteReader& reader) noexcept
+{
+    auto const latitude = reader.read<float>();
+    auto const longitude = reader.read<float>();
+    if (!latitude.has_value() || !longitude.has_value()) {
+        return std::nullopt;
+    }
+    return PositionData{*latitude, *longitude};
+}
+
+std::optional<Date> readDate(ByteReader& reader) noexcept
+{
+    auto const year = reader.read<std::uint16_t>();
+    auto const month = reader.read<std::uint8_t>();
+    auto const day = reader.read<std::uint8_t>();
+    if (!year.has_value() || !month.has_value() || !day.has_value()) {
+        return std::nullopt;
+    }
+    auto date = Date{};
+    date.setYear(*year);
+    date.setMonth(*month);
+    date.setDay(*day);
+    return date;
+}
+
+std::optional<TrackData> readTrack(ByteReader& reader)
+{
+    auto const finishline = readPosition(reader);
+    auto const startline = readPosition(reader);
+    auto const pitLaneLine = readPosition(reader);
+    auto const topology = reader.read<std::uint16_t>();
+    auto const flags = reader.read<std::uint16_t>();
+    auto const sectionCount = reader.read<std::uint32_t>();
+    auto const nameLength = reader.read<std::uint32_t>();
+    if (!finishline.has_value() || !startline.has_value() || !pitLaneLine.has_value() || !topology.has_value() ||
+        !flags.has_value() || !sectionCount.has_value() || !nameLength.has_value()) {
+        return std::nullopt;
+    }
+
+    auto sections = std::vector<PositionData>{};
+    for (std::uint32_t index = 0; index < *sectionCount; ++index) {
+        auto const section = readPosition(reader);
+        if (!section.has_value()) {
+            return std::nullopt;
+        }
+        sections.push_back(*section);
+    }
+
+    auto const name = reader.readBytes(*nameLength);
+    if (!name.has_value() || !reader.pad()) {
+        return std::nullopt;
+    }
+
+    auto track = TrackData{};
+    track.setTrackName(std::string{toStringView(*name)});
+    track.setFinishline(*finishline);
+    track.setStartline(*startline);
+    if ((*flags & TrackHasPitLaneLine) != 0) {
+        track.setPitLaneLine(*pitLaneLine);
+    }
+    track.setTopology(static_cast<TrackTopology>(*topology));
+    track.setSections(std::move(sections));
+    return TrackRegistry::instance().intern(track);
+}
+
+template <typename T>
+bool isRawColumnOf(std::span<std::byte const> data, std::size_t logPointCount) noexcept
+{
+    return (data.size() == logPointCount * sizeof(T)) &&
+           (reinterpret_cast<std::uintptr_t>(data.data()) % alignof(T) == 0);
+}
+
+std::size_t getRawValueSize(std::uint16_t type) noexcept
+{
+    switch (static_cast<ColumnType>(type)) {
+    case ColumnType::Latitude:
+    case ColumnType::Longitude:
+    case ColumnType::Channel:
+        return sizeof(float);
+    case ColumnType::Velocity:
+        return sizeof(double);
+    default:
+        break;
+    }
+    return 0;
+}
+
+void toNativeByteOrder(std::span<std::byte> data, std::size_t valueSize) noexcept
+{
+    for (auto value = data.begin(); value != data.end(); value += static_cast<std::ptrdiff_t>(valueSize)) {
+        std::reverse(value, value + static_cast<std::ptrdiff_t>(valueSize));
+    }
+}
+
+bool isValidColumn(std::uint16_t type,
+                   std::uint16_t encoding,
+                   std::span<std::byte const> data,
+                   std::size_t logPointCount) noexcept
+{
+    switch (static_cast<ColumnType>(type)) {
+    case ColumnType::Latitude:
+    case ColumnType::Longitude:
+    case ColumnType::Channel:
+        return (encoding == static_cast<std::uint16_t>(ColumnEncoding::Raw)) &&
+               isRawColumnOf<float>(data, logPointCount);
+    case ColumnType::Velocity:
+        return (encoding == static_cast<std::uint16_t>(ColumnEncoding::Raw)) &&
+               isRawColumnOf<double>(data, logPointCount);
+    case ColumnType::Time:
+        return encoding == static_cast<std::uint16_t>(ColumnEncoding::DeltaVarint);
+    case ColumnType::Date:
+        return encoding == static_cast<std::uint16_t>(ColumnEncoding::RunLength);
+    }
+    // Columns of newer writers are skipped.
+    return true;
+}
+
+} // namespace
+
+BinarySessionReader::BinarySessionReader(std::shared_ptr<void const> owner, std::span<std::byte const> bytes)
+    : mOwner{std::move(owner)}
+    , mBytes{bytes}
+{
+}
+
+std::optional<BinarySessionReader> BinarySessionReader::open(std::filesystem::path const& file) noexcept
+{
+    auto const descriptor = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) {
+        SPDLOG_ERROR("Failed to open binary session file {}", file.string());
+        return std::nullopt;
+    }
+
+    struct stat fileStat = {};
+    if ((::fstat(descriptor, &fileStat) != 0) || (fileStat.st_size <= 0)) {
+        SPDLOG_ERROR("Failed to read the size of the binary session file {}", file.string());
+        ::close(descriptor);
+        return std::nullopt;
+    }
+
+    auto const size = static_cast<std::size_t>(fileStat.st_size);
+    auto* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (address == MAP_FAILED) {
+        SPDLOG_ERROR("Failed to map the binary session file {}", file.string());
+        return std::nullopt;
+    }
+
+    try {
+        auto owner = std::shared_ptr<void const>{address, [size](void const* mapping) {
+                                                     ::munmap(const_cast<void*>(mapping), size);
+                                                 }};
+        return parse(std::move(owner), std::span<std::byte const>{static_cast<std::byte const*>(address), size});
+    } catch (std::exception const& e) {
+        // The shared pointer unmaps the file when its creation fails.
+        SPDLOG_ERROR("Failed to read the binary session file {}. Error: {}", file.string(), e.what());
+        return std::nullopt;
+    }
+}
+
+std::optional<BinarySessionReader> BinarySessionReader::fromBytes(std::span<std::byte const> bytes) noexcept
+{
+    try {
+        // The storage has the alignment of std::uint64_t, so the raw columns can be used in place.
+        auto buffer = std::make_shared<std::uint64_t[]>((bytes.size() / sizeof(std::uint64_t)) + 1);
+        if (!bytes.empty()) {
+            std::memcpy(buffer.get(), bytes.data(), bytes.size());
+        }
+        auto const* alignedData = reinterpret_cast<std::byte const*>(buffer.get());
+        return parse(std::move(buffer), std::span<std::byte const>{alignedData, bytes.size()});
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to read the binary session. Error: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+std::optional<BinarySessionReader> BinarySessionReader::parse(std::shared_ptr<void const> owner,
+                                                              std::span<std::byte const> bytes) noexcept
+{
+    try {
+        auto header = ByteReader{bytes};
+        auto const magic = header.readBytes(Magic.size());
+        auto const version = header.read<std::uint16_t>();
+        auto const headerSize = header.read<std::uint16_t>();
+        auto const lapCount = header.read<std::uint32_t>();
+        auto const checksum = header.read<std::uint32_t>();
+        auto const fileSize = header.read<std::uint64_t>();
+        auto const lapIndexOffset = header.read<std::uint64_t>();
+        if (!lapIndexOffset.has_value() || !std::ranges::equal(*magic, std::as_bytes(std::span{Magic}))) {
+            SPDLOG_ERROR("The data is no binary session");
+            return std::nullopt;
+        }
+        if (version != Version) {
+            SPDLOG_ERROR("The binary session version {} is not supported", version.value_or(0));
+            return std::nullopt;
+        }
+        if ((*headerSize < HeaderSize) || (*fileSize > bytes.size()) || (*headerSize > *fileSize)) {
+            SPDLOG_ERROR("The binary session is truncated");
+            return std::nullopt;
+        }
+
+        bytes = bytes.first(*fileSize);
+        constexpr auto zeroChecksum = std::array<std::byte, sizeof(std::uint32_t)>{};
+        auto crc = crc32(bytes.first(ChecksumOffset));
+        crc = crc32(zeroChecksum, crc);
+        crc = crc32(bytes.subspan(ChecksumOffset + zeroChecksum.size()), crc);
+        if (crc != *checksum) {
+            SPDLOG_ERROR("The checksum of the binary session doesn't match");
+            return std::nullopt;
+        }
+
+        // The raw columns are used in place, big endian hosts convert a copy of them once.
+        auto nativeBytes = std::span<std::byte>{};
+        if constexpr (std::endian::native != std::endian::little) {
+            auto buffer = std::make_shared<std::uint64_t[]>((bytes.size() / sizeof(std::uint64_t)) + 1);
+            std::memcpy(buffer.get(), bytes.data(), bytes.size());
+            nativeBytes = std::span<std::byte>{reinterpret_cast<std::byte*>(buffer.get()), bytes.size()};
+            bytes = nativeBytes;
+            owner = std::move(buffer);
+        }
+
+        auto reader = BinarySessionReader{std::move(owner), bytes};
+        reader.mVersion = *version;
+
+        auto block = ByteReader{bytes, *headerSize};
+        auto const sessionId = block.read<std::uint64_t>();
+        auto const sessionTime = block.read<std::int64_t>();
+        auto const sessionDate = readDate(block);
+        auto const track = (sessionDate.has_value() && block.skip(sizeof(std::uint32_t))) ? readTrack(block)
+                                                                                           : std::nullopt;
+        if (!sessionId.has_value() || !sessionTime.has_value() || !track.has_value()) {
+            SPDLOG_ERROR("Failed to read the meta data of the binary session");
+            return std::nullopt;
+        }
+        reader.mMetaData = SessionMetaData{*track,
+                                           *sessionDate,
+                                           Timestamp::fromMilliseconds(*sessionTime),
+                                           static_cast<std::size_t>(*sessionId)};
+
+        auto index = ByteReader{bytes, *lapIndexOffset};
+        reader.mLaps.reserve(*lapCount);
+        for (std::uint32_t lapIndex = 0; lapIndex < *lapCount; ++lapIndex) {
+            auto const lapOffset = index.read<std::uint64_t>();
+            auto const lapSize = index.read<std::uint64_t>();
+            if (!lapSize.has_value() || (*lapOffset > bytes.size()) || (*lapSize > bytes.size() - *lapOffset)) {
+                SPDLOG_ERROR("The lap index of the binary session is invalid");
+                return std::nullopt;
+            }
+
+            auto lapReader = ByteReader{bytes.subspan(*lapOffset, *lapSize)};
+            auto const sectorCount = lapReader.read<std::uint32_t>();
+            auto const logPointCount = lapReader.read<std::uint32_t>();
+            auto const columnCount = lapReader.read<std::uint32_t>();
+            auto const sectorTimes =
+                lapReader.skip(sizeof(std::uint32_t)) && sectorCount.has_value()
+                    ? lapReader.readBytes(static_cast<std::size_t>(*sectorCount) * sizeof(std::int64_t))
+                    : std::nullopt;
+            if (!logPointCount.has_value() || !columnCount.has_value() || !sectorTimes.has_value()) {
+                SPDLOG_ERROR("Failed to read the lap {} of the binary session", lapIndex);
+                return std::nullopt;
+            }
+
+            auto lap = Lap{.sectorTimes = *sectorTimes, .logPointCount = *logPointCount, .columns = {}};
+            lap.columns.reserve(*columnCount);
+            for (std::uint32_t columnIndex = 0; columnIndex < *columnCount; ++columnIndex) {
+                auto const type = lapReader.read<std::uint16_t>();
+                auto const encoding = lapReader.read<std::uint16_t>();
+                auto const nameLength = lapReader.read<std::uint32_t>();
+                auto const dataSize = lapReader.read<std::uint64_t>();
+                auto const name = dataSize.has_value() ? lapReader.readBytes(*nameLength) : std::nullopt;
+                auto const data = (name.has_value() && lapReader.pad()) ? lapReader.readBytes(*dataSize) : std::nullopt;
+                if (!data.has_value() || !lapReader.pad() || !isValidColumn(*type, *encoding, *data, *logPointCount)) {
+                    SPDLOG_ERROR("Failed to read the column {} of lap {} of the binary session", columnIndex, lapIndex);
+                    return std::nullopt;
+                }
+                if (auto const valueSize = getRawValueSize(*type); !nativeBytes.empty() && (valueSize > 0)) {
+                    toNativeByteOrder(nativeBytes.subspan(static_cast<std::size_t>(data->data() - bytes.data()),
+                                                          data->size()),
+                                      valueSize);
+                }
+                lap.columns.push_back(
+                    Column{.type = *type, .encoding = *encoding, .name = toStringView(*name), .data = *data});
+            }
+            reader.mLaps.push_back(std::move(lap));
+        }
+
+        return reader;
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to read the binary session. Error: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+std::uint16_t BinarySessionReader::getVersion() const noexcept
+{
+    return mVersion;
+}
+
+SessionMetaData const& BinarySessionReader::getMetaData() const noexcept
+{
+    return mMetaData;
+}
+
+std::size_t BinarySessionReader::getNumberOfLaps() const noexcept
+{
+    return mLaps.size();
+}
+
+std::vector<Timestamp> BinarySessionReader::getSectorTimes(std::size_t lapIndex) const
+{
+    if (lapIndex >= mLaps.size()) {
+        return {};
+    }
+
+    auto reader = ByteReader{mLaps[lapIndex].sectorTimes};
+    auto sectorTimes = std::vector<Timestamp>{};
+    while (auto const sectorTime = reader.read<std::int64_t>()) {
+        sectorTimes.push_back(Timestamp::fromMilliseconds(*sectorTime));
+    }
+    return sectorTimes;
+}
+
+std::size_t BinarySessionReader::getNumberOfLogPoints(std::size_t lapIndex) const noexcept
+{
+    return lapIndex < mLaps.size() ? mLaps[lapIndex].logPointCount : 0;
+}
+
+std::span<float const> BinarySessionReader::getLatitudes(std::size_t lapIndex) const noexcept
+{
+    return getRawColumn<float>(lapIndex, static_cast<std::uint16_t>(ColumnType::Latitude));
+}
+
+std::span<float const> BinarySessionReader::getLongitudes(std::size_t lapIndex) const noexcept
+{
+    return getRawColumn<float>(lapIndex, static_cast<std::uint16_t>(ColumnType::Longitude));
+}
+
+std::span<double const> BinarySessionReader::getVelocities(std::size_t lapIndex) const noexcept
+{
+    return getRawColumn<double>(lapIndex, static_cast<std::uint16_t>(ColumnType::Velocity));
+}
+
+std::span<float const> BinarySessionReader::getChannel(std::size_t lapIndex, std::string_view name) const noexcept
+{
+    return getRawColumn<float>(lapIndex, static_cast<std::uint16_t>(ColumnType::Channel), name);
+}
+
+std::vector<std::string> BinarySessionReader::getChannelNames(std::size_t lapIndex) const
+{
+    auto names = std::vector<std::string>{};
+    if (lapIndex >= mLaps.size()) {
+        return names;
+    }
+
+    for (auto const& column : mLaps[lapIndex].columns) {
+        if (column.type == static_cast<std::uint16_t>(ColumnType::Channel)) {
+            names.emplace_back(column.name);
+        }
+    }
+    return names;
+}
+
+std::vector<Timestamp> BinarySessionReader::getTimes(std::size_t lapIndex) const
+{
+    auto const* column = findColumn(lapIndex, static_cast<std::uint16_t>(ColumnType::Time));
+    if (column == nullptr) {
+        return {};
+    }
+
+    auto reader = ByteReader{column->data};
+    auto times = std::vector<Timestamp>{};
+    times.reserve(mLaps[lapIndex].logPointCount);
+    auto previous = std::int64_t{0};
+    while (!reader.atEnd()) {
+        auto const encoded = reader.readVarint();
+        if (!encoded.has_value()) {
+            SPDLOG_ERROR("The time column of lap {} is invalid", lapIndex);
+            return {};
+        }
+        auto const delta = static_cast<std::int64_t>(*encoded >> 1U) ^ -static_cast<std::int64_t>(*encoded & 1U);
+        previous += delta;
+        times.push_back(Timestamp::fromMilliseconds(previous));
+    }
+    return times;
+}
+
+std::vector<Date> BinarySessionReader::getDates(std::size_t lapIndex) const
+{
+    auto const* column = findColumn(lapIndex, static_cast<std::uint16_t>(ColumnType::Date));
+    if (column == nullptr) {
+        return {};
+    }
+
+    auto reader = ByteReader{column->data};
+    auto dates = std::vector<Date>{};
+    dates.reserve(mLaps[lapIndex].logPointCount);
+    while (!reader.atEnd()) {
+        auto const date = readDate(reader);
+        auto const count = reader.read<std::uint32_t>();
+        if (!count.has_value() || (dates.size() + *count > mLaps[lapIndex].logPointCount)) {
+            SPDLOG_ERROR("The date column of lap {} is invalid", lapIndex);
+            return {};
+        }
+        dates.insert(dates.end(), *count, *date);
+    }
+    return dates;
+}
+
+std::optional<LapData> BinarySessionReader::readLap(
+    std::size_t lapIndex,
+    std::shared_ptr<std::pmr::memory_resource> const& resource) const noexcept
+{
+    if (lapIndex >= mLaps.size()) {
+        return std::nullopt;
+    }
+
+    try {
+        auto const logPointCount = mLaps[lapIndex].logPointCount;
+        auto const latitudes = getLatitudes(lapIndex);
+        auto const longitudes = getLongitudes(lapIndex);
+        auto const velocities = getVelocities(lapIndex);
+        auto const times = getTimes(lapIndex);
+        auto const dates = getDates(lapIndex);
+        auto const sizes = {latitudes.size(), longitudes.size(), velocities.size(), times.size(), dates.size()};
+        if (std::ranges::any_of(sizes, [logPointCount](auto size) {
+                return size != logPointCount;
+            })) {
+            SPDLOG_ERROR("The columns of lap {} have not the size of {} log points", lapIndex, logPointCount);
+            return std::nullopt;
+        }
+
+        auto telemetry = LapTelemetry{resource};
+        telemetry.reserve(logPointCount);
+        for (std::size_t index = 0; index < logPointCount; ++index) {
+            telemetry.append(GpsPositionData{PositionData{latitudes[index], longitudes[index]},
+                                             times[index],
+                                             dates[index],
+                                             VelocityData{velocities[index]}});
+        }
+        for (auto const& name : getChannelNames(lapIndex)) {
+            telemetry.addChannel(name);
+            telemetry.setChannel(name, getChannel(lapIndex, name));
+        }
+        return LapData{getSectorTimes(lapIndex), std::move(telemetry)};
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to read lap {} of the binary session. Error: {}", lapIndex, e.what());
+        return std::nullopt;
+    }
+}
+
+std::optional<SessionData> BinarySessionReader::readSession() const noexcept
+{
+    try {
+        // The decoded log points are at most as large as the sum of the columns plus a fixed size per point.
+        constexpr auto decodedPointSize = sizeof(float) * 2 + sizeof(double) + sizeof(Timestamp) + sizeof(Date);
+        auto arenaSize = std::size_t{0};
+        for (auto const& lap : mLaps) {
+            arenaSize += lap.logPointCount * decodedPointSize;
+            for (auto const& column : lap.columns) {
+                arenaSize += column.name.empty() ? 0 : column.data.size();
+            }
+        }
+        auto const arena = std::shared_ptr<std::pmr::memory_resource>{
+            SessionArena::create(std::max(arenaSize, SessionArena::DefaultBlockSize))};
+
+        auto laps = std::vector<LapData>{};
+        laps.reserve(mLaps.size());
+        for (std::size_t index = 0; index < mLaps.size(); ++index) {
+            auto lap = readLap(index, arena);
+            if (!lap.has_value()) {
+                return std::nullopt;
+            }
+            laps.push_back(std::move(lap.value()));
+        }
+        return SessionData{mMetaData, std::move(laps)};
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to read the binary session. Error: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+BinarySessionReader::Column const* BinarySessionReader::findColumn(std::size_t lapIndex,
+                                                                   std::uint16_t type,
+                                                                   std::string_view name) const noexcept
+{
+    if (lapIndex >= mLaps.size()) {
+        return nullptr;
+    }
+
+    auto const& columns = mLaps[lapIndex].columns;
+    auto const column = std::ranges::find_if(columns, [type, name](Column const& column) {
+        return (column.type == type) && (column.name == name);
+    });
+    return column != columns.cend() ? &(*column) : nullptr;
+}
+
+template <typename T>
+std::span<T const> BinarySessionReader::getRawColumn(std::size_t lapIndex,
+                                                     std::uint16_t type,
+                                                     std::string_view name) const noexcept
+{
+    auto const* column = findColumn(lapIndex, type, name);
+    if (column == nullptr) {
+        return {};
+    }
+    // The size and the alignment of the column are checked on creation.
+    return std::span<T const>{reinterpret_cast<T const*>(column->data.data()), column->data.size() / sizeof(T)};
+}
+
+} // namespace Rapid::Common
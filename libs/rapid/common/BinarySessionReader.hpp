@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_BINARYSESSIONREADER_HPP
+#define RAPID_COMMON_BINARYSESSIONREADER_HPP
+
+#include "SessionData.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Rapid::Common
+{
+
+/**
+ * Reads a binary session container written by @ref BinarySerializer::Session::serialize.
+ * A file is memory mapped and the raw columns of the laps are given as spans into the mapping, so
+ * a lap can be analyzed without parsing or copying the log points. Only the header, the meta data and
+ * the column directory of the laps are read on creation, the checksum is verified once.
+ * Copies of the reader share the mapping, spans stay valid as long as a reader of the mapping exists.
+ */
+class BinarySessionReader final
+{
+public:
+    /**
+     * Memory maps a binary session file.
+     * @param file The path of the file.
+     * @return The reader or std::nullopt when the file can't be mapped or isn't a valid container.
+     */
+    static std::optional<BinarySessionReader> open(std::filesystem::path const& file) noexcept;
+
+    /**
+     * Reads a binary session container from memory, e.g. a received download.
+     * The bytes are copied once into an aligned buffer that is owned by the reader.
+     * @param bytes The bytes of the container.
+     * @return The reader or std::nullopt when the bytes aren't a valid container.
+     */
+    static std::optional<BinarySessionReader> fromBytes(std::span<std::byte const> bytes) noexcept;
+
+    /**
+     * @return The format version of the container.
+     */
+    std::uint16_t getVersion() const noexcept;
+
+    /**
+     * @return The meta data of the session with the track.
+     */
+    SessionMetaData const& getMetaData() const noexcept;
+
+    /**
+     * @return The number of laps of the session.
+     */
+    std::size_t getNumberOfLaps() const noexcept;
+
+    /**
+     * Gives the sector times of a lap.
+     * @param lapIndex The index of the lap.
+     * @return The sector times or an empty list when the index is out of range.
+     */
+    std::vector<Timestamp> getSectorTimes(std::size_t lapIndex) const;
+
+    /**
+     * Gives the number of log points of a lap.
+     * @param lapIndex The index of the lap.
+     * @return The number of log points or 0 when the index is out of range.
+     */
+    std::size_t getNumberOfLogPoints(std::size_t lapIndex) const noexcept;
+
+    /**
+     * Gives the latitudes of a lap without copy.
+     * @param lapIndex The index of the lap.
+     * @return The latitudes or an empty span when the index is out of range.
+     */
+    std::span<float const> getLatitudes(std::size_t lapIndex) const noexcept;
+
+    /**
+     * Gives the longitudes of a lap without copy.
+     * @param lapIndex The index of the lap.
+     * @return The longitudes or an empty span when the index is out of range.
+     */
+    std::span<float const> getLongitudes(std::size_t lapIndex) const noexcept;
+
+    /**
+     * Gives the velocities of a lap in m/s without copy.
+     * @param lapIndex The index of the lap.
+     * @return The velocities or an empty span when the index is out of range.
+     */
+    std::span<double const> getVelocities(std::size_t lapIndex) const noexcept;
+
+    /**
+     * Gives the values of an additional channel of a lap without copy.
+     * @param lapIndex The index of the lap.
+     * @param name The name of the channel.
+     * @return The values or an empty span when the index is out of range or the channel doesn't exist.
+     */
+    std::span<float const> getChannel(std::size_t lapIndex, std::string_view name) const noexcept;
+
+    /**
+     * Gives the names of the additional channels of a lap.
+     * @param lapIndex The index of the lap.
+     * @return The names of the channels.
+     */
+    std::vector<std::string> getChannelNames(std::size_t lapIndex) const;
+
+    /**
+     * Decodes the delta encoded times of a lap.
+     * @param lapIndex The index of the lap.
+     * @return The times or an empty list when the index is out of range.
+     */
+    std::vector<Timestamp> getTimes(std::size_t lapIndex) const;
+
+    /**
+     * Decodes the run length encoded dates of a lap.
+     * @param lapIndex The index of the lap.
+     * @return The dates or an empty list when the index is out of range.
+     */
+    std::vector<Date> getDates(std::size_t lapIndex) const;
+
+    /**
+     * Copies a lap with all log points and channels.
+     * @param lapIndex The index of the lap.
+     * @param resource The memory resource for the log points, nullptr selects the default resource.
+     * @return The lap or std::nullopt when the index is out of range.
+     */
+    std::optional<LapData> readLap(std::size_t lapIndex,
+                                   std::shared_ptr<std::pmr::memory_resource> const& resource = nullptr) const noexcept;
+
+    /**
+     * Copies the whole session.
+     * The log points of all laps are allocated from one @ref SessionArena that is sized for the session.
+     * @return The session or std::nullopt when a lap can't be read.
+     */
+    std::optional<SessionData> readSession() const noexcept;
+
+private:
+    struct Column
+    {
+        std::uint16_t type{0};
+        std::uint16_t encoding{0};
+        std::string_view name;
+        std::span<std::byte const> data;
+    };
+
+    struct Lap
+    {
+        std::span<std::byte const> sectorTimes;
+        std::size_t logPointCount{0};
+        std::vector<Column> columns;
+    };
+
+    BinarySessionReader(std::shared_ptr<void const> owner, std::span<std::byte const> bytes);
+    static std::optional<BinarySessionReader> parse(std::shared_ptr<void const> owner,
+                                                    std::span<std::byte const> bytes) noexcept;
+    Column const* findColumn(std::size_t lapIndex, std::uint16_t type, std::string_view name = {}) const noexcept;
+
+    template <typename T>
+    std::span<T const> getRawColumn(std::size_t lapIndex,
+                                    std::uint16_t type,
+                                    std::string_view name = {}) const noexcept;
+
+    std::shared_ptr<void const> mOwner;
+    std::span<std::byte const> mBytes;
+    std::uint16_t mVersion{0};
+    SessionMetaData mMetaData;
+    std::vector<Lap> mLaps;
+};
+
+} // namespace Rapid::Common
+
+#endif // !RAPID_COMMON_BINARYSESSIONREADER_HPP
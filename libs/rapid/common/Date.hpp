@@ -4,20 +4,24 @@
 
 #pragma once
 
-#include "SharedDataPointer.hpp"
+#include <cstdint>
 #include <string>
 
 namespace Rapid::Common
 {
 
-class SharedDate;
+/**
+ * A calendar date.
+ * The Date is a trivially copyable value type, the components are stored inline and copying an
+ * instance never allocates.
+ */
 class Date final
 {
 public:
     /**
      * Creates an instance of Date.
      */
-    Date();
+    constexpr Date() noexcept = default;
 
     /**
      * Creates a date by a string.
@@ -29,69 +33,87 @@ public:
     /**
      * Default destructor
      */
-    ~Date();
+    constexpr ~Date() = default;
 
     /**
      * Copy constructor for Date
      * @param ohter The object to copy from.
      */
-    Date(Date const& ohter);
+    constexpr Date(Date const& ohter) noexcept = default;
 
     /**
      * The copy assignment operator for Date.
      * @param other The object to copy from.
      * @return TrackData& A reference to the copied track.
      */
-    Date& operator=(Date const& other);
+    constexpr Date& operator=(Date const& other) noexcept = default;
 
     /**
      * Move constructor for Date
      * @param other The object to move from.
      */
-    Date(Date&& other);
+    constexpr Date(Date&& other) noexcept = default;
 
     /**
      * The move assignment operator for the Date.
      * @param other The object to move from.
      * @return TrackData& A reference to the moved date.
      */
-    Date& operator=(Date&& other);
+    constexpr Date& operator=(Date&& other) noexcept = default;
 
     /**
      * Gives the year.
      * @return The year of the date.
      */
-    std::uint16_t getYear() const noexcept;
+    constexpr std::uint16_t getYear() const noexcept
+    {
+        return mYear;
+    }
 
     /**
      * Sets a new year.
      * @param year The new year.
      */
-    void setYear(std::uint16_t year);
+    constexpr void setYear(std::uint16_t year) noexcept
+    {
+        mYear = year;
+    }
 
     /**
      * Gives the month.
      * @return The month of the date.
      */
-    std::uint8_t getMonth() const noexcept;
+    constexpr std::uint8_t getMonth() const noexcept
+    {
+        return mMonth;
+    }
 
     /**
      * Sets a new month.
      * @param month The new month.
      */
-    void setMonth(std::uint8_t month);
+    constexpr void setMonth(std::uint8_t month) noexcept
+    {
+        mMonth = month;
+    }
 
     /**
      * Gives the the day.
      * @return The day of the date.
      */
-    std::uint8_t getDay() const noexcept;
+    constexpr std::uint8_t getDay() const noexcept
+    {
+        return mDay;
+    }
 
     /**
      * Sets a new day.
      * @param day The day of the date.
      */
-    void setDay(std::uint8_t day);
+    constexpr void setDay(std::uint8_t day) noexcept
+    {
+        mDay = day;
+    }
 
     /**
      * Converts the date into string in the format of dd.MM.YYYY
@@ -104,14 +126,24 @@ public:
      * @return true The two objects are the same.
      * @return false The two objects are not the same.
      */
-    friend bool operator==(Date const& lhs, Date const& rhs);
+    friend constexpr bool operator==(Date const& lhs, Date const& rhs) noexcept
+    {
+        // clang-format off
+        return ((lhs.mYear == rhs.mYear) &&
+                (lhs.mMonth == rhs.mMonth) &&
+                (lhs.mDay == rhs.mDay));
+        // clang-format on
+    }
 
     /**
      * Not Equal operator
      * @return true The two objects are not the same.
      * @return false The two objects are the same.
      */
-    friend bool operator!=(Date const& lhs, Date const& rhs);
+    friend constexpr bool operator!=(Date const& lhs, Date const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
 
     /**
      * Gives you the date of the system
@@ -124,17 +156,30 @@ public:
      * @return true The lhs date is smaller than the rhs are not the same.
      * @return fals The lhs date is not smaller than the rhs are not the same.
      */
-    friend bool operator<(Date const& lhs, Date const& rhs);
+    friend constexpr bool operator<(Date const& lhs, Date const& rhs) noexcept
+    {
+        if (lhs.mYear != rhs.mYear) {
+            return lhs.mYear < rhs.mYear;
+        } else if (lhs.mMonth != rhs.mMonth) {
+            return lhs.mMonth < rhs.mMonth;
+        }
+        return lhs.mDay < rhs.mDay;
+    }
 
     /**
      * Greater than operator
      * @return true The lhs date is greater than the rhs are not the same.
      * @return fals The lhs date is not greater than the rhs are not the same.
      */
-    friend bool operator>(Date const& lhs, Date const& rhs);
+    friend constexpr bool operator>(Date const& lhs, Date const& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
 
 private:
-    SharedDataPointer<SharedDate> mData;
+    std::uint16_t mYear{0};
+    std::uint8_t mMonth{0};
+    std::uint8_t mDay{0};
 };
 
 } // namespace Rapid::Common
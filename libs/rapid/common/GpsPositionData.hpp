@@ -7,16 +7,16 @@
 
 #include "Date.hpp"
 #include "PositionData.hpp"
-#include "SharedDataPointer.hpp"
 #include "Timestamp.hpp"
 #include "VelocityData.hpp"
 
 namespace Rapid::Common
 {
-class SharedGpsPositionData;
 
 /**
  * A GpsPositionData always consists of a Position, Timestamp and Date.
+ * All parts are trivially copyable value types that are stored inline, so a GpsPositionData is
+ * trivially copyable as well and a std::vector of them is one contiguous allocation.
  */
 class GpsPositionData final
 {
@@ -24,7 +24,7 @@ public:
     /**
      * Creates an empty instance of PositionDateTimeDate
      */
-    GpsPositionData();
+    constexpr GpsPositionData() noexcept = default;
 
     /**
      * Creates an instance of the GpsPositionData.
@@ -32,7 +32,12 @@ public:
      * @param time The time data for the instance.
      * @param date The date data for the instance.
      */
-    GpsPositionData(PositionData const& posData, Timestamp const& time, Date const& date);
+    constexpr GpsPositionData(PositionData const& posData, Timestamp const& time, Date const& date) noexcept
+        : mPosition{posData}
+        , mTime{time}
+        , mDate{date}
+    {
+    }
 
     /**
      * Creates an instance of the GpsPositionData.
@@ -41,99 +46,146 @@ public:
      * @param date The date data for the instance.
      * @param velocity The velocity data for the instance.
      */
-    GpsPositionData(PositionData const& posData, Timestamp const& time, Date const& date, VelocityData velocity);
+    constexpr GpsPositionData(PositionData const& posData,
+                              Timestamp const& time,
+                              Date const& date,
+                              VelocityData velocity) noexcept
+        : mPosition{posData}
+        , mTime{time}
+        , mDate{date}
+        , mVelocity{velocity}
+    {
+    }
 
     /**
      * Default destructor
      */
-    ~GpsPositionData();
+    constexpr ~GpsPositionData() = default;
 
     /**
      * Copy constructor for GpsPositionData.
      * @param other The object to copy from.
      */
-    GpsPositionData(GpsPositionData const& other);
+    constexpr GpsPositionData(GpsPositionData const& other) noexcept = default;
 
     /**
      * Copy assignment operator for GpsPositionData.
      * @param other The object to copy from.
      * @return PositionData& A reference to the copied instance.
      */
-    GpsPositionData& operator=(GpsPositionData const& other);
+    constexpr GpsPositionData& operator=(GpsPositionData const& other) noexcept = default;
 
     /**
      * The move constructor for GpsPositionData.
      * @param other The object to move from.
      */
-    GpsPositionData(GpsPositionData&& other);
+    constexpr GpsPositionData(GpsPositionData&& other) noexcept = default;
 
     /**
      * The move assignment operator for GpsPositionData.
      * @param other The object to move from.
      * @return PositionData& A reference of the moved instance.
      */
-    GpsPositionData& operator=(GpsPositionData&& other);
+    constexpr GpsPositionData& operator=(GpsPositionData&& other) noexcept = default;
 
     /**
      * @return The current position
      */
-    PositionData getPosition() const noexcept;
+    constexpr PositionData getPosition() const noexcept
+    {
+        return mPosition;
+    }
 
     /**
      * Sets a new position.
      * @param position The new position.
      */
-    void setPosition(PositionData const& position);
+    constexpr void setPosition(PositionData const& position) noexcept
+    {
+        mPosition = position;
+    }
 
     /**
      * @return The current time
      */
-    Timestamp getTime() const noexcept;
+    constexpr Timestamp getTime() const noexcept
+    {
+        return mTime;
+    }
 
     /**
      * @return Gives the velocity.
      */
-    VelocityData getVelocity() const noexcept;
+    constexpr VelocityData getVelocity() const noexcept
+    {
+        return mVelocity;
+    }
 
     /**
      * Sets a new time.
      * @param time The new time.
      */
-    void setTime(Timestamp const& time);
+    constexpr void setTime(Timestamp const& time) noexcept
+    {
+        mTime = time;
+    }
 
     /**
      * @return The current date.
      */
-    Date getDate() const noexcept;
+    constexpr Date getDate() const noexcept
+    {
+        return mDate;
+    }
 
     /**
      * Sets a new date.
      * @param date The new date.
      */
-    void setDate(Date const& date);
+    constexpr void setDate(Date const& date) noexcept
+    {
+        mDate = date;
+    }
 
     /**
      * Sets the velocity
      * @param velocity The new velocity
      */
-    void setVelocity(VelocityData const& velocity);
+    constexpr void setVelocity(VelocityData const& velocity) noexcept
+    {
+        mVelocity = velocity;
+    }
 
     /**
      * Equal operator
      * @return true The two objects are the same.
      * @return false The two objects are not the same.
      */
-    friend bool operator==(GpsPositionData const& lhs, GpsPositionData const& rhs);
+    friend constexpr bool operator==(GpsPositionData const& lhs, GpsPositionData const& rhs) noexcept
+    {
+        // clang-format off
+        return ((lhs.mPosition) == (rhs.mPosition) &&
+                (lhs.mTime) == (rhs.mTime) &&
+                (lhs.mDate) == (rhs.mDate) &&
+                (lhs.mVelocity) == (rhs.mVelocity));
+        // clang-format on
+    }
 
     /**
      * Not Equal operator
      * @return true The two objects are not the same.
      * @return false The two objects are the same.
      */
-    friend bool operator!=(GpsPositionData const& lhs, GpsPositionData const& rhs);
+    friend constexpr bool operator!=(GpsPositionData const& lhs, GpsPositionData const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
 
 private:
-    SharedDataPointer<SharedGpsPositionData> mData;
+    PositionData mPosition;
+    Timestamp mTime;
+    Date mDate;
+    VelocityData mVelocity;
 };
 
 } // namespace Rapid::Common
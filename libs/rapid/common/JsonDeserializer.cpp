@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "JsonDeserializer.hpp"
+#include "SessionArena.hpp"
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 #include <sstream>
@@ -77,7 +78,18 @@ std::optional<TrackData> parseTrack(nlohmann::ordered_json const& jsonTrack)
             }
         }
         if (sections.size() > 0) {
-            trackData.setSections(sections);
+            trackData.setSections(std::move(sections));
+        }
+
+        if (jsonTrack.contains("topology") && jsonTrack["topology"] == "point_to_point") {
+            trackData.setTopology(TrackTopology::PointToPoint);
+        }
+
+        if (jsonTrack.contains("pitlane")) {
+            auto pitLaneLine = parsePosition(jsonTrack["pitlane"]);
+            if (pitLaneLine.has_value()) {
+                trackData.setPitLaneLine(pitLaneLine.value());
+            }
         }
 
         return trackData;
@@ -91,7 +103,8 @@ std::optional<TrackData> parseTrack(nlohmann::ordered_json const& jsonTrack)
     return std::nullopt;
 }
 
-std::vector<LapData> parseLaps(nlohmann::ordered_json const& jsonLaps)
+std::vector<LapData> parseLaps(nlohmann::ordered_json const& jsonLaps,
+                               std::shared_ptr<std::pmr::memory_resource> const& resource)
 {
     auto laps = std::vector<LapData>();
     laps.reserve(jsonLaps.size());
@@ -102,7 +115,8 @@ std::vector<LapData> parseLaps(nlohmann::ordered_json const& jsonLaps)
         }
 
         auto const jsonLogPoints = jsonLap["log_points"];
-        auto logPoints = std::vector<GpsPositionData>{};
+        auto logPoints = LapTelemetry{resource};
+        logPoints.reserve(jsonLogPoints.size());
         try {
             for (auto const& jsonLogPoint : jsonLogPoints) {
                 auto const gpsPosition =
@@ -110,7 +124,7 @@ std::vector<LapData> parseLaps(nlohmann::ordered_json const& jsonLaps)
                                     Timestamp{jsonLogPoint["time"]},
                                     Date{jsonLogPoint["date"]},
                                     VelocityData{jsonLogPoint["velocity"]}};
-                logPoints.push_back(gpsPosition);
+                logPoints.append(gpsPosition);
             }
         } catch (std::invalid_argument& e) {
             SPDLOG_CRITICAL("Failed deserilize lap data invalid argument.{}", e.what());
@@ -119,8 +133,8 @@ std::vector<LapData> parseLaps(nlohmann::ordered_json const& jsonLaps)
             SPDLOG_CRITICAL("Failed deserilize lap data invalid argument.{}", e.what());
             return {};
         }
-        lap.overwritePositions(logPoints);
-        laps.push_back(lap);
+        lap.setTelemetry(std::move(logPoints));
+        laps.push_back(std::move(lap));
     }
     return laps;
 }
@@ -140,14 +154,20 @@ namespace Session
 {
 
 std::optional<SessionData> deserialize(std::string const& rawData)
+{
+    return deserialize(rawData, SessionArena::create());
+}
+
+std::optional<SessionData> deserialize(std::string const& rawData,
+                                       std::shared_ptr<std::pmr::memory_resource> const& resource)
 {
     auto json = nlohmann::ordered_json{};
     try {
         auto jsonSession = json.parse(rawData);
         auto metaData = deserializeSessionMetaData(jsonSession);
-        auto laps = parseLaps(jsonSession["laps"]);
+        auto laps = parseLaps(jsonSession["laps"], resource);
         auto session = SessionData{metaData.getTrack(), metaData.getSessionDate(), metaData.getSessionTime()};
-        session.addLaps(laps);
+        session.addLaps(std::move(laps));
         return session;
     } catch (nlohmann::json::exception const& e) {
         SPDLOG_CRITICAL("Failed to deserialize session. {}", e.what());
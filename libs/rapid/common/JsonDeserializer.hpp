@@ -6,6 +6,8 @@
 #define JSONDESERIALIZER_HPP
 
 #include "SessionData.hpp"
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <string>
 
@@ -14,7 +16,21 @@ namespace Rapid::Common::JsonDeserializer
 
 namespace Session
 {
+/**
+ * Deserializes a session, the log points of all laps are allocated from a new @ref SessionArena.
+ * @param rawData The raw JSON string
+ * @return The session or std::nullopt when the JSON isn't a valid session.
+ */
 std::optional<SessionData> deserialize(std::string const& rawData);
+
+/**
+ * Deserializes a session, the log points of all laps are allocated from the memory resource.
+ * @param rawData The raw JSON string
+ * @param resource The memory resource for the log points, nullptr selects the default resource.
+ * @return The session or std::nullopt when the JSON isn't a valid session.
+ */
+std::optional<SessionData> deserialize(std::string const& rawData,
+                                       std::shared_ptr<std::pmr::memory_resource> const& resource);
 } // namespace Session
 
 namespace SessionMetaData
@@ -29,16 +29,22 @@ nlohmann::ordered_json serialize(LapData const& lap)
     }
     json["sectors"] = sectors;
 
+    auto const& telemetry = lap.getTelemetry();
+    auto const velocities = telemetry.getVelocities();
+    auto const longitudes = telemetry.getLongitudes();
+    auto const latitudes = telemetry.getLatitudes();
+    auto const times = telemetry.getTimes();
+    auto const dates = telemetry.getDates();
     auto logPoints = std::vector<nlohmann::ordered_json>{};
-    logPoints.reserve(lap.getPositions().size());
-    for (auto const& gpsPos : lap.getPositions()) {
+    logPoints.reserve(telemetry.size());
+    for (std::size_t index = 0; index < telemetry.size(); ++index) {
         auto pointObj = nlohmann::ordered_json{};
-        pointObj["velocity"] = gpsPos.getVelocity().getVelocity();
-        pointObj["longitude"] = gpsPos.getPosition().getLongitude();
-        pointObj["latitude"] = gpsPos.getPosition().getLatitude();
-        pointObj["time"] = gpsPos.getTime().asString();
-        pointObj["date"] = gpsPos.getDate().asString();
-        logPoints.push_back(pointObj);
+        pointObj["velocity"] = velocities[index];
+        pointObj["longitude"] = longitudes[index];
+        pointObj["latitude"] = latitudes[index];
+        pointObj["time"] = times[index].asString();
+        pointObj["date"] = dates[index].asString();
+        logPoints.push_back(std::move(pointObj));
     }
     json["log_points"] = logPoints;
 
@@ -86,6 +92,14 @@ nlohmann::ordered_json serializeTrack(TrackData const& track)
     }
     json["sectors"] = jsonSections;
 
+    // Only tracks that aren't a plain circuit have the optional topology entries.
+    if (track.getTopology() == TrackTopology::PointToPoint) {
+        json["topology"] = "point_to_point";
+    }
+    if (track.getPitLaneLine().has_value()) {
+        json["pitlane"] = Position::serialize(*track.getPitLaneLine());
+    }
+
     return json;
 }
 
@@ -12,13 +12,13 @@ class SharedLap : public SharedData
 {
 public:
     std::vector<Timestamp> mSectorTimes;
-    std::vector<GpsPositionData> mPositions;
+    LapTelemetry mTelemetry;
 
     friend bool operator==(SharedLap const& lhs, SharedLap const& rhs)
     {
         // clang-format off
         return (lhs.mSectorTimes == rhs.mSectorTimes) &&
-               (lhs.mPositions == rhs.mPositions);
+               (lhs.mTelemetry == rhs.mTelemetry);
         // clang-format on
     }
 };
@@ -40,6 +40,19 @@ LapData::LapData(std::vector<Timestamp> const& sectorTimes)
     mData->mSectorTimes = sectorTimes;
 }
 
+LapData::LapData(std::vector<Timestamp>&& sectorTimes)
+    : mData{new SharedLap}
+{
+    mData->mSectorTimes = std::move(sectorTimes);
+}
+
+LapData::LapData(std::vector<Timestamp> sectorTimes, LapTelemetry telemetry)
+    : mData{new SharedLap}
+{
+    mData->mSectorTimes = std::move(sectorTimes);
+    mData->mTelemetry = std::move(telemetry);
+}
+
 LapData::~LapData() = default;
 
 LapData::LapData(LapData const& other) = default;
@@ -88,9 +101,45 @@ std::vector<Timestamp> const& LapData::getSectorTimes() const noexcept
     return mData->mSectorTimes;
 }
 
-std::vector<GpsPositionData> const& LapData::getPositions() const noexcept
+std::vector<GpsPositionData> LapData::getPositions() const
+{
+    return mData->mTelemetry.toPositions();
+}
+
+LapTelemetry const& LapData::getTelemetry() const noexcept
+{
+    return mData->mTelemetry;
+}
+
+void LapData::setTelemetry(LapTelemetry const& telemetry)
 {
-    return mData->mPositions;
+    mData->mTelemetry = telemetry;
+}
+
+void LapData::setTelemetry(LapTelemetry&& telemetry)
+{
+    mData->mTelemetry = std::move(telemetry);
+}
+
+LapTelemetry LapData::takeTelemetry()
+{
+    // A shared lap is replaced by a copy without log points, so the log points aren't copied twice.
+    if (mData.getRefCount() > 1) {
+        auto telemetry = mData.constData()->mTelemetry;
+        auto lap = SharedDataPointer<SharedLap>{new SharedLap};
+        lap->mSectorTimes = mData.constData()->mSectorTimes;
+        mData = std::move(lap);
+        return telemetry;
+    }
+
+    auto telemetry = std::move(mData->mTelemetry);
+    mData->mTelemetry.clear();
+    return telemetry;
+}
+
+std::vector<GpsPositionData> LapData::takePositions()
+{
+    return takeTelemetry().toPositions();
 }
 
 void LapData::addSectorTime(Timestamp const& sectorTime)
@@ -103,14 +152,19 @@ void LapData::addSectorTimes(std::vector<Timestamp> const& sectorTimes)
     mData->mSectorTimes = sectorTimes;
 }
 
+void LapData::addSectorTimes(std::vector<Timestamp>&& sectorTimes)
+{
+    mData->mSectorTimes = std::move(sectorTimes);
+}
+
 void LapData::addPosition(GpsPositionData const& pos)
 {
-    mData->mPositions.push_back(pos);
+    mData->mTelemetry.append(pos);
 }
 
 void LapData::overwritePositions(std::vector<GpsPositionData> const& positions)
 {
-    mData->mPositions = positions;
+    mData->mTelemetry = LapTelemetry::fromPositions(positions);
 }
 
 bool operator==(LapData const& lhs, LapData const& rhs)
@@ -6,6 +6,7 @@
 #define LAP_HPP
 
 #include "GpsPositionData.hpp"
+#include "LapTelemetry.hpp"
 #include "SharedDataPointer.hpp"
 #include "Timestamp.hpp"
 #include <optional>
@@ -39,6 +40,19 @@ public:
      */
     explicit LapData(std::vector<Timestamp> const& sectorTimes);
 
+    /**
+     * Constructs LapData instance and takes over the sector times.
+     * @param sectorTimes The array of sector times.
+     */
+    explicit LapData(std::vector<Timestamp>&& sectorTimes);
+
+    /**
+     * Constructs LapData instance with sector times and log points, both are taken over without copy.
+     * @param sectorTimes The array of sector times.
+     * @param telemetry The log points of the lap.
+     */
+    LapData(std::vector<Timestamp> sectorTimes, LapTelemetry telemetry);
+
     /**
      * Default destructor
      */
@@ -101,9 +115,44 @@ public:
     /**
      * Gives the stored positions information for that lap.
      * The position in the list is the order of the data.
+     * @note The positions are stored column wise, the list is created on every call. Use
+     * @ref LapData::getTelemetry to iterate over the positions without copying them.
      * return The stored position of that lap.
      */
-    [[nodiscard]] std::vector<GpsPositionData> const& getPositions() const noexcept;
+    [[nodiscard]] std::vector<GpsPositionData> getPositions() const;
+
+    /**
+     * Gives the stored log points of the lap in columnar form.
+     * @return The telemetry of the lap.
+     */
+    [[nodiscard]] LapTelemetry const& getTelemetry() const noexcept;
+
+    /**
+     * Overwrite all log points of the lap.
+     * @param telemetry The new log points for that lap.
+     */
+    void setTelemetry(LapTelemetry const& telemetry);
+
+    /**
+     * Overwrite all log points of the lap and takes over the buffers of the passed telemetry.
+     * @param telemetry The new log points for that lap.
+     */
+    void setTelemetry(LapTelemetry&& telemetry);
+
+    /**
+     * Removes the log points from the lap and gives them to the caller.
+     * The buffers are moved out when the lap is the only owner, otherwise the log points are copied and
+     * the other owners keep their log points.
+     * @return The log points of the lap.
+     */
+    [[nodiscard]] LapTelemetry takeTelemetry();
+
+    /**
+     * Removes the log points from the lap and gives them as list of positions.
+     * @note The positions are stored column wise, so the list is created from the columns.
+     * @return The log points of the lap.
+     */
+    [[nodiscard]] std::vector<GpsPositionData> takePositions();
 
     /**
      * Adds a new sector time to the lap.
@@ -119,6 +168,13 @@ public:
      */
     void addSectorTimes(std::vector<Timestamp> const& sectorTimes);
 
+    /**
+     * Adds a list of sector times to the lap and takes over the list.
+     * The order of the list defines the ordering of the sectors.
+     * @param sectorTimes The list of sector times.
+     */
+    void addSectorTimes(std::vector<Timestamp>&& sectorTimes);
+
     /**
      * Adds a position to the list of positions of the lap.
      * @param pos The position that shall be added.
@@ -0,0 +1,385 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "LapTelemetry.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace Rapid::Common
+{
+
+LapTelemetry::LapTelemetry() = default;
+
+LapTelemetry::LapTelemetry(std::shared_ptr<std::pmr::memory_resource> resource)
+    : mResource{std::move(resource)}
+    , mLatitudes{getMemoryResource()}
+    , mLongitudes{getMemoryResource()}
+    , mVelocities{getMemoryResource()}
+    , mTimes{getMemoryResource()}
+    , mDates{getMemoryResource()}
+{
+}
+
+LapTelemetry::~LapTelemetry() = default;
+
+LapTelemetry::LapTelemetry(LapTelemetry const& other)
+    : mLatitudes{other.mLatitudes}
+    , mLongitudes{other.mLongitudes}
+    , mVelocities{other.mVelocities}
+    , mTimes{other.mTimes}
+    , mDates{other.mDates}
+    , mChannels{other.mChannels}
+    , mRevision{other.mRevision}
+{
+}
+
+LapTelemetry& LapTelemetry::operator=(LapTelemetry const& other)
+{
+    if (this != &other) {
+        mLatitudes = other.mLatitudes;
+        mLongitudes = other.mLongitudes;
+        mVelocities = other.mVelocities;
+        mTimes = other.mTimes;
+        mDates = other.mDates;
+        mChannels.clear();
+        mChannels.reserve(other.mChannels.size());
+        for (auto const& channel : other.mChannels) {
+            mChannels.push_back(Channel{
+                .name = channel.name,
+                .values = Column<float>(channel.values.begin(), channel.values.end(), mLatitudes.get_allocator())});
+        }
+        mRevision = other.mRevision;
+    }
+    return *this;
+}
+
+LapTelemetry::LapTelemetry(LapTelemetry&& other) noexcept
+    : mResource{std::move(other.mResource)}
+    , mLatitudes{std::move(other.mLatitudes)}
+    , mLongitudes{std::move(other.mLongitudes)}
+    , mVelocities{std::move(other.mVelocities)}
+    , mTimes{std::move(other.mTimes)}
+    , mDates{std::move(other.mDates)}
+    , mChannels{std::move(other.mChannels)}
+    , mRevision{other.mRevision}
+{
+    other.resetColumns();
+}
+
+LapTelemetry& LapTelemetry::operator=(LapTelemetry&& other) noexcept
+{
+    if (this != &other) {
+        // The columns take their allocator along, the previous columns are released before their resource.
+        mLatitudes = std::move(other.mLatitudes);
+        mLongitudes = std::move(other.mLongitudes);
+        mVelocities = std::move(other.mVelocities);
+        mTimes = std::move(other.mTimes);
+        mDates = std::move(other.mDates);
+        mChannels = std::move(other.mChannels);
+        mResource = std::move(other.mResource);
+        mRevision = other.mRevision;
+        other.resetColumns();
+    }
+    return *this;
+}
+
+LapTelemetry LapTelemetry::fromPositions(std::span<GpsPositionData const> positions)
+{
+    auto telemetry = LapTelemetry{};
+    telemetry.reserve(positions.size());
+    for (auto const& position : positions) {
+        telemetry.append(position);
+    }
+    return telemetry;
+}
+
+void LapTelemetry::reserve(std::size_t capacity)
+{
+    mLatitudes.reserve(capacity);
+    mLongitudes.reserve(capacity);
+    mVelocities.reserve(capacity);
+    mTimes.reserve(capacity);
+    mDates.reserve(capacity);
+    for (auto& channel : mChannels) {
+        channel.values.reserve(capacity);
+    }
+}
+
+std::pmr::memory_resource* LapTelemetry::getMemoryResource() const noexcept
+{
+    return mResource != nullptr ? mResource.get() : std::pmr::get_default_resource();
+}
+
+std::size_t LapTelemetry::size() const noexcept
+{
+    return mTimes.size();
+}
+
+bool LapTelemetry::empty() const noexcept
+{
+    return mTimes.empty();
+}
+
+std::uint64_t LapTelemetry::getRevision() const noexcept
+{
+    return mRevision;
+}
+
+void LapTelemetry::clear() noexcept
+{
+    mRevision = createRevision();
+    mLatitudes.clear();
+    mLongitudes.clear();
+    mVelocities.clear();
+    mTimes.clear();
+    mDates.clear();
+    for (auto& channel : mChannels) {
+        channel.values.clear();
+    }
+}
+
+void LapTelemetry::append(GpsPositionData const& position)
+{
+    auto const pos = position.getPosition();
+    mRevision = createRevision();
+    mLatitudes.push_back(pos.getLatitude());
+    mLongitudes.push_back(pos.getLongitude());
+    mVelocities.push_back(position.getVelocity().getVelocity());
+    mTimes.push_back(position.getTime());
+    mDates.push_back(position.getDate());
+    for (auto& channel : mChannels) {
+        channel.values.push_back(0.0f);
+    }
+}
+
+GpsPositionData LapTelemetry::getPosition(std::size_t index) const noexcept
+{
+    return GpsPositionData{PositionData{mLatitudes[index], mLongitudes[index]},
+                           mTimes[index],
+                           mDates[index],
+                           VelocityData{mVelocities[index]}};
+}
+
+std::vector<GpsPositionData> LapTelemetry::toPositions() const
+{
+    auto positions = std::vector<GpsPositionData>{};
+    positions.reserve(size());
+    for (std::size_t index = 0; index < size(); ++index) {
+        positions.push_back(getPosition(index));
+    }
+    return positions;
+}
+
+std::span<float const> LapTelemetry::getLatitudes() const noexcept
+{
+    return mLatitudes;
+}
+
+std::span<float const> LapTelemetry::getLongitudes() const noexcept
+{
+    return mLongitudes;
+}
+
+std::span<double const> LapTelemetry::getVelocities() const noexcept
+{
+    return mVelocities;
+}
+
+std::span<Timestamp const> LapTelemetry::getTimes() const noexcept
+{
+    return mTimes;
+}
+
+std::span<Date const> LapTelemetry::getDates() const noexcept
+{
+    return mDates;
+}
+
+bool LapTelemetry::addChannel(std::string const& name)
+{
+    if (hasChannel(name)) {
+        return false;
+    }
+    mChannels.push_back(Channel{.name = name, .values = Column<float>(size(), 0.0f, mLatitudes.get_allocator())});
+    mChannels.back().values.reserve(mTimes.capacity());
+    mRevision = createRevision();
+    return true;
+}
+
+bool LapTelemetry::hasChannel(std::string_view name) const noexcept
+{
+    return findChannel(name) != nullptr;
+}
+
+std::vector<std::string> LapTelemetry::getChannelNames() const
+{
+    auto names = std::vector<std::string>{};
+    names.reserve(mChannels.size());
+    for (auto const& channel : mChannels) {
+        names.push_back(channel.name);
+    }
+    return names;
+}
+
+std::span<float const> LapTelemetry::getChannel(std::string_view name) const noexcept
+{
+    auto const* channel = findChannel(name);
+    return channel != nullptr ? std::span<float const>{channel->values} : std::span<float const>{};
+}
+
+bool LapTelemetry::setChannel(std::string_view name, std::span<float const> values) noexcept
+{
+    auto* channel = findChannel(name);
+    if ((channel == nullptr) || (values.size() != channel->values.size())) {
+        return false;
+    }
+    std::ranges::copy(values, channel->values.begin());
+    mRevision = createRevision();
+    return true;
+}
+
+bool LapTelemetry::setChannelValue(std::string_view name, std::size_t index, float value) noexcept
+{
+    auto* channel = findChannel(name);
+    if ((channel == nullptr) || (index >= channel->values.size())) {
+        return false;
+    }
+    channel->values[index] = value;
+    mRevision = createRevision();
+    return true;
+}
+
+LapTelemetryView LapTelemetry::getView() const noexcept
+{
+    return LapTelemetryView{*this, 0, size()};
+}
+
+LapTelemetryView LapTelemetry::slice(std::size_t offset, std::size_t count) const noexcept
+{
+    return getView().slice(offset, count);
+}
+
+LapTelemetry::Channel const* LapTelemetry::findChannel(std::string_view name) const noexcept
+{
+    auto const channel = std::ranges::find(mChannels, name, &Channel::name);
+    return channel != mChannels.cend() ? &(*channel) : nullptr;
+}
+
+LapTelemetry::Channel* LapTelemetry::findChannel(std::string_view name) noexcept
+{
+    auto const channel = std::ranges::find(mChannels, name, &Channel::name);
+    return channel != mChannels.end() ? &(*channel) : nullptr;
+}
+
+void LapTelemetry::resetColumns() noexcept
+{
+    // The moved from columns still refer to the resource of the moved telemetry, they are put back on the default
+    // resource, so the telemetry can be used again after the resource is released. The moved from telemetry doesn't
+    // have the log points of its revision anymore.
+    mResource.reset();
+    mLatitudes = Column<float>{};
+    mLongitudes = Column<float>{};
+    mVelocities = Column<double>{};
+    mTimes = Column<Timestamp>{};
+    mDates = Column<Date>{};
+    mChannels.clear();
+    mRevision = createRevision();
+}
+
+std::uint64_t LapTelemetry::createRevision() noexcept
+{
+    static auto nextRevision = std::atomic<std::uint64_t>{0};
+    return nextRevision.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool operator==(LapTelemetry const& lhs, LapTelemetry const& rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+
+    // The positions are compared with the tolerance of PositionData.
+    for (std::size_t index = 0; index < lhs.size(); ++index) {
+        if (PositionData{lhs.mLatitudes[index], lhs.mLongitudes[index]} !=
+            PositionData{rhs.mLatitudes[index], rhs.mLongitudes[index]}) {
+            return false;
+        }
+    }
+
+    // clang-format off
+    return (lhs.mVelocities == rhs.mVelocities) &&
+           (lhs.mTimes == rhs.mTimes) &&
+           (lhs.mDates == rhs.mDates) &&
+           (lhs.mChannels == rhs.mChannels);
+    // clang-format on
+}
+
+bool operator!=(LapTelemetry const& lhs, LapTelemetry const& rhs)
+{
+    return !(lhs == rhs);
+}
+
+LapTelemetryView::LapTelemetryView(LapTelemetry const& telemetry, std::size_t offset, std::size_t count) noexcept
+    : mTelemetry{&telemetry}
+    , mOffset{std::min(offset, telemetry.size())}
+    , mCount{std::min(count, telemetry.size() - mOffset)}
+{
+}
+
+std::size_t LapTelemetryView::size() const noexcept
+{
+    return mCount;
+}
+
+bool LapTelemetryView::empty() const noexcept
+{
+    return mCount == 0;
+}
+
+GpsPositionData LapTelemetryView::getPosition(std::size_t index) const noexcept
+{
+    return mTelemetry->getPosition(mOffset + index);
+}
+
+std::span<float const> LapTelemetryView::getLatitudes() const noexcept
+{
+    return mTelemetry != nullptr ? view(mTelemetry->getLatitudes()) : std::span<float const>{};
+}
+
+std::span<float const> LapTelemetryView::getLongitudes() const noexcept
+{
+    return mTelemetry != nullptr ? view(mTelemetry->getLongitudes()) : std::span<float const>{};
+}
+
+std::span<double const> LapTelemetryView::getVelocities() const noexcept
+{
+    return mTelemetry != nullptr ? view(mTelemetry->getVelocities()) : std::span<double const>{};
+}
+
+std::span<Timestamp const> LapTelemetryView::getTimes() const noexcept
+{
+    return mTelemetry != nullptr ? view(mTelemetry->getTimes()) : std::span<Timestamp const>{};
+}
+
+std::span<Date const> LapTelemetryView::getDates() const noexcept
+{
+    return mTelemetry != nullptr ? view(mTelemetry->getDates()) : std::span<Date const>{};
+}
+
+std::span<float const> LapTelemetryView::getChannel(std::string_view name) const noexcept
+{
+    return mTelemetry != nullptr ? view(mTelemetry->getChannel(name)) : std::span<float const>{};
+}
+
+LapTelemetryView LapTelemetryView::slice(std::size_t offset, std::size_t count) const noexcept
+{
+    if (mTelemetry == nullptr) {
+        return LapTelemetryView{};
+    }
+    auto const clampedOffset = std::min(offset, mCount);
+    auto const clampedCount = std::min(count, mCount - clampedOffset);
+    return LapTelemetryView{*mTelemetry, mOffset + clampedOffset, clampedCount};
+}
+
+} // namespace Rapid::Common
@@ -0,0 +1,427 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_LAPTELEMETRY_HPP
+#define RAPID_COMMON_LAPTELEMETRY_HPP
+
+#include "GpsPositionData.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Rapid::Common
+{
+class LapTelemetryView;
+
+/**
+ * The LapTelemetry stores the log points of a lap column wise.
+ * Every log point attribute is stored in its own contiguous array (latitude, longitude, velocity,
+ * time and date). Additional channels like heading or lean angle can be added by name, every
+ * channel has one float value per log point. The columns are exposed as spans, so analysis passes
+ * can iterate over a single attribute without touching the other attributes.
+ * The columns can be allocated from a memory resource, e.g. a @ref SessionArena, so all log points of a
+ * loaded session are stored in a few large blocks. Copies are always allocated from the default resource.
+ */
+class LapTelemetry final
+{
+public:
+    /**
+     * Creates an empty LapTelemetry.
+     */
+    LapTelemetry();
+
+    /**
+     * Creates an empty LapTelemetry whose columns are allocated from the memory resource.
+     * The LapTelemetry holds a reference to the resource, so the resource lives as long as the columns.
+     * @param resource The memory resource for the columns, nullptr selects the default resource.
+     */
+    explicit LapTelemetry(std::shared_ptr<std::pmr::memory_resource> resource);
+
+    /**
+     * Default destructor
+     */
+    ~LapTelemetry();
+
+    /**
+     * Copy constructor for LapTelemetry
+     * @param other The object to copy from.
+     */
+    LapTelemetry(LapTelemetry const& other);
+
+    /**
+     * The copy assignment operator for LapTelemetry.
+     * The log points are copied into the memory resource of this telemetry.
+     * @param other The object to copy from.
+     * @return LapTelemetry& A reference to the copied telemetry.
+     */
+    LapTelemetry& operator=(LapTelemetry const& other);
+
+    /**
+     * Move constructor for LapTelemetry
+     * The moved from telemetry is empty and allocates from the default resource.
+     * @param other The object to move from.
+     */
+    LapTelemetry(LapTelemetry&& other) noexcept;
+
+    /**
+     * The move assignment operator for the LapTelemetry.
+     * The columns and the memory resource of the other telemetry are taken over without copy. The moved from
+     * telemetry is empty and allocates from the default resource.
+     * @param other The object to move from.
+     * @return LapTelemetry& A reference to the moved telemetry.
+     */
+    LapTelemetry& operator=(LapTelemetry&& other) noexcept;
+
+    /**
+     * Creates a LapTelemetry from a list of positions.
+     * @param positions The positions in the order of the log points.
+     * @return The created LapTelemetry.
+     */
+    static LapTelemetry fromPositions(std::span<GpsPositionData const> positions);
+
+    /**
+     * Reserves memory for the given amount of log points in every column.
+     * @param capacity The amount of log points.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * Gives the memory resource the columns are allocated from.
+     * @return The memory resource of the columns.
+     */
+    [[nodiscard]] std::pmr::memory_resource* getMemoryResource() const noexcept;
+
+    /**
+     * Gives the number of log points.
+     * @return The number of log points.
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * Checks if the telemetry contains log points.
+     * @return true The telemetry has no log points.
+     * @return false The telemetry has at least one log point.
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * Gives the revision of the log points. Every modification gives the telemetry a new revision, a copy has the
+     * revision of the original. So values derived from the log points can be cached by the revision.
+     * @return The revision of the log points.
+     */
+    [[nodiscard]] std::uint64_t getRevision() const noexcept;
+
+    /**
+     * Removes all log points. The channels stay registered.
+     */
+    void clear() noexcept;
+
+    /**
+     * Appends a log point at the end of the telemetry.
+     * The additional channels get the value 0 for this log point.
+     * @param position The log point that shall be added.
+     */
+    void append(GpsPositionData const& position);
+
+    /**
+     * Gives the log point at the given index as GpsPositionData.
+     * @param index The index of the log point, must be smaller than @ref LapTelemetry::size.
+     * @return The log point at the index.
+     */
+    [[nodiscard]] GpsPositionData getPosition(std::size_t index) const noexcept;
+
+    /**
+     * Converts all log points into a list of GpsPositionData.
+     * @return The list with all log points.
+     */
+    [[nodiscard]] std::vector<GpsPositionData> toPositions() const;
+
+    /**
+     * @return The latitudes of all log points.
+     */
+    [[nodiscard]] std::span<float const> getLatitudes() const noexcept;
+
+    /**
+     * @return The longitudes of all log points.
+     */
+    [[nodiscard]] std::span<float const> getLongitudes() const noexcept;
+
+    /**
+     * @return The velocities of all log points in m/s.
+     */
+    [[nodiscard]] std::span<double const> getVelocities() const noexcept;
+
+    /**
+     * @return The times of all log points.
+     */
+    [[nodiscard]] std::span<Timestamp const> getTimes() const noexcept;
+
+    /**
+     * @return The dates of all log points.
+     */
+    [[nodiscard]] std::span<Date const> getDates() const noexcept;
+
+    /**
+     * Adds an additional channel. The channel gets the value 0 for all existing log points.
+     * @param name The unique name of the channel.
+     * @return true The channel is added.
+     * @return false A channel with the name already exists.
+     */
+    bool addChannel(std::string const& name);
+
+    /**
+     * Checks if a channel with the name exists.
+     * @param name The name of the channel.
+     * @return true The channel exists.
+     * @return false The channel doesn't exist.
+     */
+    [[nodiscard]] bool hasChannel(std::string_view name) const noexcept;
+
+    /**
+     * Gives the names of all additional channels in the order they were added.
+     * @return The names of the channels.
+     */
+    [[nodiscard]] std::vector<std::string> getChannelNames() const;
+
+    /**
+     * Gives the values of a channel.
+     * @param name The name of the channel.
+     * @return The values of the channel or an empty span when the channel doesn't exist.
+     */
+    [[nodiscard]] std::span<float const> getChannel(std::string_view name) const noexcept;
+
+    /**
+     * Replaces the values of a channel.
+     * @param name The name of the channel.
+     * @param values The new values, one per log point.
+     * @return true The values are replaced.
+     * @return false The channel doesn't exist or the number of values doesn't match the log points.
+     */
+    bool setChannel(std::string_view name, std::span<float const> values) noexcept;
+
+    /**
+     * Sets the value of a channel for a single log point.
+     * @param name The name of the channel.
+     * @param index The index of the log point.
+     * @param value The new value.
+     * @return true The value is set.
+     * @return false The channel or the log point doesn't exist.
+     */
+    bool setChannelValue(std::string_view name, std::size_t index, float value) noexcept;
+
+    /**
+     * Gives a view on all log points.
+     * @return The view on the telemetry.
+     */
+    [[nodiscard]] LapTelemetryView getView() const noexcept;
+
+    /**
+     * Gives a view on a range of log points without copying them.
+     * The range is clamped to the available log points.
+     * @param offset The index of the first log point of the view.
+     * @param count The number of log points of the view.
+     * @return The view on the range.
+     */
+    [[nodiscard]] LapTelemetryView slice(std::size_t offset, std::size_t count) const noexcept;
+
+    /**
+     * Equal operator
+     * @return true The two objects are the same.
+     * @return false The two objects are not the same.
+     */
+    friend bool operator==(LapTelemetry const& lhs, LapTelemetry const& rhs);
+
+    /**
+     * Not Equal operator
+     * @return true The two objects are not the same.
+     * @return false The two objects are the same.
+     */
+    friend bool operator!=(LapTelemetry const& lhs, LapTelemetry const& rhs);
+
+private:
+    /**
+     * The allocator of the columns. Unlike std::pmr::polymorphic_allocator the allocator is taken over on move
+     * assignment, so moved columns keep their memory resource and a moved from column can be put back on the default
+     * resource. Copies are allocated from the default resource.
+     */
+    template <typename T>
+    class ColumnAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        ColumnAllocator() noexcept = default;
+
+        ColumnAllocator(std::pmr::memory_resource* resource) noexcept // NOLINT(google-explicit-constructor)
+            : mResource{resource}
+        {
+        }
+
+        template <typename U>
+        ColumnAllocator(ColumnAllocator<U> const& other) noexcept // NOLINT(google-explicit-constructor)
+            : mResource{other.resource()}
+        {
+        }
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(mResource->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* pointer, std::size_t count) noexcept
+        {
+            mResource->deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        std::pmr::memory_resource* resource() const noexcept
+        {
+            return mResource;
+        }
+
+        ColumnAllocator select_on_container_copy_construction() const noexcept
+        {
+            return ColumnAllocator{};
+        }
+
+        template <typename U>
+        bool operator==(ColumnAllocator<U> const& other) const noexcept
+        {
+            return mResource->is_equal(*other.resource());
+        }
+
+    private:
+        std::pmr::memory_resource* mResource{std::pmr::get_default_resource()};
+    };
+
+    template <typename T>
+    using Column = std::vector<T, ColumnAllocator<T>>;
+
+    struct Channel
+    {
+        std::string name;
+        Column<float> values;
+
+        friend bool operator==(Channel const& lhs, Channel const& rhs) = default;
+    };
+
+    Channel const* findChannel(std::string_view name) const noexcept;
+    Channel* findChannel(std::string_view name) noexcept;
+    void resetColumns() noexcept;
+    static std::uint64_t createRevision() noexcept;
+
+private:
+    // The resource is declared first, so it's released after the columns.
+    std::shared_ptr<std::pmr::memory_resource> mResource;
+    Column<float> mLatitudes;
+    Column<float> mLongitudes;
+    Column<double> mVelocities;
+    Column<Timestamp> mTimes;
+    Column<Date> mDates;
+    std::vector<Channel> mChannels;
+    std::uint64_t mRevision{createRevision()};
+};
+
+/**
+ * A non owning view on a range of log points of a @ref LapTelemetry.
+ * The view is only valid as long as the viewed telemetry is alive and not modified.
+ */
+class LapTelemetryView final
+{
+public:
+    /**
+     * Creates an empty view.
+     */
+    constexpr LapTelemetryView() noexcept = default;
+
+    /**
+     * Creates a view on a range of log points.
+     * @param telemetry The viewed telemetry.
+     * @param offset The index of the first log point.
+     * @param count The number of log points.
+     */
+    LapTelemetryView(LapTelemetry const& telemetry, std::size_t offset, std::size_t count) noexcept;
+
+    /**
+     * @return The number of log points in the view.
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @return true The view has no log points.
+     * @return false The view has at least one log point.
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * Gives the log point at the index relative to the begin of the view.
+     * @param index The index of the log point, must be smaller than @ref LapTelemetryView::size.
+     * @return The log point at the index.
+     */
+    [[nodiscard]] GpsPositionData getPosition(std::size_t index) const noexcept;
+
+    /**
+     * @return The latitudes of the log points of the view.
+     */
+    [[nodiscard]] std::span<float const> getLatitudes() const noexcept;
+
+    /**
+     * @return The longitudes of the log points of the view.
+     */
+    [[nodiscard]] std::span<float const> getLongitudes() const noexcept;
+
+    /**
+     * @return The velocities of the log points of the view in m/s.
+     */
+    [[nodiscard]] std::span<double const> getVelocities() const noexcept;
+
+    /**
+     * @return The times of the log points of the view.
+     */
+    [[nodiscard]] std::span<Timestamp const> getTimes() const noexcept;
+
+    /**
+     * @return The dates of the log points of the view.
+     */
+    [[nodiscard]] std::span<Date const> getDates() const noexcept;
+
+    /**
+     * Gives the values of a channel for the log points of the view.
+     * @param name The name of the channel.
+     * @return The values of the channel or an empty span when the channel doesn't exist.
+     */
+    [[nodiscard]] std::span<float const> getChannel(std::string_view name) const noexcept;
+
+    /**
+     * Gives a view on a sub range of this view.
+     * The range is clamped to the log points of this view.
+     * @param offset The index of the first log point relative to the begin of this view.
+     * @param count The number of log points.
+     * @return The view on the sub range.
+     */
+    [[nodiscard]] LapTelemetryView slice(std::size_t offset, std::size_t count) const noexcept;
+
+private:
+    template <typename T>
+    std::span<T const> view(std::span<T const> column) const noexcept
+    {
+        return column.subspan(mOffset, mCount);
+    }
+
+private:
+    LapTelemetry const* mTelemetry{nullptr};
+    std::size_t mOffset{0};
+    std::size_t mCount{0};
+};
+
+} // namespace Rapid::Common
+
+#endif // !RAPID_COMMON_LAPTELEMETRY_HPP
@@ -4,98 +4,132 @@
 
 #pragma once
 
-#include "SharedDataPointer.hpp"
+#include <limits>
 
 namespace Rapid::Common
 {
 
-class SharedPositionData;
+/**
+ * A geographic position given by latitude and longitude.
+ * The PositionData is a small trivially copyable value type, the values are stored inline and
+ * copying an instance never allocates.
+ */
 class PositionData final
 {
 public:
     /**
      * Creates an instance of PositionData.
      */
-    PositionData();
+    constexpr PositionData() noexcept = default;
 
     /**
      * Creates a PositionData instance with given latitude and longitude.
      * @param latitude The latitude of the PositionData.
      * @param longitude The longitude of the PositionData.
      */
-    PositionData(float latitude, float longitude);
+    constexpr PositionData(float latitude, float longitude) noexcept
+        : mLatitude{latitude}
+        , mLongitude{longitude}
+    {
+    }
 
     /**
      * Default destructor.
      */
-    ~PositionData();
+    constexpr ~PositionData() = default;
 
     /**
      * Copy constructor for PositionData.
      * @param other The object to copy from.
      */
-    PositionData(PositionData const& other);
+    constexpr PositionData(PositionData const& other) noexcept = default;
 
     /**
      * Copy assignment operator for PositionData.
      * @param other The object to copy from.
      * @return PositionData& A reference to the copied instance.
      */
-    PositionData& operator=(PositionData const& other);
+    constexpr PositionData& operator=(PositionData const& other) noexcept = default;
 
     /**
      * The move constructor for PositionData.
      * @param other The object to move from.
      */
-    PositionData(PositionData&& other);
+    constexpr PositionData(PositionData&& other) noexcept = default;
 
     /**
      * The move assignment operator for PositionData.
      * @param other The object to move from.
      * @return PositionData& A reference of the moved instance.
      */
-    PositionData& operator=(PositionData&& other);
+    constexpr PositionData& operator=(PositionData&& other) noexcept = default;
 
     /**
      * Gives the latitude.
      * @return float The latitude.
      */
-    float getLatitude() const;
+    constexpr float getLatitude() const noexcept
+    {
+        return mLatitude;
+    }
 
     /**
      * Sets a new latitude value.
      * @param latitude The Latitude value.
      */
-    void setLatitude(float latitude);
+    constexpr void setLatitude(float latitude) noexcept
+    {
+        mLatitude = latitude;
+    }
 
     /**
      * Gives the longitude.
      * @return float The longitude.
      */
-    float getLongitude() const;
+    constexpr float getLongitude() const noexcept
+    {
+        return mLongitude;
+    }
 
     /**
      * Sets a new longitude value.
      * @param longitude The new longitude value.
      */
-    void setLongitude(float longitude);
+    constexpr void setLongitude(float longitude) noexcept
+    {
+        mLongitude = longitude;
+    }
 
     /**
      * Equal operator
      * @return true The two objects are the same.
      * @return false The two objects are not the same.
      */
-    friend bool operator==(PositionData const& lhs, PositionData const& rhs);
+    friend constexpr bool operator==(PositionData const& lhs, PositionData const& rhs) noexcept
+    {
+        return isNearlyEqual(lhs.mLatitude, rhs.mLatitude) && isNearlyEqual(lhs.mLongitude, rhs.mLongitude);
+    }
 
     /**
      * Not Equal operator
      * @return true The two objects are not the same.
      * @return false The two objects are the same.
      */
-    friend bool operator!=(PositionData const& lhs, PositionData const& rhs);
+    friend constexpr bool operator!=(PositionData const& lhs, PositionData const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
 
 private:
-    SharedDataPointer<SharedPositionData> mData;
+    static constexpr bool isNearlyEqual(float lhs, float rhs) noexcept
+    {
+        auto const delta = lhs < rhs ? rhs - lhs : lhs - rhs;
+        return delta < std::numeric_limits<float>::epsilon();
+    }
+
+private:
+    float mLatitude{0.0f};
+    float mLongitude{0.0f};
 };
 
 } // namespace Rapid::Common
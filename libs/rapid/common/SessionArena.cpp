@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "SessionArena.hpp"
+
+namespace Rapid::Common
+{
+
+std::shared_ptr<SessionArena> SessionArena::create(std::size_t initialSize)
+{
+    return std::make_shared<SessionArena>(initialSize);
+}
+
+SessionArena::SessionArena(std::size_t initialSize)
+    : mResource{initialSize}
+{
+}
+
+SessionArena::~SessionArena() = default;
+
+std::size_t SessionArena::getAllocatedBytes() const noexcept
+{
+    std::lock_guard<std::mutex> const guard{mMutex};
+    return mAllocatedBytes;
+}
+
+void* SessionArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    std::lock_guard<std::mutex> const guard{mMutex};
+    auto* memory = mResource.allocate(bytes, alignment);
+    mAllocatedBytes += bytes;
+    return memory;
+}
+
+void SessionArena::do_deallocate(void* /*pointer*/, std::size_t /*bytes*/, std::size_t /*alignment*/)
+{
+    // The memory is released with the arena.
+}
+
+bool SessionArena::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace Rapid::Common
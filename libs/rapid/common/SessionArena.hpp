@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_SESSIONARENA_HPP
+#define RAPID_COMMON_SESSIONARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+namespace Rapid::Common
+{
+
+/**
+ * A memory resource for the log points of a loaded session.
+ * The arena requests large blocks from the heap and hands out memory from these blocks. Freeing memory
+ * is a no-op, all blocks are released at once when the arena is destroyed. Every @ref LapTelemetry
+ * that allocates from the arena holds a reference to it, so the arena is released with the last lap.
+ * The arena is thread safe.
+ */
+class SessionArena final : public std::pmr::memory_resource
+{
+public:
+    /**
+     * The size of the first block in byte.
+     */
+    static constexpr auto DefaultBlockSize = std::size_t{64 * 1024};
+
+    /**
+     * Creates a shared arena.
+     * @param initialSize The size of the first block in byte, every further block is bigger.
+     * @return The arena.
+     */
+    static std::shared_ptr<SessionArena> create(std::size_t initialSize = DefaultBlockSize);
+
+    /**
+     * Creates an arena.
+     * @param initialSize The size of the first block in byte, every further block is bigger.
+     */
+    explicit SessionArena(std::size_t initialSize = DefaultBlockSize);
+
+    /**
+     * Releases all blocks of the arena.
+     */
+    ~SessionArena() override;
+
+    /**
+     * Deleted copy constructor
+     */
+    SessionArena(SessionArena const& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    SessionArena& operator=(SessionArena const& other) = delete;
+
+    /**
+     * Deleted move constructor
+     */
+    SessionArena(SessionArena&& other) = delete;
+
+    /**
+     * Deleted move assignment operator
+     */
+    SessionArena& operator=(SessionArena&& other) = delete;
+
+    /**
+     * Gives the amount of memory that is handed out by the arena.
+     * @return The handed out memory in byte.
+     */
+    std::size_t getAllocatedBytes() const noexcept;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override;
+
+    std::mutex mutable mMutex;
+    std::pmr::monotonic_buffer_resource mResource;
+    std::size_t mAllocatedBytes{0};
+};
+
+} // namespace Rapid::Common
+
+#endif // !RAPID_COMMON_SESSIONARENA_HPP
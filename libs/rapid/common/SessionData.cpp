@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "SessionData.hpp"
+#include <algorithm>
+#include <iterator>
 
 namespace Rapid::Common
 {
@@ -30,6 +32,13 @@ SessionData::SessionData(TrackData const& track, Date const& sessionDate, Timest
 {
 }
 
+SessionData::SessionData(SessionMetaData const& metaData, std::vector<LapData> laps)
+    : SessionMetaData{metaData}
+    , mData{new SharedSessionData}
+{
+    mData->mLaps = std::move(laps);
+}
+
 SessionData::~SessionData() = default;
 SessionData::SessionData(SessionData const& other) = default;
 SessionData& SessionData::operator=(SessionData const& other) = default;
@@ -67,6 +76,35 @@ void SessionData::addLaps(std::vector<LapData> const& laps)
     }
 }
 
+void SessionData::addLap(LapData&& lap)
+{
+    mData->mLaps.push_back(std::move(lap));
+}
+
+void SessionData::addLaps(std::vector<LapData>&& laps)
+{
+    if (mData.constData()->mLaps.empty()) {
+        mData->mLaps = std::move(laps);
+        return;
+    }
+
+    mData->mLaps.reserve(mData.constData()->mLaps.size() + laps.size());
+    std::move(laps.begin(), laps.end(), std::back_inserter(mData->mLaps));
+}
+
+std::vector<LapData> SessionData::releaseLaps()
+{
+    if (mData.getRefCount() > 1) {
+        auto laps = mData.constData()->mLaps;
+        mData = SharedDataPointer<SharedSessionData>{new SharedSessionData};
+        return laps;
+    }
+
+    auto laps = std::move(mData->mLaps);
+    mData->mLaps.clear();
+    return laps;
+}
+
 bool operator==(SessionData const& lhs, SessionData const& rhs)
 {
     return lhs.mData == rhs.mData || *lhs.mData == *rhs.mData;
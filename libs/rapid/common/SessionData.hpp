@@ -29,6 +29,13 @@ public:
      */
     SessionData(TrackData const& track, Date const& sessionDate, Timestamp const& sessionTime, std::size_t id = 0);
 
+    /**
+     * Creates SessionData instance with laps, the laps are taken over without copy.
+     * @param metaData The meta data of the session.
+     * @param laps The laps of the session.
+     */
+    SessionData(SessionMetaData const& metaData, std::vector<LapData> laps);
+
     /**
      * Default destructor
      */
@@ -85,12 +92,32 @@ public:
      */
     void addLap(LapData const& lap);
 
+    /**
+     * Adds a new lap to the session and takes over the lap.
+     * @param lapData The lap that shall be added.
+     */
+    void addLap(LapData&& lap);
+
     /**
      * Adds the list of laps to the session.
      * @param laps The list of laps that shall be added.
      */
     void addLaps(std::vector<LapData> const& laps);
 
+    /**
+     * Adds the list of laps to the session and takes over the laps.
+     * @param laps The list of laps that shall be added.
+     */
+    void addLaps(std::vector<LapData>&& laps);
+
+    /**
+     * Removes all laps from the session and gives them to the caller.
+     * The list is moved out when the session is the only owner, otherwise the laps are shared with the
+     * other owners.
+     * @return The laps of the session.
+     */
+    [[nodiscard]] std::vector<LapData> releaseLaps();
+
     /**
      * Equal operator
      * @return true The two objects are the same.
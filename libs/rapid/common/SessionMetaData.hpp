@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Date.hpp"
+#include "SharedDataPointer.hpp"
 #include "Timestamp.hpp"
 #include "TrackData.hpp"
 
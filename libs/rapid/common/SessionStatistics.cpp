@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "SessionStatistics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Rapid::Common
+{
+
+SessionStatistics::SessionStatistics(std::size_t rollingWindow)
+    : mRollingLaptimes(std::max(rollingWindow, std::size_t{1}), 0)
+{
+}
+
+SessionStatistics SessionStatistics::fromSession(SessionData const& session, std::size_t rollingWindow)
+{
+    auto statistics = SessionStatistics{rollingWindow};
+    for (auto const& lap : session.getLaps()) {
+        statistics.addLap(lap);
+    }
+    return statistics;
+}
+
+void SessionStatistics::addLap(LapData const& lap)
+{
+    auto const& sectorTimes = lap.getSectorTimes();
+    if (sectorTimes.empty()) {
+        return;
+    }
+
+    auto const laptime = lap.getLaptime();
+    mLastLapPersonalBest = (mLapCount == 0) || (laptime < mBestLaptime);
+    if (mLastLapPersonalBest) {
+        mBestLaptime = laptime;
+        mBestLapIndex = mLapCount;
+    }
+
+    mLastSectorsPersonalBest.assign(sectorTimes.size(), false);
+    for (std::size_t index = 0; index < sectorTimes.size(); ++index) {
+        if (index >= mBestSectorTimes.size()) {
+            mBestSectorTimes.push_back(sectorTimes[index]);
+            mLastSectorsPersonalBest[index] = true;
+        } else if (sectorTimes[index] < mBestSectorTimes[index]) {
+            mBestSectorTimes[index] = sectorTimes[index];
+            mLastSectorsPersonalBest[index] = true;
+        }
+    }
+
+    auto const milliseconds = laptime.toMilliseconds();
+    auto& rollingSlot = mRollingLaptimes[mLapCount % mRollingLaptimes.size()];
+    mRollingSum += milliseconds - rollingSlot;
+    rollingSlot = milliseconds;
+
+    ++mLapCount;
+    auto const difference = static_cast<double>(milliseconds) - mMean;
+    mMean += difference / static_cast<double>(mLapCount);
+    mSquaredDifferences += difference * (static_cast<double>(milliseconds) - mMean);
+}
+
+std::size_t SessionStatistics::getLapCount() const noexcept
+{
+    return mLapCount;
+}
+
+std::optional<Timestamp> SessionStatistics::getBestLaptime() const noexcept
+{
+    if (mLapCount == 0) {
+        return std::nullopt;
+    }
+    return mBestLaptime;
+}
+
+std::optional<std::size_t> SessionStatistics::getBestLapIndex() const noexcept
+{
+    if (mLapCount == 0) {
+        return std::nullopt;
+    }
+    return mBestLapIndex;
+}
+
+std::span<Timestamp const> SessionStatistics::getBestSectorTimes() const noexcept
+{
+    return mBestSectorTimes;
+}
+
+std::optional<Timestamp> SessionStatistics::getTheoreticalBestLaptime() const noexcept
+{
+    if (mLapCount == 0) {
+        return std::nullopt;
+    }
+    return std::accumulate(mBestSectorTimes.cbegin(), mBestSectorTimes.cend(), Timestamp{});
+}
+
+std::optional<Timestamp> SessionStatistics::getAverageLaptime() const noexcept
+{
+    if (mLapCount == 0) {
+        return std::nullopt;
+    }
+    return Timestamp::fromMilliseconds(std::llround(mMean));
+}
+
+std::optional<Timestamp> SessionStatistics::getRollingAverageLaptime() const noexcept
+{
+    if (mLapCount == 0) {
+        return std::nullopt;
+    }
+    auto const count = std::min(mLapCount, mRollingLaptimes.size());
+    return Timestamp::fromMilliseconds(
+        std::llround(static_cast<double>(mRollingSum) / static_cast<double>(count)));
+}
+
+std::optional<Timestamp> SessionStatistics::getLaptimeStandardDeviation() const noexcept
+{
+    if (mLapCount < 2) {
+        return std::nullopt;
+    }
+    auto const variance = mSquaredDifferences / static_cast<double>(mLapCount - 1);
+    return Timestamp::fromMilliseconds(std::llround(std::sqrt(variance)));
+}
+
+bool SessionStatistics::isLastLapPersonalBest() const noexcept
+{
+    return mLastLapPersonalBest;
+}
+
+bool SessionStatistics::isLastSectorPersonalBest(std::size_t index) const noexcept
+{
+    return index < mLastSectorsPersonalBest.size() && mLastSectorsPersonalBest[index];
+}
+
+} // namespace Rapid::Common
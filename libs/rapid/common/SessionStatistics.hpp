@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_SESSIONSTATISTICS_HPP
+#define RAPID_COMMON_SESSIONSTATISTICS_HPP
+
+#include "LapData.hpp"
+#include "SessionData.hpp"
+#include "Timestamp.hpp"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Rapid::Common
+{
+
+/**
+ * The SessionStatistics aggregates the lap and sector times of a session.
+ * The statistics are updated incrementally with every finished lap in O(number of sectors), so they can be
+ * kept up to date during an active session. Laps without sector times aren't counted.
+ * The statistics are:
+ * - The best lap and the best time of every sector.
+ * - The theoretical best lap, the sum of the best sector times.
+ * - The average and the rolling average of the last laps.
+ * - The consistency as standard deviation of the laptimes.
+ * - Whether the last lap and its sectors are personal bests.
+ */
+class SessionStatistics final
+{
+public:
+    /**
+     * The default number of laps of the rolling average.
+     */
+    static constexpr std::size_t DefaultRollingWindow = 5;
+
+    /**
+     * Creates empty statistics.
+     * @param rollingWindow The number of laps of the rolling average, at least one lap is used.
+     */
+    explicit SessionStatistics(std::size_t rollingWindow = DefaultRollingWindow);
+
+    /**
+     * Calculates the statistics of all laps of a stored session in one pass.
+     * @param session The session whose laps are aggregated.
+     * @param rollingWindow The number of laps of the rolling average.
+     * @return The statistics of the session.
+     */
+    static SessionStatistics fromSession(SessionData const& session, std::size_t rollingWindow = DefaultRollingWindow);
+
+    /**
+     * Adds a finished lap to the statistics.
+     * @param lap The finished lap with its sector times.
+     */
+    void addLap(LapData const& lap);
+
+    /**
+     * Gives the number of counted laps.
+     * @return The number of laps.
+     */
+    [[nodiscard]] std::size_t getLapCount() const noexcept;
+
+    /**
+     * Gives the best laptime.
+     * @return The best laptime or std::nullopt when no lap is counted.
+     */
+    [[nodiscard]] std::optional<Timestamp> getBestLaptime() const noexcept;
+
+    /**
+     * Gives the index of the best lap in the order the laps were added.
+     * @return The index of the best lap or std::nullopt when no lap is counted.
+     */
+    [[nodiscard]] std::optional<std::size_t> getBestLapIndex() const noexcept;
+
+    /**
+     * Gives the best time of every sector.
+     * @return The best sector times by sector index.
+     */
+    [[nodiscard]] std::span<Timestamp const> getBestSectorTimes() const noexcept;
+
+    /**
+     * Gives the theoretical best lap, the sum of the best sector times.
+     * @return The theoretical best laptime or std::nullopt when no lap is counted.
+     */
+    [[nodiscard]] std::optional<Timestamp> getTheoreticalBestLaptime() const noexcept;
+
+    /**
+     * Gives the average laptime of all laps.
+     * @return The average laptime or std::nullopt when no lap is counted.
+     */
+    [[nodiscard]] std::optional<Timestamp> getAverageLaptime() const noexcept;
+
+    /**
+     * Gives the average laptime of the last laps of the rolling window.
+     * @return The rolling average or std::nullopt when no lap is counted.
+     */
+    [[nodiscard]] std::optional<Timestamp> getRollingAverageLaptime() const noexcept;
+
+    /**
+     * Gives the consistency of the laps as the standard deviation of the laptimes.
+     * @return The standard deviation or std::nullopt when less than two laps are counted.
+     */
+    [[nodiscard]] std::optional<Timestamp> getLaptimeStandardDeviation() const noexcept;
+
+    /**
+     * Checks if the last added lap is the best lap.
+     * @return true The last lap is a personal best.
+     * @return false The last lap isn't a personal best or no lap is counted.
+     */
+    [[nodiscard]] bool isLastLapPersonalBest() const noexcept;
+
+    /**
+     * Checks if a sector of the last added lap is the best time of this sector.
+     * @param index The index of the sector.
+     * @return true The sector is a personal best.
+     * @return false The sector isn't a personal best or doesn't exist.
+     */
+    [[nodiscard]] bool isLastSectorPersonalBest(std::size_t index) const noexcept;
+
+    /**
+     * Equal operator
+     * @return true The two objects are the same.
+     * @return false The two objects are not the same.
+     */
+    friend bool operator==(SessionStatistics const& lhs, SessionStatistics const& rhs) = default;
+
+private:
+    std::size_t mLapCount{0};
+    std::size_t mBestLapIndex{0};
+    Timestamp mBestLaptime;
+    std::vector<Timestamp> mBestSectorTimes;
+    bool mLastLapPersonalBest{false};
+    std::vector<bool> mLastSectorsPersonalBest;
+
+    // The mean and the sum of the squared differences to the mean in milliseconds (Welford's algorithm).
+    double mMean{0.0};
+    double mSquaredDifferences{0.0};
+
+    std::vector<std::int64_t> mRollingLaptimes;
+    std::int64_t mRollingSum{0};
+};
+
+} // namespace Rapid::Common
+
+#endif // !RAPID_COMMON_SESSIONSTATISTICS_HPP
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "SessionView.hpp"
+#include <mutex>
+#include <spdlog/spdlog.h>
+
+namespace Rapid::Common
+{
+
+class SharedSessionView : public SharedData
+{
+public:
+    struct TelemetryCache
+    {
+        std::mutex mMutex;
+        std::vector<std::shared_ptr<LapTelemetry const>> mTelemetry;
+    };
+
+    std::vector<LapData> mLaps;
+    SessionView::TelemetryLoader mLoader;
+    std::shared_ptr<TelemetryCache> mCache = std::make_shared<TelemetryCache>();
+};
+
+SessionView::SessionView()
+    : SessionMetaData{}
+    , mData{new SharedSessionView}
+{
+}
+
+SessionView::SessionView(SessionMetaData const& metaData, std::vector<LapData> laps, TelemetryLoader loader)
+    : SessionMetaData{metaData}
+    , mData{new SharedSessionView}
+{
+    mData->mLaps.reserve(laps.size());
+    for (auto const& lap : laps) {
+        mData->mLaps.emplace_back(lap.getSectorTimes());
+    }
+    mData->mLoader = std::move(loader);
+    mData->mCache->mTelemetry.resize(laps.size());
+}
+
+SessionView::~SessionView() = default;
+SessionView::SessionView(SessionView const& other) = default;
+SessionView& SessionView::operator=(SessionView const& other) = default;
+SessionView::SessionView(SessionView&& other) noexcept = default;
+SessionView& SessionView::operator=(SessionView&& other) noexcept = default;
+
+SessionView SessionView::fromSession(SessionData const& session)
+{
+    return SessionView{session, session.getLaps(), [session](std::size_t lapIndex) -> std::optional<LapTelemetry> {
+                           auto const& laps = session.getLaps();
+                           if (lapIndex >= laps.size()) {
+                               return std::nullopt;
+                           }
+                           return laps[lapIndex].getTelemetry();
+                       }};
+}
+
+std::size_t SessionView::getNumberOfLaps() const noexcept
+{
+    return mData->mLaps.size();
+}
+
+std::optional<LapData> SessionView::getLap(std::size_t index) const noexcept
+{
+    if (index >= mData->mLaps.size()) {
+        return std::nullopt;
+    }
+    return mData->mLaps[index];
+}
+
+std::vector<LapData> const& SessionView::getLaps() const noexcept
+{
+    return mData->mLaps;
+}
+
+std::shared_ptr<LapTelemetry const> SessionView::getTelemetry(std::size_t index) const noexcept
+{
+    if (index >= mData->mLaps.size()) {
+        return nullptr;
+    }
+
+    auto& cache = *mData->mCache;
+    std::lock_guard<std::mutex> const guard{cache.mMutex};
+    if (cache.mTelemetry[index] != nullptr) {
+        return cache.mTelemetry[index];
+    }
+
+    try {
+        auto telemetry = mData->mLoader ? mData->mLoader(index) : std::nullopt;
+        if (!telemetry.has_value()) {
+            SPDLOG_ERROR("Failed to load the telemetry of lap {}", index);
+            return nullptr;
+        }
+        cache.mTelemetry[index] = std::make_shared<LapTelemetry const>(std::move(telemetry.value()));
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to load the telemetry of lap {}. Error: {}", index, e.what());
+        return nullptr;
+    }
+    return cache.mTelemetry[index];
+}
+
+bool SessionView::isTelemetryLoaded(std::size_t index) const noexcept
+{
+    if (index >= mData->mLaps.size()) {
+        return false;
+    }
+
+    auto& cache = *mData->mCache;
+    std::lock_guard<std::mutex> const guard{cache.mMutex};
+    return cache.mTelemetry[index] != nullptr;
+}
+
+std::optional<LapData> SessionView::loadLap(std::size_t index) const noexcept
+{
+    auto telemetry = getTelemetry(index);
+    if (telemetry == nullptr) {
+        return std::nullopt;
+    }
+
+    try {
+        auto lap = mData->mLaps[index];
+        lap.setTelemetry(*telemetry);
+        return lap;
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to create lap {}. Error: {}", index, e.what());
+        return std::nullopt;
+    }
+}
+
+std::optional<SessionData> SessionView::toSessionData() const noexcept
+{
+    try {
+        auto laps = std::vector<LapData>{};
+        laps.reserve(getNumberOfLaps());
+        for (std::size_t index = 0; index < getNumberOfLaps(); ++index) {
+            auto lap = loadLap(index);
+            if (!lap.has_value()) {
+                return std::nullopt;
+            }
+            laps.push_back(std::move(lap.value()));
+        }
+        return SessionData{*this, std::move(laps)};
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to create the session. Error: {}", e.what());
+        return std::nullopt;
+    }
+}
+
+} // namespace Rapid::Common
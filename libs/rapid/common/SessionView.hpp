@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_SESSIONVIEW_HPP
+#define RAPID_COMMON_SESSIONVIEW_HPP
+
+#include "SessionData.hpp"
+#include <functional>
+#include <memory>
+
+namespace Rapid::Common
+{
+
+class SharedSessionView;
+
+/**
+ * A session whose lap telemetry is loaded on demand.
+ * The SessionView holds the meta data and the lap and sector times of all laps, these are available
+ * immediately. The log points of a lap are requested from the loader callback on the first access
+ * and cached for all further accesses, also in copies of the view. This way a long session can be
+ * listed without reading all log points.
+ * The view is immutable, copies share the laps and the telemetry cache. All functions are thread safe.
+ */
+class SessionView final : public SessionMetaData
+{
+public:
+    /**
+     * The callback that loads the telemetry of a lap.
+     * @param lapIndex The index of the lap in the session.
+     * @return The telemetry of the lap or std::nullopt when it couldn't be loaded.
+     */
+    using TelemetryLoader = std::function<std::optional<LapTelemetry>(std::size_t lapIndex)>;
+
+    /**
+     * Creates an empty SessionView without laps.
+     */
+    SessionView();
+
+    /**
+     * Creates a SessionView.
+     * @param metaData The meta data of the session.
+     * @param laps The laps with lap and sector times, the telemetry of these laps is ignored.
+     * @param loader The callback that loads the telemetry of a lap.
+     */
+    SessionView(SessionMetaData const& metaData, std::vector<LapData> laps, TelemetryLoader loader);
+
+    /**
+     * Default destructor
+     */
+    ~SessionView();
+
+    /**
+     * Copy constructor for SessionView
+     * @param other The object to copy from.
+     */
+    SessionView(SessionView const& other);
+
+    /**
+     * The copy assignment operator for SessionView.
+     * @param other The object to copy from.
+     * @return SessionView& A reference to the copied view.
+     */
+    SessionView& operator=(SessionView const& other);
+
+    /**
+     * Move constructor for SessionView
+     * @param other The object to move from.
+     */
+    SessionView(SessionView&& other) noexcept;
+
+    /**
+     * The move assignment operator for the SessionView.
+     * @param other The object to move from.
+     * @return SessionView& A reference to the moved view.
+     */
+    SessionView& operator=(SessionView&& other) noexcept;
+
+    /**
+     * Creates a view of an already loaded session.
+     * The telemetry of the laps is shared with the session and not copied before it's requested.
+     * @param session The loaded session.
+     * @return The view of the session.
+     */
+    static SessionView fromSession(SessionData const& session);
+
+    /**
+     * Gives the number of laps.
+     * @return The number of laps of the session.
+     */
+    std::size_t getNumberOfLaps() const noexcept;
+
+    /**
+     * Gives the lap and sector times of a lap, the lap contains no telemetry.
+     * @param index The index of the lap.
+     * @return The lap or std::nullopt when the index is out of range.
+     */
+    std::optional<LapData> getLap(std::size_t index) const noexcept;
+
+    /**
+     * Gives the lap and sector times of all laps, the laps contain no telemetry.
+     * @return The laps of the session.
+     */
+    std::vector<LapData> const& getLaps() const noexcept;
+
+    /**
+     * Gives the telemetry of a lap. The telemetry is loaded on the first request.
+     * @param index The index of the lap.
+     * @return The telemetry of the lap or nullptr when the index is out of range or the loading failed.
+     */
+    std::shared_ptr<LapTelemetry const> getTelemetry(std::size_t index) const noexcept;
+
+    /**
+     * Checks if the telemetry of a lap is already loaded.
+     * @param index The index of the lap.
+     * @return true The telemetry is loaded.
+     * @return false The telemetry isn't loaded yet.
+     */
+    bool isTelemetryLoaded(std::size_t index) const noexcept;
+
+    /**
+     * Gives the complete lap with the telemetry. The telemetry is loaded on the first request.
+     * @param index The index of the lap.
+     * @return The lap or std::nullopt when the index is out of range or the loading failed.
+     */
+    std::optional<LapData> loadLap(std::size_t index) const noexcept;
+
+    /**
+     * Loads the telemetry of all laps and creates the complete session.
+     * @return The session or std::nullopt when the telemetry of a lap couldn't be loaded.
+     */
+    std::optional<SessionData> toSessionData() const noexcept;
+
+private:
+    SharedDataPointer<SharedSessionView> mData;
+};
+
+} // namespace Rapid::Common
+
+#endif // !RAPID_COMMON_SESSIONVIEW_HPP
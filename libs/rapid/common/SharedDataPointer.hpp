@@ -13,6 +13,7 @@ namespace Rapid::Common
 
 /**
  * Base class for all Copy On Write classes.
+ * The reference count is a 32 bit atomic counter, so the shared data can be shared between threads.
  */
 class SharedData
 {
@@ -26,7 +27,7 @@ public:
     SharedData& operator=(SharedData&&) noexcept = delete;
     SharedData& operator=(SharedData&) = delete;
     virtual ~SharedData() = default;
-    std::atomic_uint8_t ref;
+    std::atomic_uint32_t ref;
 };
 
 /**
@@ -58,7 +59,7 @@ public:
         : mData{data}
     {
         if (mData != nullptr) {
-            mData->ref++;
+            mData->ref.fetch_add(1, std::memory_order_relaxed);
         }
     }
 
@@ -72,8 +73,7 @@ public:
             return;
         }
 
-        mData->ref--;
-        if (mData->ref == 0) {
+        if (mData->ref.fetch_sub(1, std::memory_order_acq_rel) == 1) {
             delete mData;
         }
     }
@@ -82,11 +82,11 @@ public:
      * Copy constructor
      * @param other The other shared data pointer.
      */
-    SharedDataPointer(SharedDataPointer<T> const& other)
+    SharedDataPointer(SharedDataPointer const& other)
         : mData(other.mData)
     {
         if (mData != nullptr) {
-            mData->ref++;
+            mData->ref.fetch_add(1, std::memory_order_relaxed);
         }
     }
 
@@ -95,23 +95,20 @@ public:
      * @param other The other shared data pointer.
      * @return SharedDataPointer& The copied shared data pointer.
      */
-    SharedDataPointer& operator=(SharedDataPointer<T> const& other)
+    SharedDataPointer& operator=(SharedDataPointer const& other)
     {
         if (mData == other.mData or &other == this) {
             return *this;
         }
 
         if (other.mData != nullptr) {
-            other.mData->ref++;
+            other.mData->ref.fetch_add(1, std::memory_order_relaxed);
         }
 
         T* oldData = mData;
         mData = other.mData;
-        if (oldData != nullptr) {
-            oldData->ref--;
-            if (oldData->ref == 0) {
-                delete oldData; // NOLINT(cppcoreguidelines-owning-memory)
-            }
+        if (oldData != nullptr and oldData->ref.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete oldData; // NOLINT(cppcoreguidelines-owning-memory)
         }
 
         return *this;
@@ -121,7 +118,7 @@ public:
      * Move constructor for the SharedDataPointer
      * @param other The object to move from.
      */
-    SharedDataPointer(SharedDataPointer&& other)
+    SharedDataPointer(SharedDataPointer&& other) noexcept
         : mData{std::move(other.mData)}
     {
         other.mData = nullptr;
@@ -132,7 +129,7 @@ public:
      * @param other  The object to move from.
      * @return SharedDataPointer& The moved intialized object.
      */
-    SharedDataPointer<T>& operator=(SharedDataPointer<T>&& other)
+    SharedDataPointer& operator=(SharedDataPointer&& other) noexcept
     {
         SharedDataPointer moved(std::move(other));
         std::swap(moved.mData, mData);
@@ -142,15 +139,25 @@ public:
     /**
      * Gives the reference count of the shared data.
      * If not data is set then the reference count will be 0.
-     * @return std::uint8_t The reference count of the shared data.
+     * @return std::uint32_t The reference count of the shared data.
      */
-    std::uint8_t getRefCount() const
+    std::uint32_t getRefCount() const
     {
         if (mData == nullptr) {
             return 0;
         }
 
-        return mData->ref;
+        return mData->ref.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Provides constant access to the shared data object without detach.
+     * Use this function in non const member functions that only read the shared data.
+     * @return const T* A pointer to the shared object.
+     */
+    T const* constData() const noexcept
+    {
+        return mData;
     }
 
     /**
@@ -207,22 +214,22 @@ public:
         return mData;
     }
 
-    bool operator==(SharedDataPointer<T> const& other) const
+    bool operator==(SharedDataPointer const& other) const
     {
         return mData == other.mData;
     }
 
-    bool operator!=(SharedDataPointer<T> const& other) const
+    bool operator!=(SharedDataPointer const& other) const
     {
         return mData != other.mData;
     }
 
-    bool operator<(SharedDataPointer<T> const& other) const
+    bool operator<(SharedDataPointer const& other) const
     {
         return mData < other.mData;
     }
 
-    bool operator>(SharedDataPointer<T> const& other) const
+    bool operator>(SharedDataPointer const& other) const
     {
         return mData > other.mData;
     }
@@ -239,11 +246,10 @@ private:
             return;
         }
 
-        if (mData->ref > 1) {
+        if (mData->ref.load(std::memory_order_acquire) > 1) {
             T* newData = new T(*mData); // NOLINT(cppcoreguidelines-owning-memory)
-            newData->ref++;
-            mData->ref--;
-            if (mData->ref == 0) {
+            newData->ref.fetch_add(1, std::memory_order_relaxed);
+            if (mData->ref.fetch_sub(1, std::memory_order_acq_rel) == 1) {
                 delete mData;
             }
 
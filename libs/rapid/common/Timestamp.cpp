@@ -3,176 +3,95 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "Timestamp.hpp"
-#include <chrono>
-#include <iomanip>
+#include <array>
+#include <ctime>
 #include <spdlog/spdlog.h>
-#include <sstream>
 
 namespace Rapid::Common
 {
-class SharedTimestamp : public SharedData
+namespace
 {
-public:
-    std::uint8_t hour{0};
-    std::uint8_t minute{0};
-    std::uint8_t second{0};
-    std::uint16_t fractionalOfSecond{0};
-
-    friend bool operator==(SharedTimestamp const& lhs, SharedTimestamp const& rhs)
-    {
-        // clang-format off
-        return ((lhs.hour) == (rhs.hour) &&
-                (lhs.minute) == (rhs.minute) &&
-                (lhs.second) == (rhs.second) &&
-                (lhs.fractionalOfSecond) == (rhs.fractionalOfSecond));
-        // clang-format on
-    }
-
-    friend bool operator<(SharedTimestamp const& lhs, SharedTimestamp const& rhs)
-    {
-        if (lhs.hour != rhs.hour) {
-            return lhs.hour < rhs.hour;
-        } else if (lhs.minute != rhs.minute) {
-            return lhs.minute < rhs.minute;
-        } else if (lhs.second != rhs.minute) {
-            return lhs.second < rhs.second;
-        }
-        return lhs.fractionalOfSecond < rhs.fractionalOfSecond;
-    }
-
-    friend bool operator>(SharedTimestamp const& lhs, SharedTimestamp const& rhs)
-    {
-        return rhs < lhs;
-    }
-};
-
-Timestamp::Timestamp()
-    : mData{new SharedTimestamp{}}
+bool parseNumber(std::string_view& input, std::int64_t& value, char delimiter) noexcept
 {
-}
-
-Timestamp::Timestamp(std::string const& timestampString)
-    : mData{new SharedTimestamp{}}
-{
-    std::istringstream input(timestampString);
-    std::string hour;
-    std::getline(input, hour, ':');
-    std::string minute;
-    std::getline(input, minute, ':');
-    std::string second;
-    std::getline(input, second, '.');
-    std::string fractionalOfSecond;
-    std::getline(input, fractionalOfSecond);
-
-    try {
-        mData->hour = static_cast<std::uint8_t>(std::stoi(hour));
-        mData->minute = static_cast<std::uint8_t>(std::stoi(minute));
-        mData->second = static_cast<std::uint8_t>(std::stoi(second));
-        mData->fractionalOfSecond = static_cast<std::uint16_t>(std::stoi(fractionalOfSecond));
-    } catch (std::invalid_argument const& e) {
-        spdlog::error("Invalid argument passed: {} Error: {}", timestampString, e.what());
-    } catch (std::out_of_range const& e) {
-        spdlog::error("Out of range during converting: {} Error:", timestampString, e.what());
+    auto const* const end = input.data() + input.size();
+    auto const [ptr, error] = std::from_chars(input.data(), end, value);
+    if (error != std::errc{} or value < 0 or ptr == end or *ptr != delimiter) {
+        return false;
     }
+    input.remove_prefix(static_cast<std::size_t>(ptr - input.data()) + 1);
+    return true;
 }
 
-Timestamp::~Timestamp() = default;
-Timestamp::Timestamp(Timestamp const& other) = default;
-Timestamp& Timestamp::operator=(Timestamp const& other) = default;
-Timestamp::Timestamp(Timestamp&& other) = default;
-Timestamp& Timestamp::operator=(Timestamp&& other) = default;
-
-std::uint8_t Timestamp::getHour() const
+char* writeTwoDigits(char* out, std::int64_t value) noexcept
 {
-    return mData->hour;
+    out[0] = static_cast<char>('0' + ((value / 10) % 10));
+    out[1] = static_cast<char>('0' + (value % 10));
+    return out + 2;
 }
+} // namespace
 
-void Timestamp::setHour(std::uint8_t hour)
-{
-    mData->hour = hour;
-}
-
-std::uint8_t Timestamp::getMinute() const
-{
-    return mData->minute;
-}
-
-void Timestamp::setMinute(std::uint8_t minute)
-{
-    mData->minute = minute;
-}
-
-std::uint8_t Timestamp::getSecond() const
+Timestamp::Timestamp(std::string const& timestampString)
 {
-    return mData->second;
+    auto const timestamp = fromString(timestampString);
+    if (not timestamp.has_value()) {
+        spdlog::error("Invalid argument passed: {}", timestampString);
+        return;
+    }
+    mMilliseconds = timestamp->mMilliseconds;
 }
 
-void Timestamp::setSecond(std::uint8_t second)
+std::optional<Timestamp> Timestamp::fromString(std::string_view timestampString) noexcept
 {
-    mData->second = second;
-}
+    auto hour = std::int64_t{0};
+    auto minute = std::int64_t{0};
+    auto second = std::int64_t{0};
+    if (not parseNumber(timestampString, hour, ':') or not parseNumber(timestampString, minute, ':') or
+        not parseNumber(timestampString, second, '.')) {
+        return std::nullopt;
+    }
 
-std::uint16_t Timestamp::getFractionalOfSecond() const
-{
-    return mData->fractionalOfSecond;
-}
+    constexpr auto maxFractionalDigits = std::size_t{3};
+    auto const digits = timestampString.size();
+    if (digits == 0 or digits > maxFractionalDigits) {
+        return std::nullopt;
+    }
+    auto fractional = std::int64_t{0};
+    auto const* const end = timestampString.data() + digits;
+    auto const [ptr, error] = std::from_chars(timestampString.data(), end, fractional);
+    if (error != std::errc{} or ptr != end or fractional < 0) {
+        return std::nullopt;
+    }
+    for (auto digit = digits; digit < maxFractionalDigits; ++digit) {
+        fractional *= 10;
+    }
 
-void Timestamp::setFractionalOfSecond(std::uint16_t fractionalOfSecond)
-{
-    mData->fractionalOfSecond = fractionalOfSecond;
+    return fromMilliseconds((hour * MillisecondsPerHour) + (minute * MillisecondsPerMinute) +
+                            (second * MillisecondsPerSecond) + fractional);
 }
 
 std::string Timestamp::asString() const noexcept
 {
-    std::ostringstream timeAsString;
-
-    // clang-format off
-    timeAsString << std::setw(2) << std::setfill('0') << std::to_string(getHour()) << ":"
-                 << std::setw(2) << std::setfill('0') << std::to_string(getMinute()) << ":"
-                 << std::setw(2) << std::setfill('0') << std::to_string(getSecond()) << "."
-                 << std::setw(3) << std::setfill('0') << std::to_string(getFractionalOfSecond());
-    // clang-format on
-
-    return timeAsString.str();
+    auto buffer = std::array<char, StringLength>{};
+    auto const result = toChars(buffer.data(), buffer.data() + buffer.size());
+    return std::string(buffer.data(), result.ptr);
 }
 
-Timestamp Timestamp::operator+(Timestamp const& rhs) const noexcept
+std::to_chars_result Timestamp::toChars(char* first, char* last) const noexcept
 {
-    std::int32_t time1Msecs = convertToMilliSeconds();
-    std::int32_t time2Msecs = rhs.convertToMilliSeconds();
-    std::int32_t resultMsecs = time1Msecs + time2Msecs;
-
-    std::int32_t resultHour = static_cast<std::int32_t>(resultMsecs / 3.6e6) % 24;
-    std::int32_t resultMinute = static_cast<std::int32_t>(resultMsecs / 6e4) % 60;
-    std::int32_t resultSeconds = static_cast<std::int32_t>(resultMsecs / 1e3) % 60;
-    std::int32_t resultFractional = static_cast<std::int32_t>(resultMsecs) % 1000;
-
-    Timestamp ts;
-    ts.setHour(resultHour);
-    ts.setMinute(resultMinute);
-    ts.setSecond(resultSeconds);
-    ts.setFractionalOfSecond(resultFractional);
-
-    return ts;
-}
-
-Timestamp Timestamp::operator-(Timestamp const& rhs) const noexcept
-{
-    std::int32_t time1Msecs = convertToMilliSeconds();
-    std::int32_t time2Msecs = rhs.convertToMilliSeconds();
-    std::int32_t resultMsecs = time1Msecs - time2Msecs;
-
-    std::int32_t resultHour = static_cast<std::int32_t>(resultMsecs / 3.6e6) % 24;
-    std::int32_t resultMinute = static_cast<std::int32_t>(resultMsecs / 6e4) % 60;
-    std::int32_t resultSeconds = static_cast<std::int32_t>(resultMsecs / 1e3) % 60;
-    std::int32_t resultFractional = static_cast<std::int32_t>(resultMsecs) % 1000;
+    if (last - first < static_cast<std::ptrdiff_t>(StringLength)) {
+        return {last, std::errc::value_too_large};
+    }
 
-    Timestamp result;
-    result.setHour(resultHour < 0 ? 24 + resultHour : resultHour);
-    result.setMinute(resultMinute);
-    result.setSecond(resultSeconds);
-    result.setFractionalOfSecond(resultFractional);
-    return result;
+    auto* out = writeTwoDigits(first, getHour());
+    *out++ = ':';
+    out = writeTwoDigits(out, getMinute());
+    *out++ = ':';
+    out = writeTwoDigits(out, getSecond());
+    *out++ = '.';
+    auto const fractional = getFractionalOfSecond();
+    *out++ = static_cast<char>('0' + (fractional / 100));
+    out = writeTwoDigits(out, fractional);
+    return {out, std::errc{}};
 }
 
 Timestamp Timestamp::getSystemTimestamp()
@@ -183,39 +102,10 @@ Timestamp Timestamp::getSystemTimestamp()
     auto seconds = std::chrono::time_point_cast<std::chrono::seconds>(timeNow);
     auto fraction = std::chrono::duration_cast<std::chrono::milliseconds>(timeNow - seconds);
 
-    auto timestamp = Timestamp{};
-    timestamp.setHour(time->tm_hour);
-    timestamp.setMinute(time->tm_min);
-    timestamp.setSecond(time->tm_sec);
-    timestamp.setFractionalOfSecond(fraction.count());
-
-    return timestamp;
-}
-
-int32_t Timestamp::convertToMilliSeconds() const
-{
-    return static_cast<int32_t>((getHour() * 3.6e6) + (getMinute() * 6.0e4) + (getSecond() * 1e3) +
-                                getFractionalOfSecond());
-}
-
-bool operator==(Timestamp const& lhs, Timestamp const& rhs)
-{
-    return lhs.mData == rhs.mData || *(lhs.mData) == *(rhs.mData);
-}
-
-bool operator!=(Timestamp const& lhs, Timestamp const& rhs)
-{
-    return !(lhs == rhs);
-}
-
-bool operator<(Timestamp const& lhs, Timestamp const& rhs)
-{
-    return *lhs.mData < *rhs.mData;
-}
-
-bool operator>(Timestamp const& lhs, Timestamp const& rhs)
-{
-    return *lhs.mData > *rhs.mData;
+    return Timestamp{static_cast<std::uint8_t>(time->tm_hour),
+                     static_cast<std::uint8_t>(time->tm_min),
+                     static_cast<std::uint8_t>(time->tm_sec),
+                     static_cast<std::uint16_t>(fraction.count())};
 }
 
 } // namespace Rapid::Common
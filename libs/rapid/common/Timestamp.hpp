@@ -4,24 +4,72 @@
 
 #pragma once
 
-#include "SharedDataPointer.hpp"
+#include <charconv>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace Rapid::Common
 {
-class SharedTimestamp;
+
+/**
+ * A time with millisecond resolution.
+ * The Timestamp is backed by a single signed 64 bit count of milliseconds. It is used for the time
+ * of day of a GPS fix as well as for durations like lap and sector times. The arithmetic is plain
+ * integer math and a Timestamp is trivially copyable, copying an instance never allocates.
+ */
 class Timestamp
 {
 public:
+    /**
+     * The number of milliseconds of one day.
+     */
+    static constexpr auto MillisecondsPerDay = std::int64_t{24 * 60 * 60 * 1000};
+
+    /**
+     * The number of characters of the string representation hh:mm:ss.nnn
+     */
+    static constexpr auto StringLength = std::size_t{12};
+
     /**
      * Creates an instance of Timestamp
+     * The Timestamp is zero (00:00:00.000).
      */
-    Timestamp();
+    constexpr Timestamp() noexcept = default;
+
+    /**
+     * Creates a Timestamp from its time components.
+     * @param hour The hour of the Timestamp.
+     * @param minute The minute of the Timestamp.
+     * @param second The second of the Timestamp.
+     * @param fractionalOfSecond The milliseconds of the Timestamp.
+     */
+    constexpr Timestamp(std::uint8_t hour,
+                        std::uint8_t minute,
+                        std::uint8_t second,
+                        std::uint16_t fractionalOfSecond = 0) noexcept
+        : mMilliseconds{(hour * MillisecondsPerHour) + (minute * MillisecondsPerMinute) +
+                        (second * MillisecondsPerSecond) + fractionalOfSecond}
+    {
+    }
+
+    /**
+     * Creates a Timestamp from a duration.
+     * @param duration The duration, sub millisecond parts are truncated.
+     */
+    template <typename Rep, typename Period>
+    constexpr explicit Timestamp(std::chrono::duration<Rep, Period> duration) noexcept
+        : mMilliseconds{std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()}
+    {
+    }
 
     /**
      * Create an instance of Timestamp by a string.
      * The string must have the format of hh:mm:ss.nnn
+     * An invalid string is logged and results in a zero Timestamp.
      * @param timestampString
      */
     Timestamp(std::string const& timestampString);
@@ -29,81 +77,134 @@ public:
     /**
      * Default destructor
      */
-    ~Timestamp();
+    constexpr ~Timestamp() = default;
 
     /**
      * Copy constructor for Timestamp.
      * @param other  The object to copy from.
      */
-    Timestamp(Timestamp const& other);
+    constexpr Timestamp(Timestamp const& other) noexcept = default;
 
     /**
      * The copy assignment operator for Timestamp.
      * @param other The object to copy from.
      * @return Timestamp& A reference to the copied Timestamp.
      */
-    Timestamp& operator=(Timestamp const& other);
+    constexpr Timestamp& operator=(Timestamp const& other) noexcept = default;
 
     /**
      * The move constructor for Timestamp.
      * @param other The object to move from.
      */
-    Timestamp(Timestamp&& other);
+    constexpr Timestamp(Timestamp&& other) noexcept = default;
 
     /**
      * The move assignment operator for timestamp.
      * @param other The object to move from.
      * @return Timestamp& A reference to the moved Timestamp.
      */
-    Timestamp& operator=(Timestamp&& other);
+    constexpr Timestamp& operator=(Timestamp&& other) noexcept = default;
+
+    /**
+     * Creates a Timestamp from a number of milliseconds.
+     * @param milliseconds The milliseconds of the Timestamp.
+     * @return The created Timestamp.
+     */
+    static constexpr Timestamp fromMilliseconds(std::int64_t milliseconds) noexcept
+    {
+        auto timestamp = Timestamp{};
+        timestamp.mMilliseconds = milliseconds;
+        return timestamp;
+    }
+
+    /**
+     * Gives the Timestamp as number of milliseconds.
+     * @return The milliseconds of the Timestamp.
+     */
+    constexpr std::int64_t toMilliseconds() const noexcept
+    {
+        return mMilliseconds;
+    }
+
+    /**
+     * Parses a string in the format hh:mm:ss.nnn
+     * The fractional part may have one to three digits and is interpreted as decimal fraction.
+     * @param timestampString The string to parse.
+     * @return The parsed Timestamp or std::nullopt when the string has an invalid format.
+     */
+    static std::optional<Timestamp> fromString(std::string_view timestampString) noexcept;
 
     /**
      * Gives the hour.
      * @return std::uint8_t The hour of Timestamp.
      */
-    std::uint8_t getHour() const;
+    constexpr std::uint8_t getHour() const noexcept
+    {
+        return static_cast<std::uint8_t>(timeOfDay() / MillisecondsPerHour);
+    }
 
     /**
      * Sets a new hour.
      * @param hour The new hour.
      */
-    void setHour(std::uint8_t hour);
+    constexpr void setHour(std::uint8_t hour) noexcept
+    {
+        replaceComponent(getHour(), hour, MillisecondsPerHour);
+    }
 
     /**
      * Gives the minute.
      * @return std::uint8_t The minute of Timestamp.
      */
-    std::uint8_t getMinute() const;
+    constexpr std::uint8_t getMinute() const noexcept
+    {
+        return static_cast<std::uint8_t>((timeOfDay() / MillisecondsPerMinute) % 60);
+    }
 
     /**
      * Sets a new minute.
      * @param minute The new minute.
      */
-    void setMinute(std::uint8_t minute);
+    constexpr void setMinute(std::uint8_t minute) noexcept
+    {
+        replaceComponent(getMinute(), minute, MillisecondsPerMinute);
+    }
 
     /**
      * Gives the second of the Timestamp.
      * @return std::uint8_t The second of Timestamp.
      */
-    std::uint8_t getSecond() const;
+    constexpr std::uint8_t getSecond() const noexcept
+    {
+        return static_cast<std::uint8_t>((timeOfDay() / MillisecondsPerSecond) % 60);
+    }
 
     /**
      * Sets a new second.
      * @param second The new second.
      */
-    void setSecond(std::uint8_t second);
+    constexpr void setSecond(std::uint8_t second) noexcept
+    {
+        replaceComponent(getSecond(), second, MillisecondsPerSecond);
+    }
 
     /**
      * Gives the fractional of a second.
      * @return std::uint16_t The fractional of a second.
      */
-    std::uint16_t getFractionalOfSecond() const;
+    constexpr std::uint16_t getFractionalOfSecond() const noexcept
+    {
+        return static_cast<std::uint16_t>(timeOfDay() % MillisecondsPerSecond);
+    }
 
     /**
      * Sets a new fractional of second in Timestamp.
      * @param fractionalOfSecond The new fractional of second.
      */
-    void setFractionalOfSecond(std::uint16_t fractionalOfSecond);
+    constexpr void setFractionalOfSecond(std::uint16_t fractionalOfSecond) noexcept
+    {
+        replaceComponent(getFractionalOfSecond(), fractionalOfSecond, 1);
+    }
 
     /**
      * Converts the time compontes of the timestamp to a string.
@@ -112,35 +213,58 @@ public:
      */
     std::string asString() const noexcept;
 
+    /**
+     * Writes the time components in the format hh:mm:ss.nnn into the given buffer.
+     * The buffer is not null terminated. No characters are written when the buffer is smaller than
+     * @ref Timestamp::StringLength.
+     * @param first The begin of the buffer.
+     * @param last The end of the buffer.
+     * @return The result with the pointer past the last written character or std::errc::value_too_large.
+     */
+    std::to_chars_result toChars(char* first, char* last) const noexcept;
+
     /**
      * Makes the addition between two timestamps and returs the result.
      * @note The time will wrap when passing midnight.
      * @param rhs The right hand side operator of the addition.
      * @return A new Timestamp with the result of the plus operation.
      */
-    Timestamp operator+(Timestamp const& rhs) const noexcept;
+    constexpr Timestamp operator+(Timestamp const& rhs) const noexcept
+    {
+        return fromMilliseconds(wrapDay(mMilliseconds + rhs.mMilliseconds));
+    }
 
     /**
      * Make the subtraction of the given timestamp.
-     * @note The time will wrap when passing midnight.
+     * A negative result means that midnight was passed between the two times of day, in that case
+     * the elapsed time across midnight is returned.
      * @param rhs The right hand side operator of the subtraction.
      * @return A new Timestamp with the result of the minus operation.
      */
-    Timestamp operator-(Timestamp const& rhs) const noexcept;
+    constexpr Timestamp operator-(Timestamp const& rhs) const noexcept
+    {
+        return fromMilliseconds(wrapDay(mMilliseconds - rhs.mMilliseconds));
+    }
 
     /**
      * Equal operator
      * @return true The two objects are the same.
      * @return false The two objects are not the same.
      */
-    friend bool operator==(Timestamp const& lhs, Timestamp const& rhs);
+    friend constexpr bool operator==(Timestamp const& lhs, Timestamp const& rhs) noexcept
+    {
+        return lhs.mMilliseconds == rhs.mMilliseconds;
+    }
 
     /**
      * Not Equal operator
      * @return true The two objects are not the same.
      * @return false The two objects are the same.
      */
-    friend bool operator!=(Timestamp const& lhs, Timestamp const& rhs);
+    friend constexpr bool operator!=(Timestamp const& lhs, Timestamp const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
 
     /**
      * Gives the system time stamp
@@ -154,7 +278,10 @@ public:
      * @return true The lhs timestmap is smaller than the rhs
      * @return false The lhs timestmap is not smaller than the rhs
      */
-    friend bool operator<(Timestamp const& lhs, Timestamp const& rhs);
+    friend constexpr bool operator<(Timestamp const& lhs, Timestamp const& rhs) noexcept
+    {
+        return lhs.mMilliseconds < rhs.mMilliseconds;
+    }
 
     /**
      * @brief Greater than operator
@@ -162,13 +289,34 @@ public:
      * @return true The lhs timestmap is greater than the rhs
      * @return false The lhs timestmap is not greater than the rhs
      */
-    friend bool operator>(Timestamp const& lhs, Timestamp const& rhs);
+    friend constexpr bool operator>(Timestamp const& lhs, Timestamp const& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
 
 private:
-    std::int32_t convertToMilliSeconds() const;
+    static constexpr auto MillisecondsPerSecond = std::int64_t{1000};
+    static constexpr auto MillisecondsPerMinute = std::int64_t{60 * MillisecondsPerSecond};
+    static constexpr auto MillisecondsPerHour = std::int64_t{60 * MillisecondsPerMinute};
+
+    static constexpr std::int64_t wrapDay(std::int64_t milliseconds) noexcept
+    {
+        auto const wrapped = milliseconds % MillisecondsPerDay;
+        return wrapped < 0 ? wrapped + MillisecondsPerDay : wrapped;
+    }
+
+    constexpr std::int64_t timeOfDay() const noexcept
+    {
+        return wrapDay(mMilliseconds);
+    }
+
+    constexpr void replaceComponent(std::int64_t oldValue, std::int64_t newValue, std::int64_t unit) noexcept
+    {
+        mMilliseconds += (newValue - oldValue) * unit;
+    }
 
 private:
-    SharedDataPointer<SharedTimestamp> mData;
+    std::int64_t mMilliseconds{0};
 };
 
 } // namespace Rapid::Common
@@ -14,6 +14,14 @@ public:
     PositionData mFinishline;
     PositionData mStartline;
     std::vector<PositionData> mSections;
+    TrackTopology mTopology{TrackTopology::Circuit};
+    std::optional<PositionData> mPitLaneLine;
+    TrackGeometry mGeometry;
+
+    void updateGeometry()
+    {
+        mGeometry = TrackGeometry{mFinishline, mStartline, mSections, mTopology, mPitLaneLine};
+    }
 
     friend bool operator==(SharedTrackData const& lhs, SharedTrackData const& rhs)
     {
@@ -21,7 +29,9 @@ public:
         return ((lhs.mTrackName) == (rhs.mTrackName) &&
                 (lhs.mFinishline) == (rhs.mFinishline) &&
                 (lhs.mStartline) == (rhs.mStartline) &&
-                (lhs.mSections) == (rhs.mSections));
+                (lhs.mSections) == (rhs.mSections) &&
+                (lhs.mTopology) == (rhs.mTopology) &&
+                (lhs.mPitLaneLine) == (rhs.mPitLaneLine));
         // clang-format on
     }
 };
@@ -61,6 +71,7 @@ PositionData const& TrackData::getStartline() const
 void TrackData::setStartline(PositionData const& startline)
 {
     mData->mStartline = startline;
+    mData->updateGeometry();
 }
 
 PositionData const& TrackData::getFinishline() const
@@ -71,6 +82,7 @@ PositionData const& TrackData::getFinishline() const
 void TrackData::setFinishline(PositionData const& finishline)
 {
     mData->mFinishline = finishline;
+    mData->updateGeometry();
 }
 
 size_t TrackData::getNumberOfSections() const
@@ -91,6 +103,40 @@ std::vector<PositionData> const& TrackData::getSections() const
 void TrackData::setSections(std::vector<PositionData> const& sections)
 {
     mData->mSections = sections;
+    mData->updateGeometry();
+}
+
+void TrackData::setSections(std::vector<PositionData>&& sections)
+{
+    mData->mSections = std::move(sections);
+    mData->updateGeometry();
+}
+
+TrackTopology TrackData::getTopology() const
+{
+    return mData->mTopology;
+}
+
+void TrackData::setTopology(TrackTopology topology)
+{
+    mData->mTopology = topology;
+    mData->updateGeometry();
+}
+
+std::optional<PositionData> const& TrackData::getPitLaneLine() const
+{
+    return mData->mPitLaneLine;
+}
+
+void TrackData::setPitLaneLine(std::optional<PositionData> const& pitLaneLine)
+{
+    mData->mPitLaneLine = pitLaneLine;
+    mData->updateGeometry();
+}
+
+TrackGeometry const& TrackData::getGeometry() const
+{
+    return mData->mGeometry;
 }
 
 bool operator==(TrackData const& lhs, TrackData const& rhs)
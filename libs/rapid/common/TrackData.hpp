@@ -6,6 +6,9 @@
 
 #include "PositionData.hpp"
 #include "SharedDataPointer.hpp"
+#include "TrackGeometry.hpp"
+#include "TrackTopology.hpp"
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -114,11 +117,49 @@ public:
 
     /**
      * Sets the sections for the race track.
-     * The sections are consumed and the passed vector is not longer available after it.
      * @param sections The new sections of the track.
      */
     void setSections(std::vector<PositionData> const& sections);
 
+    /**
+     * Sets the sections for the race track.
+     * The sections are consumed and the passed vector is not longer available after it.
+     * @param sections The new sections of the track.
+     */
+    void setSections(std::vector<PositionData>&& sections);
+
+    /**
+     * Gives the topology of the track, the default is a circuit.
+     * @return TrackTopology The topology of the track.
+     */
+    TrackTopology getTopology() const;
+
+    /**
+     * Sets the topology of the track.
+     * @param topology The new topology of the track.
+     */
+    void setTopology(TrackTopology topology);
+
+    /**
+     * Gives the position of the line in the pit lane.
+     * The line finishes a lap like the finish line, when the pit lane of a circuit bypasses the finish line.
+     * @return The position of the pit lane line or std::nullopt when the track has no pit lane line.
+     */
+    std::optional<PositionData> const& getPitLaneLine() const;
+
+    /**
+     * Sets a new position for the line in the pit lane.
+     * @param pitLaneLine The new position of the pit lane line, std::nullopt removes the line.
+     */
+    void setPitLaneLine(std::optional<PositionData> const& pitLaneLine);
+
+    /**
+     * Gives the geometry of the track in the local tangent plane.
+     * The geometry is calculated when the start line, the finish line or the sections are changed.
+     * @return const TrackGeometry& The geometry of the track.
+     */
+    TrackGeometry const& getGeometry() const;
+
     /**
      * Equal operator
      * @return true The two objects are the same.
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "TrackGeometry.hpp"
+#include <algorithm>
+#include <limits>
+#include <numbers>
+
+namespace Rapid::Common
+{
+
+namespace
+{
+
+constexpr auto MinimumLength = 0.01f;
+
+std::optional<LocalPoint> normalize(LocalPoint const& vector) noexcept
+{
+    auto const vectorLength = length(vector);
+    if (vectorLength < MinimumLength) {
+        return std::nullopt;
+    }
+    return vector * (1.0f / vectorLength);
+}
+
+Gate createGate(LocalPoint const& center, float halfWidth) noexcept
+{
+    return Gate{.center = center, .begin = center, .end = center, .direction = {}, .halfWidth = halfWidth};
+}
+
+void extend(BoundingBox& box, LocalPoint const& point) noexcept
+{
+    box.min.x = std::min(box.min.x, point.x);
+    box.min.y = std::min(box.min.y, point.y);
+    box.max.x = std::max(box.max.x, point.x);
+    box.max.y = std::max(box.max.y, point.y);
+}
+
+void extend(BoundingBox& box, Gate const& gate) noexcept
+{
+    // The segment can take any direction around the gate position.
+    auto const corner = LocalPoint{.x = gate.halfWidth, .y = gate.halfWidth};
+    extend(box, gate.center - corner);
+    extend(box, gate.center + corner);
+}
+
+} // namespace
+
+LocalProjection::LocalProjection() noexcept = default;
+
+LocalProjection::LocalProjection(PositionData const& origin) noexcept
+    : mOrigin{origin}
+    , mMetersPerDegreeLongitude{MetersPerDegree * std::cos(origin.getLatitude() * std::numbers::pi / 180.0)}
+{
+}
+
+PositionData const& LocalProjection::getOrigin() const noexcept
+{
+    return mOrigin;
+}
+
+PositionData LocalProjection::unproject(LocalPoint const& point) const noexcept
+{
+    auto const longitude =
+        mMetersPerDegreeLongitude > 0.0 ? mOrigin.getLongitude() + (point.x / mMetersPerDegreeLongitude) : 0.0;
+    auto const latitude = mOrigin.getLatitude() + (point.y / MetersPerDegree);
+    return PositionData{static_cast<float>(latitude), static_cast<float>(longitude)};
+}
+
+void Gate::setDirection(LocalPoint const& heading) noexcept
+{
+    auto const unit = normalize(heading);
+    if (!unit.has_value()) {
+        return;
+    }
+    auto const across = LocalPoint{.x = -unit->y, .y = unit->x} * halfWidth;
+    begin = center - across;
+    end = center + across;
+    direction = *unit;
+}
+
+std::optional<float> Gate::crossing(LocalPoint const& from, LocalPoint const& to) const noexcept
+{
+    auto const movement = to - from;
+    auto const segment = end - begin;
+    auto const denominator = cross(movement, segment);
+    if (std::abs(denominator) < std::numeric_limits<float>::epsilon()) {
+        return std::nullopt;
+    }
+
+    auto const offset = begin - from;
+    auto const movementFraction = cross(offset, segment) / denominator;
+    auto const segmentFraction = cross(offset, movement) / denominator;
+    if (movementFraction < 0.0f || movementFraction > 1.0f || segmentFraction < 0.0f || segmentFraction > 1.0f) {
+        return std::nullopt;
+    }
+    return movementFraction;
+}
+
+TrackGeometry::TrackGeometry() noexcept = default;
+
+TrackGeometry::TrackGeometry(PositionData const& finishline,
+                             PositionData const& startline,
+                             std::span<PositionData const> sections,
+                             TrackTopology topology,
+                             std::optional<PositionData> const& pitLaneLine,
+                             float gateHalfWidth)
+    : mProjection{finishline}
+    , mTopology{topology}
+{
+    // The gates in the order they are passed. A circuit is a ring of the sections and the finish line, a
+    // separate start line leads into the ring. A point to point track is a path from the start to the finish.
+    mFinishGate = createGate(mProjection.project(finishline), gateHalfWidth);
+    if (startline != PositionData{}) {
+        mStartGate = createGate(mProjection.project(startline), gateHalfWidth);
+    }
+    mSectionGates.reserve(sections.size());
+    for (auto const& section : sections) {
+        mSectionGates.push_back(createGate(mProjection.project(section), gateHalfWidth));
+    }
+    if (topology == TrackTopology::Circuit && pitLaneLine.has_value()) {
+        mPitLaneGate = createGate(mProjection.project(*pitLaneLine), gateHalfWidth);
+    }
+
+    mBoundingBox = BoundingBox{.min = mFinishGate.center, .max = mFinishGate.center};
+    extend(mBoundingBox, mFinishGate);
+    if (mStartGate.has_value()) {
+        extend(mBoundingBox, *mStartGate);
+    }
+    for (auto const& gate : mSectionGates) {
+        extend(mBoundingBox, gate);
+    }
+    if (mPitLaneGate.has_value()) {
+        extend(mBoundingBox, *mPitLaneGate);
+    }
+}
+
+TrackTopology TrackGeometry::getTopology() const noexcept
+{
+    return mTopology;
+}
+
+LocalProjection const& TrackGeometry::getProjection() const noexcept
+{
+    return mProjection;
+}
+
+Gate const& TrackGeometry::getFinishGate() const noexcept
+{
+    return mFinishGate;
+}
+
+bool TrackGeometry::hasStartGate() const noexcept
+{
+    return mStartGate.has_value();
+}
+
+Gate const& TrackGeometry::getStartGate() const noexcept
+{
+    return mStartGate.has_value() ? *mStartGate : mFinishGate;
+}
+
+std::span<Gate const> TrackGeometry::getSectionGates() const noexcept
+{
+    return mSectionGates;
+}
+
+Gate const* TrackGeometry::getPitLaneGate() const noexcept
+{
+    return mPitLaneGate.has_value() ? &(*mPitLaneGate) : nullptr;
+}
+
+BoundingBox const& TrackGeometry::getBoundingBox() const noexcept
+{
+    return mBoundingBox;
+}
+
+} // namespace Rapid::Common
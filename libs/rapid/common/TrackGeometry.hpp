@@ -0,0 +1,324 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_TRACKGEOMETRY_HPP
+#define RAPID_COMMON_TRACKGEOMETRY_HPP
+
+#include "PositionData.hpp"
+#include "TrackTopology.hpp"
+#include <cmath>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Rapid::Common
+{
+
+/**
+ * A point in the local tangent plane of a track.
+ * The x axis points to the east and the y axis to the north, both are in meter.
+ */
+struct LocalPoint
+{
+    float x{0.0f};
+    float y{0.0f};
+
+    friend constexpr LocalPoint operator+(LocalPoint const& lhs, LocalPoint const& rhs) noexcept
+    {
+        return LocalPoint{.x = lhs.x + rhs.x, .y = lhs.y + rhs.y};
+    }
+
+    friend constexpr LocalPoint operator-(LocalPoint const& lhs, LocalPoint const& rhs) noexcept
+    {
+        return LocalPoint{.x = lhs.x - rhs.x, .y = lhs.y - rhs.y};
+    }
+
+    friend constexpr LocalPoint operator*(LocalPoint const& point, float factor) noexcept
+    {
+        return LocalPoint{.x = point.x * factor, .y = point.y * factor};
+    }
+
+    friend constexpr bool operator==(LocalPoint const& lhs, LocalPoint const& rhs) noexcept = default;
+};
+
+/**
+ * Gives the dot product of two vectors.
+ */
+constexpr float dot(LocalPoint const& lhs, LocalPoint const& rhs) noexcept
+{
+    return (lhs.x * rhs.x) + (lhs.y * rhs.y);
+}
+
+/**
+ * Gives the z component of the cross product of two vectors.
+ */
+constexpr float cross(LocalPoint const& lhs, LocalPoint const& rhs) noexcept
+{
+    return (lhs.x * rhs.y) - (lhs.y * rhs.x);
+}
+
+/**
+ * Gives the squared length of a vector.
+ */
+constexpr float squaredLength(LocalPoint const& vector) noexcept
+{
+    return dot(vector, vector);
+}
+
+/**
+ * Gives the length of a vector.
+ */
+inline float length(LocalPoint const& vector) noexcept
+{
+    return std::sqrt(squaredLength(vector));
+}
+
+/**
+ * Projects geographic positions into a local tangent plane (east, north) around an origin.
+ * The projection is equirectangular, the cosine of the origin latitude is calculated once, so
+ * projecting a position is only a subtraction and a multiplication per axis. The projection is
+ * accurate for the extent of a race track.
+ */
+class LocalProjection final
+{
+public:
+    /**
+     * The meters of one degree latitude.
+     */
+    static constexpr auto MetersPerDegree = 111300.0;
+
+    /**
+     * Creates a projection with the origin at latitude and longitude 0.
+     */
+    LocalProjection() noexcept;
+
+    /**
+     * Creates a projection around the origin.
+     * @param origin The origin of the local tangent plane.
+     */
+    explicit LocalProjection(PositionData const& origin) noexcept;
+
+    /**
+     * @return The origin of the local tangent plane.
+     */
+    PositionData const& getOrigin() const noexcept;
+
+    /**
+     * Projects a position into the local tangent plane.
+     * @param position The position to project.
+     * @return The position in meter relative to the origin.
+     */
+    LocalPoint project(PositionData const& position) const noexcept
+    {
+        return LocalPoint{
+            .x = static_cast<float>((position.getLongitude() - mOrigin.getLongitude()) * mMetersPerDegreeLongitude),
+            .y = static_cast<float>((position.getLatitude() - mOrigin.getLatitude()) * MetersPerDegree)};
+    }
+
+    /**
+     * Converts a point of the local tangent plane back to a geographic position.
+     * @param point The point in meter relative to the origin.
+     * @return The geographic position of the point.
+     */
+    PositionData unproject(LocalPoint const& point) const noexcept;
+
+private:
+    PositionData mOrigin;
+    double mMetersPerDegreeLongitude{MetersPerDegree};
+};
+
+/**
+ * An axis aligned bounding box in the local tangent plane.
+ */
+struct BoundingBox
+{
+    LocalPoint min;
+    LocalPoint max;
+
+    /**
+     * Checks if the point is in the box.
+     * @param point The point to check.
+     * @param margin The distance in meter the box is enlarged on every side.
+     * @return true The point is in the enlarged box.
+     * @return false The point is outside of the enlarged box.
+     */
+    constexpr bool contains(LocalPoint const& point, float margin = 0.0f) const noexcept
+    {
+        return (point.x >= min.x - margin) && (point.x <= max.x + margin) && (point.y >= min.y - margin) &&
+               (point.y <= max.y + margin);
+    }
+};
+
+/**
+ * A start, finish or section line of a track in the local tangent plane.
+ * The gate is a finite segment through the gate position that is perpendicular to the direction of
+ * travel. The direction can't be derived from the gate positions, on a real track the neighbour gates
+ * are connected by corners. So a gate is created without direction and the direction is set from the
+ * heading that is driven through the gate.
+ */
+struct Gate
+{
+    /**
+     * The default half length of a gate segment in meter.
+     */
+    static constexpr auto DefaultHalfWidth = 25.0f;
+
+    /**
+     * The gate position.
+     */
+    LocalPoint center;
+
+    /**
+     * The first end point of the segment.
+     */
+    LocalPoint begin;
+
+    /**
+     * The second end point of the segment.
+     */
+    LocalPoint end;
+
+    /**
+     * The unit vector of the direction of travel or a null vector when the direction is unknown.
+     */
+    LocalPoint direction;
+
+    /**
+     * The half length of the segment in meter.
+     */
+    float halfWidth{DefaultHalfWidth};
+
+    /**
+     * Checks if the direction of travel through the gate is known.
+     * Without direction the segment has no length and crossings can't be calculated.
+     */
+    constexpr bool hasDirection() const noexcept
+    {
+        return direction != LocalPoint{};
+    }
+
+    /**
+     * Sets the direction of travel and places the segment perpendicular to it.
+     * @param heading The heading driven through the gate, it doesn't need to be a unit vector. A heading
+     *                shorter than a centimeter is ignored.
+     */
+    void setDirection(LocalPoint const& heading) noexcept;
+
+    /**
+     * Gives the distance of a point to the gate position.
+     * @param point The point in the local tangent plane.
+     * @return The distance in meter.
+     */
+    float distanceTo(LocalPoint const& point) const noexcept
+    {
+        return length(point - center);
+    }
+
+    /**
+     * Checks if the movement between two points crosses the gate segment.
+     * @param from The point before the movement.
+     * @param to The point after the movement.
+     * @return The fraction of the movement at which the gate is crossed in the range of [0, 1] or
+     *         std::nullopt when the gate isn't crossed.
+     */
+    std::optional<float> crossing(LocalPoint const& from, LocalPoint const& to) const noexcept;
+};
+
+/**
+ * The geometry of a track derived from the gate positions of @ref TrackData.
+ * The geometry is calculated once when the track changes, the laptimer, the track detection and the
+ * analysis can work with planar math in meter instead of calculating trigonometric functions for
+ * every position. The origin of the projection is the finish line.
+ * The gates are stored in the order they are passed for the topology of the track, so a laptimer only
+ * has to check the next expected gate for every position. The gates have no direction of travel, it is
+ * learned by the laptimer from the heading driven through the gates.
+ */
+class TrackGeometry final
+{
+public:
+    /**
+     * The default half length of a gate segment in meter.
+     */
+    static constexpr auto DefaultGateHalfWidth = Gate::DefaultHalfWidth;
+
+    /**
+     * Creates an empty geometry, the finish gate is at the origin.
+     */
+    TrackGeometry() noexcept;
+
+    /**
+     * Calculates the geometry of a track.
+     * @param finishline The position of the finish line.
+     * @param startline The position of the start line, a default constructed position means the
+     *                  finish line is the start line.
+     * @param sections The positions of the sections in the order of the track.
+     * @param topology The topology of the track.
+     * @param pitLaneLine The position of the line in the pit lane, std::nullopt when the track has no pit lane
+     *                    line. The line is only used for a circuit.
+     * @param gateHalfWidth The half length of the gate segments in meter.
+     */
+    TrackGeometry(PositionData const& finishline,
+                  PositionData const& startline,
+                  std::span<PositionData const> sections,
+                  TrackTopology topology = TrackTopology::Circuit,
+                  std::optional<PositionData> const& pitLaneLine = std::nullopt,
+                  float gateHalfWidth = DefaultGateHalfWidth);
+
+    /**
+     * @return The topology of the track.
+     */
+    TrackTopology getTopology() const noexcept;
+
+    /**
+     * @return The projection of the track.
+     */
+    LocalProjection const& getProjection() const noexcept;
+
+    /**
+     * @return The finish gate.
+     */
+    Gate const& getFinishGate() const noexcept;
+
+    /**
+     * Checks if the track has a separate start line.
+     * @return true The start line is separate from the finish line.
+     * @return false The finish line is the start line.
+     */
+    bool hasStartGate() const noexcept;
+
+    /**
+     * Gives the start gate, this is the finish gate when the track has no separate start line.
+     * @return The start gate.
+     */
+    Gate const& getStartGate() const noexcept;
+
+    /**
+     * @return The section gates in the order of the track.
+     */
+    std::span<Gate const> getSectionGates() const noexcept;
+
+    /**
+     * Gives the gate in the pit lane that finishes a lap like the finish gate.
+     * @return The pit lane gate or nullptr when the track has no pit lane gate.
+     */
+    Gate const* getPitLaneGate() const noexcept;
+
+    /**
+     * @return The bounding box of all gate segments.
+     */
+    BoundingBox const& getBoundingBox() const noexcept;
+
+private:
+    LocalProjection mProjection;
+    TrackTopology mTopology{TrackTopology::Circuit};
+    Gate mFinishGate;
+    std::optional<Gate> mStartGate;
+    std::vector<Gate> mSectionGates;
+    std::optional<Gate> mPitLaneGate;
+    BoundingBox mBoundingBox;
+};
+
+} // namespace Rapid::Common
+
+#endif // !RAPID_COMMON_TRACKGEOMETRY_HPP
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "TrackRegistry.hpp"
+#include <functional>
+#include <string_view>
+
+namespace Rapid::Common
+{
+
+namespace
+{
+
+void combineHash(std::size_t& seed, std::size_t value) noexcept
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+void combineHash(std::size_t& seed, PositionData const& position) noexcept
+{
+    combineHash(seed, std::hash<float>{}(position.getLatitude()));
+    combineHash(seed, std::hash<float>{}(position.getLongitude()));
+}
+
+} // namespace
+
+TrackRegistry::TrackRegistry() = default;
+TrackRegistry::~TrackRegistry() = default;
+
+TrackRegistry& TrackRegistry::instance() noexcept
+{
+    static TrackRegistry registry;
+    return registry;
+}
+
+TrackData TrackRegistry::intern(TrackData const& track)
+{
+    auto const trackHash = hash(track);
+    std::lock_guard<std::mutex> const guard{mMutex};
+    auto const [begin, end] = mTracks.equal_range(trackHash);
+    for (auto iter = begin; iter != end; ++iter) {
+        if (iter->second == track) {
+            return iter->second;
+        }
+    }
+    return mTracks.emplace(trackHash, track)->second;
+}
+
+std::size_t TrackRegistry::size() const noexcept
+{
+    std::lock_guard<std::mutex> const guard{mMutex};
+    return mTracks.size();
+}
+
+void TrackRegistry::clear() noexcept
+{
+    std::lock_guard<std::mutex> const guard{mMutex};
+    mTracks.clear();
+}
+
+std::size_t TrackRegistry::hash(TrackData const& track) noexcept
+{
+    auto seed = std::hash<std::string_view>{}(track.getTrackName());
+    combineHash(seed, track.getFinishline());
+    combineHash(seed, track.getStartline());
+    for (auto const& section : track.getSections()) {
+        combineHash(seed, section);
+    }
+    combineHash(seed, static_cast<std::size_t>(track.getTopology()));
+    auto const& pitLaneLine = track.getPitLaneLine();
+    combineHash(seed, static_cast<std::size_t>(pitLaneLine.has_value()));
+    if (pitLaneLine.has_value()) {
+        combineHash(seed, *pitLaneLine);
+    }
+    return seed;
+}
+
+} // namespace Rapid::Common
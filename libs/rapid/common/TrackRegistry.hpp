@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_TRACKREGISTRY_HPP
+#define RAPID_COMMON_TRACKREGISTRY_HPP
+
+#include "TrackData.hpp"
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+namespace Rapid::Common
+{
+
+/**
+ * The TrackRegistry is a process wide pool of tracks.
+ * Tracks that are passed to @ref TrackRegistry::intern are compared by their content, equal tracks
+ * are stored only once and every caller gets a handle that shares the storage of this single
+ * instance. A session list with hundreds of sessions on the same circuit holds therefore only
+ * one track name, start/finish line and section list.
+ * The returned handles are normal @ref TrackData objects, modifying a handle detaches it from the
+ * registry instance, so the interned track itself is never changed.
+ * All functions are thread safe.
+ */
+class TrackRegistry final
+{
+public:
+    /**
+     * Gives the process wide registry.
+     */
+    static TrackRegistry& instance() noexcept;
+
+    /**
+     * Default destructor
+     */
+    ~TrackRegistry();
+
+    /**
+     * Disabled copy constructor
+     */
+    TrackRegistry(TrackRegistry const&) = delete;
+
+    /**
+     * Disabled copy assignment
+     */
+    TrackRegistry& operator=(TrackRegistry const&) = delete;
+
+    /**
+     * Disabled move constructor
+     */
+    TrackRegistry(TrackRegistry&&) noexcept = delete;
+
+    /**
+     * Disabled move assignment
+     */
+    TrackRegistry& operator=(TrackRegistry&&) noexcept = delete;
+
+    /**
+     * Gives the interned instance of the track.
+     * If an equal track is already registered a handle to the registered track is returned,
+     * otherwise the passed track is registered.
+     * @param track The track that shall be interned.
+     * @return A handle that shares the storage with all other handles of an equal track.
+     */
+    TrackData intern(TrackData const& track);
+
+    /**
+     * Gives the number of registered tracks.
+     * @return The number of registered tracks.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * Removes all registered tracks.
+     * Handles that were handed out before stay valid.
+     */
+    void clear() noexcept;
+
+    /**
+     * Calculates the hash of the content of a track.
+     * @param track The track to hash.
+     * @return The hash of the track.
+     */
+    static std::size_t hash(TrackData const& track) noexcept;
+
+private:
+    TrackRegistry();
+
+private:
+    std::unordered_multimap<std::size_t, TrackData> mTracks;
+    std::mutex mutable mMutex;
+};
+
+} // namespace Rapid::Common
+
+#endif // !RAPID_COMMON_TRACKREGISTRY_HPP
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_COMMON_TRACKTOPOLOGY_HPP
+#define RAPID_COMMON_TRACKTOPOLOGY_HPP
+
+#include <cstdint>
+
+namespace Rapid::Common
+{
+
+/**
+ * Describes how the laps of a track are driven.
+ */
+enum class TrackTopology : std::uint8_t
+{
+    /**
+     * A lap starts and ends at the finish line. A separate start line only starts the first lap, e.g. at the
+     * exit of the pit lane. A line in the pit lane can finish the lap when the pit lane bypasses the finish line.
+     */
+    Circuit,
+
+    /**
+     * A lap starts at the start line and ends at the finish line, e.g. a hillclimb or a rally stage.
+     * After the finish the next lap is started when the start line is crossed again.
+     */
+    PointToPoint,
+};
+
+} // namespace Rapid::Common
+
+#endif // !RAPID_COMMON_TRACKTOPOLOGY_HPP
@@ -3,14 +3,13 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
-#include "SharedDataPointer.hpp"
 
 namespace Rapid::Common
 {
-struct SharedVelocityData;
 
 /**
  * Holds an velocity all returned values by this class are in the unit m/s.
+ * The VelocityData is a trivially copyable value type, copying never allocates.
  */
 class VelocityData final
 {
@@ -19,7 +18,7 @@ public:
      * Creates an VelocityData instance.
      * The velocity is set to 0.0;
      */
-    VelocityData();
+    constexpr VelocityData() noexcept = default;
 
     /**
      * Creates an VelocityData instance.
@@ -27,67 +26,85 @@ public:
      * @ref VelocityData::createFormMpH when conversion is needed.
      * @param velocity The velocity must be in m/s
      */
-    VelocityData(double velocity);
+    constexpr VelocityData(double velocity) noexcept
+        : mVelocity{velocity}
+    {
+    }
 
     /**
      * Default destructor
      */
-    ~VelocityData();
+    constexpr ~VelocityData() = default;
 
     /**
      * Default copy operator
      */
-    VelocityData(VelocityData const&);
+    constexpr VelocityData(VelocityData const&) noexcept = default;
 
     /**
      * Default copy asignment
      */
-    VelocityData& operator=(VelocityData const&);
+    constexpr VelocityData& operator=(VelocityData const&) noexcept = default;
 
     /**
      * Default move operator
      */
-    VelocityData(VelocityData&&) noexcept;
+    constexpr VelocityData(VelocityData&&) noexcept = default;
 
     /**
      * Default move asignment
      */
-    VelocityData& operator=(VelocityData&&) noexcept;
+    constexpr VelocityData& operator=(VelocityData&&) noexcept = default;
 
     /**
      * Gives the stored velocity
      */
-    double getVelocity() const noexcept;
+    constexpr double getVelocity() const noexcept
+    {
+        return mVelocity;
+    }
 
     /**
      * Equal operator
      * @return true The two objects are the same.
      * @return false The two objects are not the same.
      */
-    friend bool operator==(VelocityData const& lhs, VelocityData const& rhs) noexcept;
+    friend constexpr bool operator==(VelocityData const& lhs, VelocityData const& rhs) noexcept
+    {
+        return lhs.mVelocity == rhs.mVelocity;
+    }
 
     /**
      * Not Equal operator
      * @return true The two objects are not the same.
      * @return false The two objects are the same.
      */
-    friend bool operator!=(VelocityData const& lhs, VelocityData const& rhs) noexcept;
+    friend constexpr bool operator!=(VelocityData const& lhs, VelocityData const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
 
     /**
      * Creates an VelocityData from value in km/h.
      * @param kmh The velocity value in kmh.
      * @return The created VelocityData.
      */
-    static VelocityData createFromKmH(double kmh) noexcept;
+    static constexpr VelocityData createFromKmH(double kmh) noexcept
+    {
+        return VelocityData{kmh / 3.6};
+    }
 
     /**
      * Creates an VelocityData from value in mp/h.
      * @param kmh The velocity value in mp/h.
      * @return The created VelocityData.
      */
-    static VelocityData createFromMpH(double mph) noexcept;
+    static constexpr VelocityData createFromMpH(double mph) noexcept
+    {
+        return VelocityData{mph * 0.44704};
+    }
 
 private:
-    SharedDataPointer<SharedVelocityData> mData;
+    double mVelocity{0.0};
 };
 } // namespace Rapid::Common
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "FilteredGpsPositionProvider.hpp"
+#include "KalmanGpsPositionFilter.hpp"
+#include "PlausibilityGpsPositionFilter.hpp"
+
+using namespace Rapid::Common;
+
+namespace Rapid::Positioning
+{
+
+namespace
+{
+
+std::vector<std::unique_ptr<IGpsPositionFilter>> createDefaultFilters()
+{
+    auto filters = std::vector<std::unique_ptr<IGpsPositionFilter>>{};
+    filters.push_back(std::make_unique<PlausibilityGpsPositionFilter>());
+    filters.push_back(std::make_unique<KalmanGpsPositionFilter>());
+    return filters;
+}
+
+} // namespace
+
+FilteredGpsPositionProvider::FilteredGpsPositionProvider(IGpsPositionProvider& source,
+                                                         std::vector<std::unique_ptr<IGpsPositionFilter>> filters)
+    : mFilters{std::move(filters)}
+{
+    mSourceConnection =
+        source.gpsPosition.valueChanged().connect(&FilteredGpsPositionProvider::onSourcePositionChanged, this);
+}
+
+FilteredGpsPositionProvider::FilteredGpsPositionProvider(IGpsPositionProvider& source)
+    : FilteredGpsPositionProvider{source, createDefaultFilters()}
+{
+}
+
+FilteredGpsPositionProvider::~FilteredGpsPositionProvider() = default;
+
+void FilteredGpsPositionProvider::reset()
+{
+    for (auto const& filter : mFilters) {
+        filter->reset();
+    }
+}
+
+void FilteredGpsPositionProvider::onSourcePositionChanged(GpsPositionData const& position)
+{
+    auto filtered = std::optional<GpsPositionData>{position};
+    for (auto const& filter : mFilters) {
+        filtered = filter->filter(*filtered);
+        if (!filtered.has_value()) {
+            return;
+        }
+    }
+    gpsPosition.set(*filtered);
+}
+
+} // namespace Rapid::Positioning
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_POSITIONING_FILTEREDGPSPOSITIONPROVIDER_HPP
+#define RAPID_POSITIONING_FILTEREDGPSPOSITIONPROVIDER_HPP
+
+#include "positioning/IGpsPositionFilter.hpp"
+#include "positioning/IGpsPositionProvider.hpp"
+#include <memory>
+#include <vector>
+
+namespace Rapid::Positioning
+{
+
+/**
+ * The FilteredGpsPositionProvider passes the fixes of a GPS source through a pipeline of @ref IGpsPositionFilter
+ * before they are published, e.g. to the laptimer. The filters are called in the given order, a fix rejected
+ * by a filter isn't passed to the following filters and isn't published.
+ */
+class FilteredGpsPositionProvider final : public IGpsPositionProvider
+{
+public:
+    /**
+     * Creates a FilteredGpsPositionProvider.
+     * @param source The GPS source whose fixes are filtered, must outlive the provider.
+     * @param filters The filters of the pipeline in the order they are applied.
+     */
+    FilteredGpsPositionProvider(IGpsPositionProvider& source, std::vector<std::unique_ptr<IGpsPositionFilter>> filters);
+
+    /**
+     * Creates a FilteredGpsPositionProvider with the default pipeline, the outlier rejection followed by the
+     * Kalman filter.
+     * @param source The GPS source whose fixes are filtered, must outlive the provider.
+     */
+    explicit FilteredGpsPositionProvider(IGpsPositionProvider& source);
+
+    /**
+     * Default destructor
+     */
+    ~FilteredGpsPositionProvider() override;
+
+    /**
+     * Disabled copy constructor
+     */
+    FilteredGpsPositionProvider(FilteredGpsPositionProvider const&) = delete;
+
+    /**
+     * Disabled copy operator
+     */
+    FilteredGpsPositionProvider& operator=(FilteredGpsPositionProvider const&) = delete;
+
+    /**
+     * Disabled move constructor
+     */
+    FilteredGpsPositionProvider(FilteredGpsPositionProvider&&) noexcept = delete;
+
+    /**
+     * Disabled move operator
+     */
+    FilteredGpsPositionProvider& operator=(FilteredGpsPositionProvider&&) noexcept = delete;
+
+    /**
+     * Resets all filters, e.g. when the GPS source lost the fix.
+     */
+    void reset();
+
+private:
+    void onSourcePositionChanged(Common::GpsPositionData const& position);
+
+private:
+    std::vector<std::unique_ptr<IGpsPositionFilter>> mFilters;
+    KDBindings::ScopedConnection mSourceConnection;
+};
+
+} // namespace Rapid::Positioning
+
+#endif // !RAPID_POSITIONING_FILTEREDGPSPOSITIONPROVIDER_HPP
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_POSITIONING_IGPSPOSITIONFILTER_HPP
+#define RAPID_POSITIONING_IGPSPOSITIONFILTER_HPP
+
+#include "common/GpsPositionData.hpp"
+#include <optional>
+
+namespace Rapid::Positioning
+{
+
+/**
+ * A stage of the @ref FilteredGpsPositionProvider pipeline.
+ * A filter receives every fix of the GPS source in order. It may reject a fix or replace it by a corrected fix.
+ * The filters are called for every fix, so they must work in fixed memory with constant cost per fix.
+ */
+class IGpsPositionFilter
+{
+public:
+    /**
+     * Virtual default destructor.
+     */
+    virtual ~IGpsPositionFilter() = default;
+
+    /**
+     * Disabled copy constructor
+     */
+    IGpsPositionFilter(IGpsPositionFilter const&) = delete;
+
+    /**
+     * Disabled copy operator
+     */
+    IGpsPositionFilter& operator=(IGpsPositionFilter const&) = delete;
+
+    /**
+     * Disabled move constructor
+     */
+    IGpsPositionFilter(IGpsPositionFilter&&) noexcept = delete;
+
+    /**
+     * Disabled move operator
+     */
+    IGpsPositionFilter& operator=(IGpsPositionFilter&&) noexcept = delete;
+
+    /**
+     * Filters the next fix of the GPS source.
+     * @param position The next fix.
+     * @return The filtered fix or std::nullopt when the fix is rejected.
+     */
+    [[nodiscard]] virtual std::optional<Common::GpsPositionData> filter(Common::GpsPositionData const& position) = 0;
+
+    /**
+     * Drops the state of the previous fixes, the next fix starts the filter again.
+     */
+    virtual void reset() = 0;
+
+protected:
+    /**
+     * Default protected constructor.
+     */
+    IGpsPositionFilter() = default;
+};
+
+} // namespace Rapid::Positioning
+
+#endif // !RAPID_POSITIONING_IGPSPOSITIONFILTER_HPP
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "KalmanGpsPositionFilter.hpp"
+
+using namespace Rapid::Common;
+
+namespace Rapid::Positioning
+{
+
+namespace
+{
+
+/**
+ * The variance of the velocity at the start of the filter, the velocity is unknown until the second fix.
+ */
+constexpr auto InitialVelocityVariance = 50.0 * 50.0;
+
+} // namespace
+
+void KalmanGpsPositionFilter::Axis::start(double measurement, double measurementVariance) noexcept
+{
+    position = measurement;
+    velocity = 0.0;
+    positionVariance = measurementVariance;
+    covariance = 0.0;
+    velocityVariance = InitialVelocityVariance;
+}
+
+void KalmanGpsPositionFilter::Axis::predict(double seconds, double accelerationVariance) noexcept
+{
+    // The acceleration is white noise that changes the velocity by a * t and the position by a * t² / 2.
+    auto const seconds2 = seconds * seconds;
+    position += velocity * seconds;
+    positionVariance += (seconds * ((2.0 * covariance) + (seconds * velocityVariance))) +
+                        (accelerationVariance * seconds2 * seconds2 / 4.0);
+    covariance += (seconds * velocityVariance) + (accelerationVariance * seconds2 * seconds / 2.0);
+    velocityVariance += accelerationVariance * seconds2;
+}
+
+void KalmanGpsPositionFilter::Axis::update(double measurement, double measurementVariance) noexcept
+{
+    auto const innovationVariance = positionVariance + measurementVariance;
+    auto const positionGain = positionVariance / innovationVariance;
+    auto const velocityGain = covariance / innovationVariance;
+    auto const innovation = measurement - position;
+
+    position += positionGain * innovation;
+    velocity += velocityGain * innovation;
+    velocityVariance -= velocityGain * covariance;
+    positionVariance *= 1.0 - positionGain;
+    covariance *= 1.0 - positionGain;
+}
+
+KalmanGpsPositionFilter::KalmanGpsPositionFilter() noexcept
+    : KalmanGpsPositionFilter{Noise{}}
+{
+}
+
+KalmanGpsPositionFilter::KalmanGpsPositionFilter(Noise const& noise) noexcept
+    : mNoise{noise}
+{
+}
+
+std::optional<GpsPositionData> KalmanGpsPositionFilter::filter(GpsPositionData const& position)
+{
+    auto const measurementVariance = mNoise.position * mNoise.position;
+    auto const elapsed = (position.getTime() - mLastTime).toMilliseconds();
+    if (!mInitialized || (elapsed <= 0) || (elapsed > MaxGapInMilliseconds)) {
+        mInitialized = true;
+        mProjection = LocalProjection{position.getPosition()};
+        mLastTime = position.getTime();
+        mEast.start(0.0, measurementVariance);
+        mNorth.start(0.0, measurementVariance);
+        return position;
+    }
+
+    auto const seconds = static_cast<double>(elapsed) / 1000.0;
+    auto const accelerationVariance = mNoise.acceleration * mNoise.acceleration;
+    auto const point = mProjection.project(position.getPosition());
+    mEast.predict(seconds, accelerationVariance);
+    mNorth.predict(seconds, accelerationVariance);
+    mEast.update(point.x, measurementVariance);
+    mNorth.update(point.y, measurementVariance);
+    mLastTime = position.getTime();
+
+    auto filtered = position;
+    filtered.setPosition(mProjection.unproject(
+        LocalPoint{.x = static_cast<float>(mEast.position), .y = static_cast<float>(mNorth.position)}));
+    return filtered;
+}
+
+void KalmanGpsPositionFilter::reset()
+{
+    mInitialized = false;
+}
+
+} // namespace Rapid::Positioning
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_POSITIONING_KALMANGPSPOSITIONFILTER_HPP
+#define RAPID_POSITIONING_KALMANGPSPOSITIONFILTER_HPP
+
+#include "common/TrackGeometry.hpp"
+#include "positioning/IGpsPositionFilter.hpp"
+#include <cstdint>
+
+namespace Rapid::Positioning
+{
+
+/**
+ * Smooths the fixes with a constant velocity Kalman filter.
+ * The filter runs in a local east/north plane around the first fix. East and north are independent, so every
+ * axis is a two state filter (position and velocity) and a fix costs a few multiplications. The filtered
+ * position is the estimate at the time of the fix, so the filter adds no delay to the fixes.
+ * The filter starts again when the time between two fixes exceeds the maximum gap.
+ */
+class KalmanGpsPositionFilter final : public IGpsPositionFilter
+{
+public:
+    /**
+     * The noise model of the filter.
+     */
+    struct Noise
+    {
+        /**
+         * The standard deviation of the acceleration of the vehicle in m/s².
+         */
+        double acceleration{10.0};
+
+        /**
+         * The standard deviation of the position of a fix in meter.
+         */
+        double position{1.5};
+    };
+
+    /**
+     * The time between two fixes in milliseconds after that the filter starts again.
+     */
+    static constexpr auto MaxGapInMilliseconds = std::int64_t{2000};
+
+    /**
+     * Creates a filter with the default noise.
+     */
+    KalmanGpsPositionFilter() noexcept;
+
+    /**
+     * Creates a Kalman filter.
+     * @param noise The noise model of the filter.
+     */
+    explicit KalmanGpsPositionFilter(Noise const& noise) noexcept;
+
+    /**
+     * Default destructor
+     */
+    ~KalmanGpsPositionFilter() override = default;
+
+    /**
+     * Disabled copy constructor
+     */
+    KalmanGpsPositionFilter(KalmanGpsPositionFilter const&) = delete;
+
+    /**
+     * Disabled copy operator
+     */
+    KalmanGpsPositionFilter& operator=(KalmanGpsPositionFilter const&) = delete;
+
+    /**
+     * Disabled move constructor
+     */
+    KalmanGpsPositionFilter(KalmanGpsPositionFilter&&) noexcept = delete;
+
+    /**
+     * Disabled move operator
+     */
+    KalmanGpsPositionFilter& operator=(KalmanGpsPositionFilter&&) noexcept = delete;
+
+    /**
+     * @copydoc IGpsPositionFilter::filter
+     */
+    [[nodiscard]] std::optional<Common::GpsPositionData> filter(Common::GpsPositionData const& position) override;
+
+    /**
+     * @copydoc IGpsPositionFilter::reset
+     */
+    void reset() override;
+
+private:
+    /**
+     * The state of one axis, the position, the velocity and their covariance.
+     */
+    struct Axis
+    {
+        double position{0.0};
+        double velocity{0.0};
+        double positionVariance{0.0};
+        double covariance{0.0};
+        double velocityVariance{0.0};
+
+        void start(double measurement, double measurementVariance) noexcept;
+        void predict(double seconds, double accelerationVariance) noexcept;
+        void update(double measurement, double measurementVariance) noexcept;
+    };
+
+    Noise mNoise;
+    bool mInitialized{false};
+    Common::LocalProjection mProjection;
+    Common::Timestamp mLastTime;
+    Axis mEast;
+    Axis mNorth;
+};
+
+} // namespace Rapid::Positioning
+
+#endif // !RAPID_POSITIONING_KALMANGPSPOSITIONFILTER_HPP
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "PlausibilityGpsPositionFilter.hpp"
+#include <spdlog/spdlog.h>
+
+using namespace Rapid::Common;
+
+namespace Rapid::Positioning
+{
+
+namespace
+{
+
+constexpr auto MaxElapsedMilliseconds = Timestamp::MillisecondsPerDay / 2;
+
+} // namespace
+
+PlausibilityGpsPositionFilter::PlausibilityGpsPositionFilter() noexcept
+    : PlausibilityGpsPositionFilter{Limits{}}
+{
+}
+
+PlausibilityGpsPositionFilter::PlausibilityGpsPositionFilter(Limits const& limits) noexcept
+    : mLimits{limits}
+{
+}
+
+std::optional<GpsPositionData> PlausibilityGpsPositionFilter::filter(GpsPositionData const& position)
+{
+    if (!mInitialized) {
+        mProjection = LocalProjection{position.getPosition()};
+        return accept(position, LocalPoint{}, std::nullopt);
+    }
+
+    auto const point = mProjection.project(position.getPosition());
+    if (auto const seconds = getElapsedSeconds(mLastTime, position.getTime());
+        seconds.has_value() && isPlausible(point, *seconds)) {
+        return accept(position, point, (point - mLastPoint) * (1.0f / *seconds));
+    }
+
+    // A real change of the movement, e.g. a sharp corner or the vehicle after a signal loss, is confirmed by the
+    // next fix. An outlier isn't, so the filter only continues at the rejected fix when the fix can be reached from
+    // it.
+    if (mRejectedPoint.has_value()) {
+        auto const seconds = getElapsedSeconds(mRejectedTime, position.getTime());
+        if (seconds.has_value() && (length(point - *mRejectedPoint) <= mLimits.maxVelocity * *seconds)) {
+            SPDLOG_DEBUG("The GPS fix at {} confirms the rejected fix before.", position.getTime().asString());
+            mLastPoint = *mRejectedPoint;
+            return accept(position, point, (point - *mRejectedPoint) * (1.0f / *seconds));
+        }
+    }
+    mRejectedPoint = point;
+    mRejectedTime = position.getTime();
+
+    ++mRejections;
+    if (mRejections >= mLimits.maxRejections) {
+        SPDLOG_INFO("{} implausible GPS fixes in a row, restart the plausibility filter.", mRejections);
+        reset();
+        return filter(position);
+    }
+    SPDLOG_DEBUG("Reject implausible GPS fix at {}", position.getTime().asString());
+    return std::nullopt;
+}
+
+void PlausibilityGpsPositionFilter::reset()
+{
+    mInitialized = false;
+    mLastVelocity.reset();
+    mRejectedPoint.reset();
+    mRejections = 0;
+}
+
+std::optional<GpsPositionData> PlausibilityGpsPositionFilter::accept(GpsPositionData const& position,
+                                                                     LocalPoint const& point,
+                                                                     std::optional<LocalPoint> const& velocity)
+{
+    mInitialized = true;
+    mLastPoint = point;
+    mLastTime = position.getTime();
+    mLastVelocity = velocity;
+    mRejectedPoint.reset();
+    mRejections = 0;
+    return position;
+}
+
+bool PlausibilityGpsPositionFilter::isPlausible(LocalPoint const& point, float seconds) const noexcept
+{
+    if (length(point - mLastPoint) > mLimits.maxVelocity * seconds) {
+        return false;
+    }
+    if (!mLastVelocity.has_value()) {
+        return true;
+    }
+    auto const predicted = mLastPoint + (*mLastVelocity * seconds);
+    auto const allowed = (0.5f * mLimits.maxAcceleration * seconds * seconds) + mLimits.positionTolerance;
+    return length(point - predicted) <= allowed;
+}
+
+std::optional<float> PlausibilityGpsPositionFilter::getElapsedSeconds(Timestamp const& from,
+                                                                      Timestamp const& to) noexcept
+{
+    // The difference of the timestamps wraps at midnight, a fix before the last fix gives more than half a day.
+    auto const elapsed = (to - from).toMilliseconds();
+    if ((elapsed <= 0) || (elapsed >= MaxElapsedMilliseconds)) {
+        return std::nullopt;
+    }
+    return static_cast<float>(elapsed) / 1000.0f;
+}
+
+} // namespace Rapid::Positioning
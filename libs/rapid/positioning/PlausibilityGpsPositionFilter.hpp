@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef RAPID_POSITIONING_PLAUSIBILITYGPSPOSITIONFILTER_HPP
+#define RAPID_POSITIONING_PLAUSIBILITYGPSPOSITIONFILTER_HPP
+
+#include "common/TrackGeometry.hpp"
+#include "positioning/IGpsPositionFilter.hpp"
+#include <cstdint>
+
+namespace Rapid::Positioning
+{
+
+/**
+ * Rejects fixes that the vehicle can't have reached from the last accepted fix, e.g. multipath outliers.
+ * A fix is rejected when
+ * - its time isn't after the last accepted fix,
+ * - the speed between the last accepted fix and the fix exceeds the maximum velocity,
+ * - the fix deviates from the position predicted with the last speed and heading by more than the maximum
+ *   acceleration and the position tolerance allow.
+ * A rejected fix is confirmed by the next fix when the next fix can be reached from it with the maximum velocity.
+ * Then the filter continues at the rejected fix, so a sharp corner or the jump after a signal loss only costs a
+ * single fix, but a single outlier is rejected. When the maximum number of fixes in a row is rejected, the filter
+ * starts again at the last rejected fix.
+ */
+class PlausibilityGpsPositionFilter final : public IGpsPositionFilter
+{
+public:
+    /**
+     * The limits of the plausibility checks.
+     */
+    struct Limits
+    {
+        float maxVelocity{100.0f};
+        float maxAcceleration{40.0f};
+        float positionTolerance{10.0f};
+        std::uint32_t maxRejections{5};
+    };
+
+    /**
+     * Creates a filter with the default limits.
+     */
+    PlausibilityGpsPositionFilter() noexcept;
+
+    /**
+     * Creates a plausibility filter.
+     * @param limits The limits of the plausibility checks. Velocities are in m/s, accelerations in m/s² and
+     *               the tolerance in meter.
+     */
+    explicit PlausibilityGpsPositionFilter(Limits const& limits) noexcept;
+
+    /**
+     * Default destructor
+     */
+    ~PlausibilityGpsPositionFilter() override = default;
+
+    /**
+     * Disabled copy constructor
+     */
+    PlausibilityGpsPositionFilter(PlausibilityGpsPositionFilter const&) = delete;
+
+    /**
+     * Disabled copy operator
+     */
+    PlausibilityGpsPositionFilter& operator=(PlausibilityGpsPositionFilter const&) = delete;
+
+    /**
+     * Disabled move constructor
+     */
+    PlausibilityGpsPositionFilter(PlausibilityGpsPositionFilter&&) noexcept = delete;
+
+    /**
+     * Disabled move operator
+     */
+    PlausibilityGpsPositionFilter& operator=(PlausibilityGpsPositionFilter&&) noexcept = delete;
+
+    /**
+     * @copydoc IGpsPositionFilter::filter
+     */
+    [[nodiscard]] std::optional<Common::GpsPositionData> filter(Common::GpsPositionData const& position) override;
+
+    /**
+     * @copydoc IGpsPositionFilter::reset
+     */
+    void reset() override;
+
+private:
+    std::optional<Common::GpsPositionData> accept(Common::GpsPositionData const& position,
+                                                  Common::LocalPoint const& point,
+                                                  std::optional<Common::LocalPoint> const& velocity);
+    bool isPlausible(Common::LocalPoint const& point, float seconds) const noexcept;
+    static std::optional<float> getElapsedSeconds(Common::Timestamp const& from, Common::Timestamp const& to) noexcept;
+
+private:
+    Limits mLimits;
+    bool mInitialized{false};
+    Common::LocalProjection mProjection;
+    Common::LocalPoint mLastPoint;
+    Common::Timestamp mLastTime;
+    std::optional<Common::LocalPoint> mLastVelocity;
+    std::optional<Common::LocalPoint> mRejectedPoint;
+    Common::Timestamp mRejectedTime;
+    std::uint32_t mRejections{0};
+};
+
+} // namespace Rapid::Positioning
+
+#endif // !RAPID_POSITIONING_PLAUSIBILITYGPSPOSITIONFILTER_HPP
@@ -3,10 +3,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "UbloxGpsPositionInformationProvider.hpp"
+#include <algorithm>
 #include <cc_ublox/Message.h>
 #include <cc_ublox/frame/UbloxFrame.h>
 #include <comms/process.h>
 #include <comms/units.h>
+#include <limits>
 #include <spdlog/spdlog.h>
 
 namespace Rapid::Positioning
@@ -32,9 +34,14 @@ class UbloxGpsPositionInformationProviderPrivate
 
 public:
     UbloxGpsPositionInformationProviderPrivate(UbloxGpsPositionInformationProvider* q,
-                                               std::unique_ptr<IUbloxDevice> device)
+                                               std::unique_ptr<IUbloxDevice> device,
+                                               std::chrono::milliseconds measurementRate)
         : ubloxDevice{std::move(device)}
         , mQ{q}
+        , mMeasurementRate{static_cast<std::uint16_t>(
+              std::clamp(measurementRate.count(),
+                         UbloxGpsPositionInformationProvider::MinimumMeasurementRate.count(),
+                         static_cast<std::chrono::milliseconds::rep>(std::numeric_limits<std::uint16_t>::max())))}
     {
         std::ignore = ubloxDevice->dataReady.connect([this] {
             processData();
@@ -103,15 +110,14 @@ public:
 
     void handle(InCfgRateMsg const& cfgRate)
     {
-        constexpr auto measRateInMs = std::uint16_t{40};
         using TimeRefEnum = cc_ublox::message::CfgRateFieldsCommon::TimeRefCommon::ValueType;
         auto measRate = cfgRate.field_measRate().getValue();
         auto navRate = cfgRate.field_navRate().getValue();
         auto timeRef = cfgRate.field_timeRef().value();
-        if (measRate != measRateInMs or navRate != 1 or timeRef != TimeRefEnum::UTC) {
+        if (measRate != mMeasurementRate or navRate != 1 or timeRef != TimeRefEnum::UTC) {
             using OutCfgRateMsg = cc_ublox::message::CfgRate<OutMessage>;
             auto outMsg = OutCfgRateMsg{};
-            outMsg.field_measRate().setValue(measRateInMs);
+            outMsg.field_measRate().setValue(mMeasurementRate);
             outMsg.field_navRate().setValue(1);
             outMsg.field_timeRef().setValue(TimeRefEnum::UTC);
             auto rawMsg = serialize(outMsg);
@@ -142,12 +148,12 @@ public:
         auto const hour = comms::units::getHours<int>(navPvt.field_hour());
         auto const min = comms::units::getMinutes<int>(navPvt.field_min());
         auto const sec = comms::units::getSeconds<int>(navPvt.field_sec());
-        int const fracMs = static_cast<int>(comms::units::getNanoseconds<int>(navPvt.field_nano()) * 1e-6);
-        auto time = Common::Timestamp{};
-        time.setHour(hour);
-        time.setMinute(min);
-        time.setSecond(sec);
-        time.setFractionalOfSecond(fracMs);
+        // The nano field is signed, the fraction of the second can be a negative correction of the second.
+        auto const fracMs = comms::units::getNanoseconds<std::int64_t>(navPvt.field_nano()) / 1'000'000;
+        auto const secondOfDay = Common::Timestamp{static_cast<std::uint8_t>(hour),
+                                                   static_cast<std::uint8_t>(min),
+                                                   static_cast<std::uint8_t>(sec)};
+        auto const time = Common::Timestamp::fromMilliseconds(secondOfDay.toMilliseconds() + fracMs);
 
         auto speedMeterPerSecond = comms::units::getMillimetersPerSecond<double>(navPvt.field_gSpeed()) / 1000;
         auto velocity = Common::VelocityData{speedMeterPerSecond};
@@ -202,8 +208,13 @@ public:
 
     void processData()
     {
-        auto data = ubloxDevice->read();
-        comms::processAllWithDispatch(data.data(), data.size(), frame, *this);
+        // With higher rates a read more often ends within a message, the incomplete message is kept until the rest
+        // of it is read.
+        auto const data = ubloxDevice->read();
+        mReadBuffer.insert(mReadBuffer.end(), data.cbegin(), data.cend());
+        auto const consumed = comms::processAllWithDispatch(mReadBuffer.data(), mReadBuffer.size(), frame, *this);
+        mReadBuffer.erase(mReadBuffer.begin(),
+                          mReadBuffer.begin() + static_cast<std::ptrdiff_t>(std::min(consumed, mReadBuffer.size())));
     }
 
     void navPvtSuccessfulConfigured()
@@ -222,10 +233,14 @@ public:
     UbloxGpsPositionInformationProvider* mQ;
     bool mCfgRatePolled = false;
     std::uint8_t numberOfSatellites = 0;
+    std::uint16_t mMeasurementRate;
+    std::vector<std::uint8_t> mReadBuffer;
 };
 
-UbloxGpsPositionInformationProvider::UbloxGpsPositionInformationProvider(std::unique_ptr<IUbloxDevice> dataProvider)
-    : mD{std::make_unique<UbloxGpsPositionInformationProviderPrivate>(this, std::move(dataProvider))}
+UbloxGpsPositionInformationProvider::UbloxGpsPositionInformationProvider(std::unique_ptr<IUbloxDevice> dataProvider,
+                                                                         std::chrono::milliseconds measurementRate)
+    : mD{std::make_unique<UbloxGpsPositionInformationProviderPrivate>(
+          this, std::move(dataProvider), measurementRate)}
 {
 }
 
@@ -5,6 +5,7 @@
 #ifndef RAPID_POSITIONING_UBLOXGPSPOSITIONINFORMATIONPROVIDER_HPP
 #define RAPID_POSITIONING_UBLOXGPSPOSITIONINFORMATIONPROVIDER_HPP
 
+#include <chrono>
 #include <positioning/IGPSInformationProvider.hpp>
 #include <positioning/IGpsPositionProvider.hpp>
 #include <positioning/IUbloxDevice.hpp>
@@ -24,6 +25,16 @@ class UbloxGpsPositionInformationProviderPrivate;
 class UbloxGpsPositionInformationProvider final : public IGpsPositionProvider, public IGpsInformationProvider
 {
 public:
+    /**
+     * The default time between two measurements of the receiver, this is a rate of 25 Hz.
+     */
+    static constexpr auto DefaultMeasurementRate = std::chrono::milliseconds{40};
+
+    /**
+     * The shortest supported time between two measurements of the receiver, this is a rate of 100 Hz.
+     */
+    static constexpr auto MinimumMeasurementRate = std::chrono::milliseconds{10};
+
     /**
      * @brief Creates an instance of the @ref UbloxGpsPositionInformationProvider
      *
@@ -31,8 +42,11 @@ public:
      *          In case of an error during this process the signal @ref errorOccured is emitted.
      *
      * @param device The device that shall be used to send and receive messages.
+     * @param measurementRate The time between two measurements that is configured on the receiver. Shorter times
+     *                        than @ref MinimumMeasurementRate are limited to it.
      */
-    UbloxGpsPositionInformationProvider(std::unique_ptr<IUbloxDevice> device);
+    UbloxGpsPositionInformationProvider(std::unique_ptr<IUbloxDevice> device,
+                                        std::chrono::milliseconds measurementRate = DefaultMeasurementRate);
 
     /**
      * @brief Default destructor
@@ -6,6 +6,7 @@
 #define ISESSIONDATABASE_HPP
 
 #include "common/SessionData.hpp"
+#include "common/SessionView.hpp"
 #include "system/AsyncResult.hpp"
 #include <kdbindings/signal.h>
 #include <memory>
@@ -23,6 +24,12 @@ using GetSessionResult = System::AsyncResultWithValue<Common::SessionData>;
  */
 using GetSessionMetaDataResult = System::AsyncResultWithValue<Common::SessionMetaData>;
 
+/**
+ * Alias for the @ref ISessionDatabase::openSession result.
+ * The value is the handle of the opened session that is passed to @ref ISessionDatabase::appendLap.
+ */
+using OpenSessionResult = System::AsyncResultWithValue<std::size_t>;
+
 /**
  * The SessionDatabase provides an index based access to the stored session data.
  */
@@ -68,6 +75,15 @@ public:
      */
     virtual std::optional<Common::SessionData> getSessionByIndex(std::size_t index) const noexcept = 0;
 
+    /**
+     * Gives a view of the session by the index. If index doesn't exists a nullopt is returned.
+     * Only the meta data and the lap and sector times are read, the telemetry of a lap is read
+     * when it's requested from the view for the first time.
+     * @param index The index of the request session.
+     * @return The view of the session by the given index or a nullopt.
+     */
+    virtual std::optional<Common::SessionView> getSessionViewByIndex(std::size_t index) const noexcept = 0;
+
     /**
      * Gives the session by the index in async manner, so the call doesn't block the calling thread.
      * If index doesn't exists a the result is marked as error.
@@ -100,6 +116,24 @@ public:
      */
     virtual std::shared_ptr<System::AsyncResult> storeSession(Common::SessionData const& session) = 0;
 
+    /**
+     * Opens a session for storing its laps one by one with @ref appendLap.
+     * The session is created without laps, a stored session with the same date and time is continued.
+     * @param metaData The meta data of the session that shall be opened.
+     * @return The handle of the opened session or an error.
+     */
+    virtual std::shared_ptr<OpenSessionResult> openSession(Common::SessionMetaData const& metaData) = 0;
+
+    /**
+     * Appends a finished lap to an opened session. Only the lap is written, the already stored laps of the
+     * session are neither read nor written again, so the cost of an append doesn't grow with the session.
+     * The laps are stored in the order of the calls.
+     * @param sessionHandle The handle of the session that is given by @ref openSession.
+     * @param lap The lap that shall be appended.
+     * @return The result of the append operation.
+     */
+    virtual std::shared_ptr<System::AsyncResult> appendLap(std::size_t sessionHandle, Common::LapData&& lap) = 0;
+
     /**
      * Deletes the session under the given index.
      * If the index is not present nothing happens.
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "SqliteSessionDatabase.hpp"
+#include "common/SessionArena.hpp"
+#include "common/TrackRegistry.hpp"
 #include "private/Statement.hpp"
 #include <algorithm>
 #include <cstring>
@@ -13,6 +15,33 @@ using namespace Rapid::Storage::Private;
 namespace Rapid::Storage
 {
 
+namespace
+{
+
+/**
+ * The number of log points that are inserted with a single statement. SQLite supports at least 999 parameters in a
+ * statement, a log point has 7 of them.
+ */
+constexpr auto LogPointBatchSize = std::size_t{128};
+
+/**
+ * Gives the statement that inserts @ref LogPointBatchSize log points.
+ */
+std::string const& getInsertLogPointBatchQuery()
+{
+    static auto const query = [] {
+        auto batchQuery = std::string{"INSERT INTO LogPoint(Idx, LapId, Velocity, Longitude, Latitude, Date, Time) "
+                                      "VALUES "};
+        for (std::size_t row = 0; row < LogPointBatchSize; ++row) {
+            batchQuery += (row == 0) ? "(?, ?, ?, ?, ?, ?, ?)" : ", (?, ?, ?, ?, ?, ?, ?)";
+        }
+        return batchQuery;
+    }();
+    return query;
+}
+
+} // namespace
+
 SqliteSessionDatabase::SqliteSessionDatabase(std::string const& databaseFile)
     : mDbConnection{Connection::connection(databaseFile)}
 {
@@ -43,6 +72,12 @@ std::optional<Common::SessionData> SqliteSessionDatabase::getSessionByIndex(std:
     return readSession(index);
 }
 
+std::optional<Common::SessionView> SqliteSessionDatabase::getSessionViewByIndex(std::size_t index) const noexcept
+{
+    std::lock_guard<std::mutex> const guard{mMutex};
+    return readSessionView(index);
+}
+
 std::shared_ptr<GetSessionResult> SqliteSessionDatabase::getSessionByIndexAsync(std::size_t index) noexcept
 {
     std::lock_guard<std::mutex> const guard{mMutex};
@@ -125,6 +160,10 @@ std::shared_ptr<System::AsyncResult> SqliteSessionDatabase::storeSession(Common:
 {
     std::lock_guard<std::mutex> const guard{mMutex};
     auto sessionId = readSessionId(session);
+    if (sessionId.has_value()) {
+        // The stored laps change, the next append counts them again.
+        mNextLapIndex.erase(*sessionId);
+    }
 
     auto storageContext = std::make_shared<Private::SessionStorageContext>();
     mStorageCache.emplace(storageContext.get(), storageContext);
@@ -165,6 +204,95 @@ std::shared_ptr<System::AsyncResult> SqliteSessionDatabase::storeSession(Common:
     return storageContext->mResult;
 }
 
+std::shared_ptr<OpenSessionResult> SqliteSessionDatabase::openSession(Common::SessionMetaData const& metaData)
+{
+    std::lock_guard<std::mutex> const guard{mMutex};
+    auto result = std::make_shared<OpenSessionResult>();
+    auto context = std::make_shared<Private::SessionStorageContextWithValue<std::size_t>>(result);
+    context->mSessionData = metaData;
+    mStorageCache.emplace(context.get(), context);
+    std::ignore = context->done.connect([this](Private::StorageContextBase* ctx) {
+        auto sessionCtx =
+            StorageContextBase::getStorageAs<SessionStorageContextWithValue<std::size_t>>(mStorageCache[ctx]);
+        auto const result = sessionCtx->mStorageResult.getResult() ? System::Result::Ok : System::Result::Error;
+        if (result == System::Result::Ok) {
+            sessionCtx->getResultAs<OpenSessionResult>()->setResultValue(sessionCtx->value);
+        } else {
+            SPDLOG_ERROR("Failed to open session from {} at {}. Error: {}",
+                         sessionCtx->mSessionData.getSessionDate().asString(),
+                         sessionCtx->mSessionData.getSessionTime().asString(),
+                         mDbConnection->getErrorMessage());
+        }
+        sessionCtx->mResult->setResult(result);
+        if (sessionCtx->mStorageThread.joinable()) {
+            sessionCtx->mStorageThread.join();
+        }
+        mStorageCache.erase(ctx);
+    });
+    context->mStorageThread = std::thread{[this, context]() {
+        createSession(context);
+    }};
+    return result;
+}
+
+std::shared_ptr<System::AsyncResult> SqliteSessionDatabase::appendLap(std::size_t sessionHandle, Common::LapData&& lap)
+{
+    std::lock_guard<std::mutex> const guard{mMutex};
+    // The lap index is assigned in the order of the calls, the stored laps are only counted for the first append.
+    auto nextLapIndex = mNextLapIndex.find(sessionHandle);
+    if (nextLapIndex == mNextLapIndex.end()) {
+        // A storage thread may write laps of the session in its transaction, they are counted after the commit.
+        auto lapIds = std::optional<std::vector<std::size_t>>{};
+        {
+            std::lock_guard<std::mutex> const writeGuard{*mWriteMutex};
+            lapIds = readLapIdsOfSession(sessionHandle);
+        }
+        if (!lapIds.has_value()) {
+            SPDLOG_ERROR("Failed to append lap to session with ID {}. Error: {}",
+                         sessionHandle,
+                         mDbConnection->getErrorMessage());
+            auto result = std::make_shared<System::AsyncResult>();
+            result->setResult(System::Result::Error);
+            return result;
+        }
+        nextLapIndex = mNextLapIndex.emplace(sessionHandle, lapIds->size()).first;
+    }
+
+    auto context = std::make_shared<Private::SessionStorageContextWithValue<std::size_t>>(
+        std::make_shared<System::AsyncResult>());
+    context->mSessionId = sessionHandle;
+    context->value = nextLapIndex->second++;
+    context->mStorageObject.addLap(std::move(lap));
+    mStorageCache.emplace(context.get(), context);
+    {
+        std::lock_guard<std::mutex> const queueGuard{mAppendQueueMutex};
+        mAppendQueue.push_back(context);
+    }
+    std::ignore = context->done.connect([this](Private::StorageContextBase* ctx) {
+        auto sessionCtx =
+            StorageContextBase::getStorageAs<SessionStorageContextWithValue<std::size_t>>(mStorageCache[ctx]);
+        auto const result = sessionCtx->mStorageResult.getResult() ? System::Result::Ok : System::Result::Error;
+        if (result == System::Result::Error) {
+            SPDLOG_ERROR("Failed to append lap {} to session with ID {}. Error: {}",
+                         sessionCtx->value,
+                         sessionCtx->mSessionId,
+                         mDbConnection->getErrorMessage());
+            // The lap index is not used, the next append counts the stored laps again.
+            std::lock_guard<std::mutex> const guard{mMutex};
+            mNextLapIndex.erase(sessionCtx->mSessionId);
+        }
+        sessionCtx->mResult->setResult(result);
+        if (sessionCtx->mStorageThread.joinable()) {
+            sessionCtx->mStorageThread.join();
+        }
+        mStorageCache.erase(ctx);
+    });
+    context->mStorageThread = std::thread{[this]() {
+        saveNextAppendedLap();
+    }};
+    return context->mResult;
+}
+
 void SqliteSessionDatabase::deleteSession(std::size_t index)
 {
     std::lock_guard<std::mutex> const guard{mMutex};
@@ -181,6 +309,9 @@ void SqliteSessionDatabase::deleteSession(std::size_t index)
         return;
     }
 
+    mNextLapIndex.erase(sessionIndex->second);
+
+    std::lock_guard<std::mutex> const writeGuard{*mWriteMutex};
     auto sessionDeleteStm = Statement{*mDbConnection};
     auto bindError =
         sessionDeleteStm.prepare(sessionDeleteQuery).bindValue(1, static_cast<int>(sessionIndex->second)).hasError();
@@ -193,6 +324,7 @@ void SqliteSessionDatabase::deleteSession(std::size_t index)
 
 void SqliteSessionDatabase::updateSession(Private::SessionStorageContext* ctx)
 {
+    std::lock_guard<std::mutex> const guard{*mWriteMutex};
     if (ctx == nullptr or mStorageCache.count(ctx) == 0) {
         SPDLOG_ERROR("Update session called with an invalid context.");
         return;
@@ -200,8 +332,8 @@ void SqliteSessionDatabase::updateSession(Private::SessionStorageContext* ctx)
 
     auto context = mStorageCache.at(ctx);
     // In the update case it's only necessary to add new laps to session if needed because other parts of a session
-    // shouldn't be changed.
-    auto const storedLaps = readLapsOfSession(context->mSessionId);
+    // shouldn't be changed. Only the stored laps are counted, their times and log points aren't needed.
+    auto const storedLaps = readLapIdsOfSession(context->mSessionId);
     if (!storedLaps.has_value()) {
         ctx->mStoragePromise.set_value(false);
         return;
@@ -238,6 +370,7 @@ void SqliteSessionDatabase::updateSession(Private::SessionStorageContext* ctx)
 
 void SqliteSessionDatabase::saveSession(Private::SessionStorageContext* ctx)
 {
+    std::lock_guard<std::mutex> const guard{*mWriteMutex};
     if (ctx == nullptr or mStorageCache.count(ctx) == 0) {
         spdlog::error("Update session called with an invalid context.");
         return;
@@ -245,21 +378,9 @@ void SqliteSessionDatabase::saveSession(Private::SessionStorageContext* ctx)
 
     auto context = mStorageCache.at(ctx);
     auto commitGuard = CommitGuard{*mDbConnection};
-    // clang-format off
-    constexpr auto insertQuery = "INSERT INTO SESSION (TrackId, Date, Time) "
-                                 "VALUES "
-                                 "((SELECT TrackId FROM Track WHERE Track.Name = ?), ?, ?)";
-    // clang-format on
 
     // insert the session
-    auto insertStm = Statement{*mDbConnection};
-    auto bindError = insertStm.prepare(insertQuery)
-                         .bindValue(1, ctx->mStorageObject.getTrack().getTrackName())
-                         .bindValue(2, ctx->mStorageObject.getSessionDate().asString())
-                         .bindValue(3, ctx->mStorageObject.getSessionTime().asString())
-                         .hasError();
-    if (bindError or (insertStm.execute() != ExecuteResult::Ok)) {
-        SPDLOG_ERROR("Error insert session. Error:", mDbConnection->getErrorMessage());
+    if (!saveSessionMetaData(ctx->mStorageObject)) {
         ctx->mStoragePromise.set_value(false);
         commitGuard.setRollback();
         return;
@@ -293,6 +414,50 @@ void SqliteSessionDatabase::saveSession(Private::SessionStorageContext* ctx)
     ctx->mStoragePromise.set_value(true);
 }
 
+void SqliteSessionDatabase::createSession(std::shared_ptr<Private::SessionStorageContextWithValue<std::size_t>> ctx)
+{
+    std::lock_guard<std::mutex> const guard{*mWriteMutex};
+    auto commitGuard = CommitGuard{*mDbConnection};
+    auto sessionId = readSessionId(ctx->mSessionData);
+    if (!sessionId.has_value()) {
+        if (!saveSessionMetaData(ctx->mSessionData)) {
+            ctx->mStoragePromise.set_value(false);
+            commitGuard.setRollback();
+            return;
+        }
+        sessionId = readSessionId(ctx->mSessionData);
+    }
+
+    if (!sessionId.has_value()) {
+        SPDLOG_ERROR("Failed to query session of opened session");
+        ctx->mStoragePromise.set_value(false);
+        commitGuard.setRollback();
+        return;
+    }
+    ctx->value = *sessionId;
+    ctx->mStoragePromise.set_value(true);
+}
+
+void SqliteSessionDatabase::saveNextAppendedLap()
+{
+    std::lock_guard<std::mutex> const guard{*mWriteMutex};
+    auto ctx = std::shared_ptr<Private::SessionStorageContextWithValue<std::size_t>>{};
+    {
+        std::lock_guard<std::mutex> const queueGuard{mAppendQueueMutex};
+        ctx = mAppendQueue.front();
+        mAppendQueue.pop_front();
+    }
+
+    auto commitGuard = CommitGuard{*mDbConnection};
+    if (!saveLapOfSession(ctx->mSessionId, ctx->value, ctx->mStorageObject.getLaps().front())) {
+        ctx->mStoragePromise.set_value(false);
+        commitGuard.setRollback();
+        return;
+    }
+    SPDLOG_DEBUG("Successful appended lap {} to session with ID {}", ctx->value, ctx->mSessionId);
+    ctx->mStoragePromise.set_value(true);
+}
+
 void SqliteSessionDatabase::readSession(
     std::shared_ptr<Private::SessionStorageContextWithValue<Common::SessionData>> ctx) const
 {
@@ -339,7 +504,7 @@ std::optional<std::size_t> SqliteSessionDatabase::readSessionIdOfIndex(std::size
     return sessionIds[sessionIndex];
 }
 
-std::optional<std::size_t> SqliteSessionDatabase::readSessionId(Common::SessionData const& session) const noexcept
+std::optional<std::size_t> SqliteSessionDatabase::readSessionId(Common::SessionMetaData const& session) const noexcept
 {
     // clang-format off
     constexpr auto sessionIdQuery = "SELECT "
@@ -407,6 +572,35 @@ std::vector<std::size_t> SqliteSessionDatabase::readSessionIds() const noexcept
 
 std::optional<std::vector<Common::LapData>> SqliteSessionDatabase::readLapsOfSession(
     std::size_t sessionId) const noexcept
+{
+    auto const lapIds = readLapIdsOfSession(sessionId);
+    if (!lapIds.has_value()) {
+        return std::nullopt;
+    }
+
+    // All log points of the session are allocated in one arena that is released with the last lap.
+    auto const arena = std::shared_ptr<std::pmr::memory_resource>{Common::SessionArena::create()};
+    auto laps = std::vector<Common::LapData>{};
+    laps.reserve(lapIds->size());
+    for (auto const& lapId : lapIds.value()) {
+        auto lapData = readLapTimes(sessionId, lapId);
+        if (!lapData.has_value()) {
+            return std::nullopt;
+        }
+
+        auto telemetry = readLapTelemetry(*mDbConnection, lapId, arena);
+        if (!telemetry.has_value()) {
+            return std::nullopt;
+        }
+        lapData->setTelemetry(std::move(telemetry.value()));
+        laps.push_back(std::move(lapData.value()));
+    }
+
+    return laps;
+}
+
+std::optional<std::vector<std::size_t>> SqliteSessionDatabase::readLapIdsOfSession(
+    std::size_t sessionId) const noexcept
 {
     // clang-format off
     constexpr auto lapIdQuery = "SELECT "
@@ -414,23 +608,9 @@ std::optional<std::vector<Common::LapData>> SqliteSessionDatabase::readLapsOfSes
                                 "FROM "
                                     "Lap "
                                 "WHERE "
-                                    "Lap.SessionId = ?";
-    constexpr auto sektorQuery = "SELECT "
-                                    "SektorTime.Time "
-                                 "FROM "
-                                    "Session "
-                                 "LEFT JOIN LAP ON "
-                                    "Session.SessionId = Lap.SessionId "
-                                 "LEFT JOIN SektorTime ON "
-                                    "SektorTime.LapId = Lap.LapId "
-                                 "WHERE "
-                                     "Session.SessionId = ? AND SektorTime.LapId = ? ORDER BY SektorTime.SektorIndex AND Lap.LapIndex ASC";
-    constexpr auto logPointQuery = "SELECT "
-                                    "LogPoint.Longitude, LogPoint.Latitude, LogPoint.Velocity, LogPoint.Date, LogPoint.Time "
-                                   "FROM "
-                                    "LogPoint "
-                                   "WHERE "
-                                     "LogPoint.LapId = ? ORDER By LogPoint.Idx";
+                                    "Lap.SessionId = ? "
+                                "ORDER BY "
+                                    "Lap.LapIndex ASC";
     // clang-format on
     auto lapIds = std::vector<std::size_t>{};
     auto lapIdStm = Statement{*mDbConnection};
@@ -453,65 +633,126 @@ std::optional<std::vector<Common::LapData>> SqliteSessionDatabase::readLapsOfSes
         return std::nullopt;
     }
 
-    auto laps = std::vector<Common::LapData>{};
-    for (auto const& lapId : lapIds) {
-        auto lapData = Common::LapData{};
-        auto sektorStm = Statement{*mDbConnection};
-        auto bindError = sektorStm.prepare(sektorQuery)
-                             .bindValue(1, static_cast<int>(sessionId))
-                             .bindValue(2, static_cast<int>(lapId))
-                             .hasError();
-        if (bindError) {
-            spdlog::error("Error prepare lap query. Error: {}", mDbConnection->getErrorMessage());
-            return std::nullopt;
-        }
+    return lapIds;
+}
 
-        while (((state = sektorStm.execute()) == ExecuteResult::Row) && (sektorStm.getColumnCount() > 0)) {
-            auto const sektorTime = sektorStm.getColumn<std::string>(0);
-            if (sektorTime.has_value()) {
-                lapData.addSectorTime(Common::Timestamp{sektorTime.value_or("")});
-            }
-        }
+std::optional<Common::LapData> SqliteSessionDatabase::readLapTimes(std::size_t sessionId,
+                                                                   std::size_t lapId) const noexcept
+{
+    // clang-format off
+    constexpr auto sektorQuery = "SELECT "
+                                    "SektorTime.Time "
+                                 "FROM "
+                                    "Session "
+                                 "LEFT JOIN LAP ON "
+                                    "Session.SessionId = Lap.SessionId "
+                                 "LEFT JOIN SektorTime ON "
+                                    "SektorTime.LapId = Lap.LapId "
+                                 "WHERE "
+                                     "Session.SessionId = ? AND SektorTime.LapId = ? ORDER BY Lap.LapIndex, SektorTime.SektorIndex ASC";
+    // clang-format on
+    auto lapData = Common::LapData{};
+    auto sektorStm = Statement{*mDbConnection};
+    auto const bindError = sektorStm.prepare(sektorQuery)
+                               .bindValue(1, static_cast<int>(sessionId))
+                               .bindValue(2, static_cast<int>(lapId))
+                               .hasError();
+    if (bindError) {
+        spdlog::error("Error prepare lap query. Error: {}", mDbConnection->getErrorMessage());
+        return std::nullopt;
+    }
 
-        if (state != ExecuteResult::Ok) {
-            spdlog::error("Error query lap ids. Error: {}", mDbConnection->getErrorMessage());
-            return std::nullopt;
+    auto state = ExecuteResult::Error;
+    while (((state = sektorStm.execute()) == ExecuteResult::Row) && (sektorStm.getColumnCount() > 0)) {
+        auto const sektorTime = sektorStm.getColumn<std::string>(0);
+        if (sektorTime.has_value()) {
+            lapData.addSectorTime(Common::Timestamp{sektorTime.value_or("")});
         }
+    }
 
-        auto logPointStm = Statement{*mDbConnection};
-        bindError = logPointStm.prepare(logPointQuery).bindValue(1, static_cast<int>(lapId)).hasError();
-        if (bindError) {
-            spdlog::error("Error prepare logpoint query. Error {}", mDbConnection->getErrorMessage());
-            return std::nullopt;
-        }
+    if (state != ExecuteResult::Ok) {
+        spdlog::error("Error query lap ids. Error: {}", mDbConnection->getErrorMessage());
+        return std::nullopt;
+    }
 
-        while (((state = logPointStm.execute()) == ExecuteResult::Row) && (logPointStm.getColumnCount() > 0)) {
-            auto const longitude = logPointStm.getColumn<float>(0);
-            auto const latitude = logPointStm.getColumn<float>(1);
-            auto const velocity = logPointStm.getColumn<float>(2);
-            auto const date = logPointStm.getColumn<std::string>(3);
-            auto const time = logPointStm.getColumn<std::string>(4);
-            if (longitude.has_value() and latitude.has_value() and velocity.has_value() and date.has_value() and
-                time.has_value()) {
-                lapData.addPosition(Common::GpsPositionData{Common::PositionData{latitude.value(), longitude.value()},
-                                                            Common::Timestamp{time.value()},
-                                                            Common::Date{date.value()},
-                                                            Common::VelocityData{velocity.value()}});
-            }
+    return lapData;
+}
+
+std::optional<Common::LapTelemetry> SqliteSessionDatabase::readLapTelemetry(
+    Private::Connection& connection,
+    std::size_t lapId,
+    std::shared_ptr<std::pmr::memory_resource> const& resource) noexcept
+{
+    // clang-format off
+    constexpr auto logPointQuery = "SELECT "
+                                    "LogPoint.Longitude, LogPoint.Latitude, LogPoint.Velocity, LogPoint.Date, LogPoint.Time "
+                                   "FROM "
+                                    "LogPoint "
+                                   "WHERE "
+                                     "LogPoint.LapId = ? ORDER By LogPoint.Idx";
+    // clang-format on
+    auto logPointStm = Statement{connection};
+    auto const bindError = logPointStm.prepare(logPointQuery).bindValue(1, static_cast<int>(lapId)).hasError();
+    if (bindError) {
+        spdlog::error("Error prepare logpoint query. Error {}", connection.getErrorMessage());
+        return std::nullopt;
+    }
+
+    // clang-format off
+    constexpr auto logPointCountQuery = "SELECT "
+                                            "COUNT(*) "
+                                        "FROM "
+                                            "LogPoint "
+                                        "WHERE "
+                                            "LogPoint.LapId = ?";
+    // clang-format on
+    auto logPointCountStm = Statement{connection};
+    auto const countBindError =
+        logPointCountStm.prepare(logPointCountQuery).bindValue(1, static_cast<int>(lapId)).hasError();
+    if (countBindError or (logPointCountStm.execute() != ExecuteResult::Row)) {
+        spdlog::error("Error query logpoint count. Error {}", connection.getErrorMessage());
+        return std::nullopt;
+    }
+
+    // The columns are allocated from a monotonic arena that doesn't release a grown buffer, so they are reserved once.
+    auto telemetry = Common::LapTelemetry{resource};
+    telemetry.reserve(static_cast<std::size_t>(logPointCountStm.getColumn<int>(0).value_or(0)));
+    auto state = ExecuteResult::Error;
+    while (((state = logPointStm.execute()) == ExecuteResult::Row) && (logPointStm.getColumnCount() > 0)) {
+        auto const longitude = logPointStm.getColumn<float>(0);
+        auto const latitude = logPointStm.getColumn<float>(1);
+        auto const velocity = logPointStm.getColumn<float>(2);
+        auto const date = logPointStm.getColumn<std::string>(3);
+        auto const time = logPointStm.getColumn<std::string>(4);
+        if (longitude.has_value() and latitude.has_value() and velocity.has_value() and date.has_value() and
+            time.has_value()) {
+            telemetry.append(Common::GpsPositionData{Common::PositionData{latitude.value(), longitude.value()},
+                                                     Common::Timestamp{time.value()},
+                                                     Common::Date{date.value()},
+                                                     Common::VelocityData{velocity.value()}});
         }
-        laps.push_back(lapData);
     }
 
-    return laps;
+    return telemetry;
 }
 
 std::optional<Common::TrackData> SqliteSessionDatabase::readTrack(std::size_t trackId) const noexcept
 {
+    {
+        std::lock_guard<std::mutex> const guard{mTrackCacheMutex};
+        auto const cachedTrack = mTrackCache.find(trackId);
+        if (cachedTrack != mTrackCache.cend()) {
+            return cachedTrack->second;
+        }
+    }
+
     // clang-format off
     constexpr auto trackQuery =
         "SELECT TrackId, Track.Name, FL.Latitude AS FlLat, FL.Longitude AS FlLong, "
-        "SL.Latitude AS SlLat, SL.Longitude AS SlLong from Track LEFT JOIN Position FL ON Track.Finishline = "
-        "FL.PositionId LEFT JOIN Position SL ON Track.Startline = SL.PositionId WHERE Track.TrackId = ?";
+        "SL.Latitude AS SlLat, SL.Longitude AS SlLong, Track.Topology, PL.Latitude AS PlLat, PL.Longitude AS PlLong "
+        "from Track LEFT JOIN Position FL ON Track.Finishline = FL.PositionId LEFT JOIN Position SL ON "
+        "Track.Startline = SL.PositionId LEFT JOIN Position PL ON Track.PitLanePositionId = PL.PositionId "
+        "WHERE Track.TrackId = ?";
 
     constexpr auto sektorQuery =
         "SELECT PO.Latitude, PO.Longitude FROM Track JOIN Sektor SE ON Track.TrackId = SE.TrackId JOIN "
@@ -529,6 +770,11 @@ std::optional<Common::TrackData> SqliteSessionDatabase::readTrack(std::size_t tr
     if (stm.hasColumnValue(4) == HasColumnValueResult::Ok && stm.hasColumnValue(5) == HasColumnValueResult::Ok) {
         track.setStartline({stm.getColumn<float>(4).value_or(0), stm.getColumn<float>(5).value_or(0)});
     }
+    track.setTopology(static_cast<Common::TrackTopology>(stm.getColumn<int>(6).value_or(0)));
+    if (stm.hasColumnValue(7) == HasColumnValueResult::Ok && stm.hasColumnValue(8) == HasColumnValueResult::Ok) {
+        track.setPitLaneLine(
+            Common::PositionData{stm.getColumn<float>(7).value_or(0), stm.getColumn<float>(8).value_or(0)});
+    }
 
     // Request sektor
     Statement sektorStm{*mDbConnection};
@@ -541,8 +787,32 @@ std::optional<Common::TrackData> SqliteSessionDatabase::readTrack(std::size_t tr
     while (sektorStm.execute() == ExecuteResult::Row && sektorStm.getColumnCount() == 2) {
         sections.emplace_back(sektorStm.getColumn<float>(0).value_or(0), sektorStm.getColumn<float>(1).value_or(0));
     }
-    track.setSections(sections);
-    return track;
+    track.setSections(std::move(sections));
+
+    auto internedTrack = Common::TrackRegistry::instance().intern(track);
+    std::lock_guard<std::mutex> const guard{mTrackCacheMutex};
+    mTrackCache.insert_or_assign(trackId, internedTrack);
+    return internedTrack;
+}
+
+bool SqliteSessionDatabase::saveSessionMetaData(Common::SessionMetaData const& metaData) const noexcept
+{
+    // clang-format off
+    constexpr auto insertQuery = "INSERT INTO SESSION (TrackId, Date, Time) "
+                                 "VALUES "
+                                 "((SELECT TrackId FROM Track WHERE Track.Name = ?), ?, ?)";
+    // clang-format on
+    auto insertStm = Statement{*mDbConnection};
+    auto const bindError = insertStm.prepare(insertQuery)
+                               .bindValue(1, metaData.getTrack().getTrackName())
+                               .bindValue(2, metaData.getSessionDate().asString())
+                               .bindValue(3, metaData.getSessionTime().asString())
+                               .hasError();
+    if (bindError or (insertStm.execute() != ExecuteResult::Ok)) {
+        SPDLOG_ERROR("Error insert session. Error: {}", mDbConnection->getErrorMessage());
+        return false;
+    }
+    return true;
 }
 
 bool SqliteSessionDatabase::saveLapOfSession(std::size_t sessionId,
@@ -569,8 +839,9 @@ bool SqliteSessionDatabase::saveLapOfSession(std::size_t sessionId,
 
     auto lapId = static_cast<int>(readLapId(sessionId, lapIndex).value_or(0));
     auto insertSektorStm = Statement{*mDbConnection};
+    insertSektorStm.prepare(insetSektorQuery);
     for (std::size_t sektorTimeIndex = 0; sektorTimeIndex < lapData.getSectorTimeCount(); ++sektorTimeIndex) {
-        bindError = insertSektorStm.prepare(insetSektorQuery)
+        bindError = insertSektorStm.reset()
                         .bindValue(1, lapId)
                         .bindValue(2, lapData.getSectorTime(sektorTimeIndex).value_or(Common::Timestamp{}).asString())
                         .bindValue(3, static_cast<int>(sektorTimeIndex))
@@ -581,40 +852,80 @@ bool SqliteSessionDatabase::saveLapOfSession(std::size_t sessionId,
         }
     }
 
-    if (!saveLapLogPoints(lapId, lapData)) {
+    if (!saveLapLogPoints(lapId, lapData.getTelemetry())) {
         return false;
     }
     return true;
 }
 
-bool SqliteSessionDatabase::saveLapLogPoints(std::size_t lapId, Common::LapData const& lapData) const noexcept
+bool SqliteSessionDatabase::saveLapLogPoints(std::size_t lapId, Common::LapTelemetry const& telemetry) const noexcept
 {
     // clang-format off
     constexpr auto insertLogPoint = "INSERT INTO LogPoint(Idx, LapId, Velocity, Longitude, Latitude, Date, Time) "
                                     "VALUES "
                                     "(?, ?, ?, ?, ?, ?, ?)";
     // clang-format on
-    auto const& positions = lapData.getPositions();
-    auto insertLogPointStm = Statement{*mDbConnection};
-    for (std::size_t idx = 0; idx < positions.size(); ++idx) {
-        auto const gpsPos = positions.at(idx);
-        auto const bindError = insertLogPointStm.prepare(insertLogPoint)
-                                   .bindValue(1, static_cast<int>(idx))
-                                   .bindValue(2, static_cast<int>(lapId))
-                                   .bindValue(3, gpsPos.getVelocity().getVelocity())
-                                   .bindValue(4, gpsPos.getPosition().getLongitude())
-                                   .bindValue(5, gpsPos.getPosition().getLatitude())
-                                   .bindValue(6, gpsPos.getDate().asString())
-                                   .bindValue(7, gpsPos.getTime().asString())
-                                   .hasError();
-        if (bindError) {
+    auto const velocities = telemetry.getVelocities();
+    auto const longitudes = telemetry.getLongitudes();
+    auto const latitudes = telemetry.getLatitudes();
+    auto const dates = telemetry.getDates();
+    auto const times = telemetry.getTimes();
+
+    // The log points of a lap are usually recorded on the same day, the date is only formatted when it changes.
+    auto lastDate = std::optional<Common::Date>{};
+    auto lastDateString = std::string{};
+    auto const bindLogPoint = [&](Statement& statement, std::size_t row, std::size_t idx) {
+        if (!lastDate.has_value() or (*lastDate != dates[idx])) {
+            lastDate = dates[idx];
+            lastDateString = dates[idx].asString();
+        }
+        auto const offset = row * 7;
+        statement.bindValue(offset + 1, static_cast<int>(idx))
+            .bindValue(offset + 2, static_cast<int>(lapId))
+            .bindValue(offset + 3, velocities[idx])
+            .bindValue(offset + 4, longitudes[idx])
+            .bindValue(offset + 5, latitudes[idx])
+            .bindValue(offset + 6, lastDateString)
+            .bindValue(offset + 7, times[idx].asString());
+    };
+    auto const executeInsert = [&](Statement& statement) {
+        if (statement.hasError()) {
             SPDLOG_ERROR("Failed to bind values LogPoint statement. Error: {}", mDbConnection->getErrorMessage());
             return false;
         }
-        if (insertLogPointStm.execute() != ExecuteResult::Ok) {
+        if (statement.execute() != ExecuteResult::Ok) {
             SPDLOG_ERROR("Failed to execute LogPoint statement. Error: {}", mDbConnection->getErrorMessage());
             return false;
         }
+        return true;
+    };
+
+    // The log points are inserted in batches of multiple rows, the remaining log points are inserted one by one.
+    auto idx = std::size_t{0};
+    if (telemetry.size() >= LogPointBatchSize) {
+        auto insertBatchStm = Statement{*mDbConnection};
+        insertBatchStm.prepare(getInsertLogPointBatchQuery().c_str());
+        for (; idx + LogPointBatchSize <= telemetry.size(); idx += LogPointBatchSize) {
+            insertBatchStm.reset();
+            for (std::size_t row = 0; row < LogPointBatchSize; ++row) {
+                bindLogPoint(insertBatchStm, row, idx + row);
+            }
+            if (!executeInsert(insertBatchStm)) {
+                return false;
+            }
+        }
+    }
+
+    if (idx < telemetry.size()) {
+        auto insertLogPointStm = Statement{*mDbConnection};
+        insertLogPointStm.prepare(insertLogPoint);
+        for (; idx < telemetry.size(); ++idx) {
+            insertLogPointStm.reset();
+            bindLogPoint(insertLogPointStm, 0, idx);
+            if (!executeInsert(insertLogPointStm)) {
+                return false;
+            }
+        }
     }
 
     SPDLOG_DEBUG("Successful stored the log points for lap with ID {}", lapId);
@@ -764,13 +1075,43 @@ std::optional<Common::SessionData> SqliteSessionDatabase::readSession(std::size_
         return std::nullopt;
     }
 
-    auto sessionMetaData = maybeSessionMetaData.value();
-    auto session = Common::SessionData{sessionMetaData.getTrack(),
-                                       sessionMetaData.getSessionDate(),
-                                       sessionMetaData.getSessionTime(),
-                                       sessionMetaData.getId()};
-    session.addLaps(laps.value_or(std::vector<Common::LapData>{}));
-    return session;
+    return Common::SessionData{maybeSessionMetaData.value(), std::move(laps.value())};
+}
+
+std::optional<Common::SessionView> SqliteSessionDatabase::readSessionView(std::size_t index) const
+{
+    auto const sessionIndex = mIndexMapper.find(index);
+    auto maybeSessionMetaData = readSessionMetaData(index);
+    if (not maybeSessionMetaData.has_value()) {
+        return std::nullopt;
+    }
+
+    auto lapIds = readLapIdsOfSession(sessionIndex->second);
+    if (!lapIds.has_value()) {
+        return std::nullopt;
+    }
+
+    auto laps = std::vector<Common::LapData>{};
+    laps.reserve(lapIds->size());
+    for (auto const& lapId : lapIds.value()) {
+        auto lapData = readLapTimes(sessionIndex->second, lapId);
+        if (!lapData.has_value()) {
+            return std::nullopt;
+        }
+        laps.push_back(std::move(lapData.value()));
+    }
+
+    // The loader holds the connection and the write mutex and not the database, so the view stays valid when the
+    // database is destroyed. A lap is loaded between the transactions of the storage threads.
+    auto loader = [connection = mDbConnection, writeMutex = mWriteMutex, lapIds = std::move(lapIds.value())](
+                      std::size_t lapIndex) -> std::optional<Common::LapTelemetry> {
+        if (lapIndex >= lapIds.size()) {
+            return std::nullopt;
+        }
+        std::lock_guard<std::mutex> const writeGuard{*writeMutex};
+        return readLapTelemetry(*connection, lapIds[lapIndex], nullptr);
+    };
+    return Common::SessionView{maybeSessionMetaData.value(), std::move(laps), std::move(loader)};
 }
 
 std::optional<Common::SessionMetaData> SqliteSessionDatabase::readSessionMetaData(std::size_t index) const
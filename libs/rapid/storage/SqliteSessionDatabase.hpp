@@ -8,8 +8,10 @@
 #include "ISessionDatabase.hpp"
 #include "private/Connection.hpp"
 #include "private/StorageContext.hpp"
+#include <deque>
 #include <map>
 #include <sqlite3.h>
+#include <unordered_map>
 
 namespace Rapid::Storage
 {
@@ -57,6 +59,11 @@ public:
      */
     std::optional<Common::SessionData> getSessionByIndex(std::size_t index) const noexcept override;
 
+    /**
+     * @copydoc ISessionDatabase::getSessionViewByIndex(std::size_t index)
+     */
+    std::optional<Common::SessionView> getSessionViewByIndex(std::size_t index) const noexcept override;
+
     /**
      * @copydoc ISessionDatabase::getSessionByIndexAsync(std::size_t index)
      */
@@ -78,6 +85,16 @@ public:
      */
     std::shared_ptr<System::AsyncResult> storeSession(Common::SessionData const& session) override;
 
+    /**
+     * @copydoc ISessionDatabase::openSession(Common::SessionMetaData const& metaData)
+     */
+    std::shared_ptr<OpenSessionResult> openSession(Common::SessionMetaData const& metaData) override;
+
+    /**
+     * @copydoc ISessionDatabase::appendLap(std::size_t sessionHandle, Common::LapData&& lap)
+     */
+    std::shared_ptr<System::AsyncResult> appendLap(std::size_t sessionHandle, Common::LapData&& lap) override;
+
     /**
      * @copydoc ISessionDatabase::deleteSession(std::size_t index)
      */
@@ -86,20 +103,30 @@ public:
 private:
     void updateSession(Private::SessionStorageContext* ctx);
     void saveSession(Private::SessionStorageContext* ctx);
+    void createSession(std::shared_ptr<Private::SessionStorageContextWithValue<std::size_t>> ctx);
+    void saveNextAppendedLap();
     void readSession(std::shared_ptr<Private::SessionStorageContextWithValue<Common::SessionData>> ctx) const;
     void readSessionMetaData(
         std::shared_ptr<Private::SessionStorageContextWithValue<Common::SessionMetaData>> ctx) const;
     void readSessionByMetaData(std::shared_ptr<Private::SessionStorageContextWithValue<Common::SessionData>> ctx) const;
     std::optional<std::size_t> readSessionIdOfIndex(std::size_t sessionIndex) const noexcept;
-    std::optional<std::size_t> readSessionId(Common::SessionData const& session) const noexcept;
+    std::optional<std::size_t> readSessionId(Common::SessionMetaData const& session) const noexcept;
     std::optional<std::size_t> readIndexOfSessionId(std::size_t sessionId) const noexcept;
     std::vector<std::size_t> readSessionIds() const noexcept;
     std::optional<std::vector<Common::LapData>> readLapsOfSession(std::size_t sessionId) const noexcept;
+    std::optional<std::vector<std::size_t>> readLapIdsOfSession(std::size_t sessionId) const noexcept;
+    std::optional<Common::LapData> readLapTimes(std::size_t sessionId, std::size_t lapId) const noexcept;
+    static std::optional<Common::LapTelemetry> readLapTelemetry(
+        Private::Connection& connection,
+        std::size_t lapId,
+        std::shared_ptr<std::pmr::memory_resource> const& resource) noexcept;
     std::optional<Common::TrackData> readTrack(std::size_t trackId) const noexcept;
+    bool saveSessionMetaData(Common::SessionMetaData const& metaData) const noexcept;
     bool saveLapOfSession(std::size_t sessionId, std::size_t lapIndex, Common::LapData const& lapData) const noexcept;
-    bool saveLapLogPoints(std::size_t lapId, Common::LapData const& lapData) const noexcept;
+    bool saveLapLogPoints(std::size_t lapId, Common::LapTelemetry const& telemetry) const noexcept;
     std::optional<std::size_t> readLapId(std::size_t sessionId, std::size_t lapIndex) const noexcept;
     std::optional<Common::SessionData> readSession(std::size_t index) const;
+    std::optional<Common::SessionView> readSessionView(std::size_t index) const;
     std::optional<Common::SessionMetaData> readSessionMetaData(std::size_t index) const;
     std::optional<Common::SessionData> readSessionByMetaData(Common::SessionMetaData const& metadata) const;
 
@@ -114,6 +141,20 @@ private:
 
     std::unordered_map<Private::StorageContextBase*, std::shared_ptr<Private::SessionStorageContext>> mStorageCache;
     std::mutex mutable mMutex;
+
+    // The index of the next appended lap of the opened sessions, so an append doesn't read the stored laps.
+    std::unordered_map<std::size_t, std::size_t> mNextLapIndex;
+    // The appended laps in the order of the calls. Every append thread writes the front lap, so the laps are
+    // written in the order of the calls and not in the order the threads are scheduled.
+    std::deque<std::shared_ptr<Private::SessionStorageContextWithValue<std::size_t>>> mAppendQueue;
+    std::mutex mAppendQueueMutex;
+    // The storage threads share the connection, so only one of them writes at a time. The loaders of the session
+    // views outlive the database and share the mutex.
+    std::shared_ptr<std::mutex> mWriteMutex{std::make_shared<std::mutex>()};
+
+    // Track rows are never updated and their ids are never reused, so a read track stays valid for its id.
+    std::unordered_map<std::size_t, Common::TrackData> mutable mTrackCache;
+    std::mutex mutable mTrackCacheMutex;
 };
 
 } // namespace Rapid::Storage
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "SqliteTrackDatabase.hpp"
+#include "common/TrackRegistry.hpp"
 #include "private/Statement.hpp"
 #include <spdlog/spdlog.h>
 #include <string>
@@ -195,7 +196,7 @@ void SqliteTrackDatabase::saveTrack(std::shared_ptr<Private::TrackStorageContext
         }
     }
 
-    auto const trackId = saveTrack(track.getTrackName(), finishlineId.value(), startlineId);
+    auto const trackId = saveTrack(track.getTrackName(), finishlineId.value(), startlineId, track.getTopology());
     if (not trackId.has_value()) {
         SPDLOG_ERROR("Failed to save track. Error: {}", mDbConnection->getErrorMessage());
         commitGuard.setRollback();
@@ -203,6 +204,16 @@ void SqliteTrackDatabase::saveTrack(std::shared_ptr<Private::TrackStorageContext
         return;
     }
 
+    if (track.getPitLaneLine().has_value()) {
+        auto const pitLaneLineId = savePosition(*track.getPitLaneLine());
+        if (not pitLaneLineId.has_value() or not saveTrackPitLaneLine(trackId.value(), pitLaneLineId.value())) {
+            SPDLOG_ERROR("Failed to save track pit lane line. Error: {}", mDbConnection->getErrorMessage());
+            commitGuard.setRollback();
+            ctx->mStoragePromise.set_value(false);
+            return;
+        }
+    }
+
     auto const sections = track.getSections();
     for (std::size_t index = 0; index < sections.size(); ++index) {
         if (not saveSection(trackId.value(), sections.at(index), index)) {
@@ -222,6 +233,7 @@ void SqliteTrackDatabase::deleteAllTracks(std::shared_ptr<Private::TrackStorageC
     for (auto const& trackId : trackIds) {
         auto finishlineId = readFinishlinePositionId(trackId);
         auto startlineId = readStartlinePositionId(trackId);
+        auto pitLaneLineId = readPitLaneLinePositionId(trackId);
         auto sectionIds = getSectionPositionIds(trackId);
         if (finishlineId.has_value()) {
             positionIds.push_back(finishlineId.value());
@@ -231,6 +243,10 @@ void SqliteTrackDatabase::deleteAllTracks(std::shared_ptr<Private::TrackStorageC
             positionIds.push_back(startlineId.value());
         }
 
+        if (pitLaneLineId.has_value()) {
+            positionIds.push_back(pitLaneLineId.value());
+        }
+
         if (sectionIds.size() > 0) {
             positionIds.insert(positionIds.end(), sectionIds.cbegin(), sectionIds.cend());
         }
@@ -333,34 +349,40 @@ std::optional<std::size_t> SqliteTrackDatabase::savePosition(Common::PositionDat
 
 std::optional<std::size_t> SqliteTrackDatabase::saveTrack(std::string const& name,
                                                           std::size_t finishline,
-                                                          std::optional<std::size_t> startline) const noexcept
+                                                          std::optional<std::size_t> startline,
+                                                          Common::TrackTopology topology) const noexcept
 {
     // clang-format off
     constexpr auto insertTrackWithStartlineQuery =  "INSERT INTO Track "
-                                                        "(Name, Finishline, Startline) "
+                                                        "(Name, Finishline, Topology, Startline) "
                                                     "VALUES "
-                                                        "(?,?,?) "
+                                                        "(?,?,?,?) "
                                                     "RETURNING "
                                                         "TrackId";
     constexpr auto insertTrackWithoutStartlineQuery =   "INSERT INTO Track "
-                                                            "(Name, Finishline) "
+                                                            "(Name, Finishline, Topology) "
                                                         "VALUES "
-                                                            "(?,?) "
+                                                            "(?,?,?) "
                                                         "RETURNING "
                                                             "TrackId";
     // clang-format on
 
     auto stm = Statement{*mDbConnection};
+    auto const topologyValue = static_cast<int>(topology);
     auto bindError = false;
     if (startline.has_value()) {
         bindError = stm.prepare(insertTrackWithStartlineQuery)
                         .bindValue(1, name)
                         .bindValue(2, finishline)
-                        .bindValue(3, startline.value())
+                        .bindValue(3, topologyValue)
+                        .bindValue(4, startline.value())
                         .hasError();
     } else {
-        bindError =
-            stm.prepare(insertTrackWithoutStartlineQuery).bindValue(1, name).bindValue(2, finishline).hasError();
+        bindError = stm.prepare(insertTrackWithoutStartlineQuery)
+                        .bindValue(1, name)
+                        .bindValue(2, finishline)
+                        .bindValue(3, topologyValue)
+                        .hasError();
     }
 
     if (bindError or stm.execute() != ExecuteResult::Row) {
@@ -369,6 +391,21 @@ std::optional<std::size_t> SqliteTrackDatabase::saveTrack(std::string const& nam
     return stm.getColumn<int>(0);
 }
 
+bool SqliteTrackDatabase::saveTrackPitLaneLine(std::size_t trackId, std::size_t pitLaneLine) const noexcept
+{
+    // clang-format off
+    constexpr auto updatePitLaneLineQuery = "UPDATE Track "
+                                            "SET "
+                                                "PitLanePositionId = ? "
+                                            "WHERE "
+                                                "TrackId = ?";
+    // clang-format on
+    auto stm = Statement{*mDbConnection};
+    auto const bindError =
+        stm.prepare(updatePitLaneLineQuery).bindValue(1, pitLaneLine).bindValue(2, trackId).hasError();
+    return not bindError and stm.execute() == ExecuteResult::Ok;
+}
+
 bool SqliteTrackDatabase::saveSection(std::size_t trackId, Common::PositionData const& section, std::size_t index)
 {
     // clang-format off
@@ -434,6 +471,26 @@ std::optional<std::size_t> SqliteTrackDatabase::readStartlinePositionId(std::siz
     return stm.getColumn<int>(0);
 }
 
+std::optional<std::size_t> SqliteTrackDatabase::readPitLaneLinePositionId(std::size_t trackId) const noexcept
+{
+    // clang-format off
+    constexpr auto pitLaneLinePositionIdQuery =
+                                        "SELECT "
+                                            "PositionId "
+                                        "FROM "
+                                            "Position "
+                                        "WHERE "
+                                            "PositionId = "
+                                                "(SELECT Track.PitLanePositionId FROM Track WHERE TrackId = ?)";
+    // clang-format on
+    auto stm = Statement{*mDbConnection};
+    auto const bindError = stm.prepare(pitLaneLinePositionIdQuery).bindValue(1, trackId).hasError();
+    if (bindError or stm.execute() != ExecuteResult::Row) {
+        return std::nullopt;
+    }
+    return stm.getColumn<int>(0);
+}
+
 bool SqliteTrackDatabase::deletePositionId(std::size_t positionId)
 {
     // clang-format off
@@ -491,13 +548,14 @@ std::optional<std::vector<Common::TrackData>> SqliteTrackDatabase::readTracks()
 {
     constexpr auto trackQuery =
         "SELECT TrackId, Track.Name, FL.Latitude AS FlLat, FL.Longitude AS FlLong, "
-        "SL.Latitude AS SlLat, SL.Longitude AS SlLong from Track LEFT JOIN Position FL ON Track.Finishline = "
-        "FL.PositionId LEFT JOIN Position SL ON Track.Startline = SL.PositionId";
+        "SL.Latitude AS SlLat, SL.Longitude AS SlLong, Track.Topology, PL.Latitude AS PlLat, PL.Longitude AS PlLong "
+        "from Track LEFT JOIN Position FL ON Track.Finishline = FL.PositionId LEFT JOIN Position SL ON "
+        "Track.Startline = SL.PositionId LEFT JOIN Position PL ON Track.PitLanePositionId = PL.PositionId";
 
     auto tracksResult = std::vector<Common::TrackData>{};
     Statement stm{*mDbConnection};
     if (not stm.prepare(trackQuery).hasError()) {
-        while (stm.execute() == ExecuteResult::Row && stm.getColumnCount() == 6) {
+        while (stm.execute() == ExecuteResult::Row && stm.getColumnCount() == 9) {
             auto track = Rapid::Common::TrackData{};
             auto trackId = stm.getColumn<int>(0).value_or(0);
             track.setTrackName(stm.getColumn<std::string>(1).value_or(""));
@@ -506,6 +564,12 @@ std::optional<std::vector<Common::TrackData>> SqliteTrackDatabase::readTracks()
                 stm.hasColumnValue(5) == HasColumnValueResult::Ok) {
                 track.setStartline({stm.getColumn<float>(4).value_or(0), stm.getColumn<float>(5).value_or(0)});
             }
+            track.setTopology(static_cast<Common::TrackTopology>(stm.getColumn<int>(6).value_or(0)));
+            if (stm.hasColumnValue(7) == HasColumnValueResult::Ok &&
+                stm.hasColumnValue(8) == HasColumnValueResult::Ok) {
+                track.setPitLaneLine(
+                    Common::PositionData{stm.getColumn<float>(7).value_or(0), stm.getColumn<float>(8).value_or(0)});
+            }
 
             // Request sektor
             constexpr auto sektorQuery =
@@ -523,8 +587,8 @@ std::optional<std::vector<Common::TrackData>> SqliteTrackDatabase::readTracks()
                 sections.emplace_back(sektorStm.getColumn<float>(0).value_or(0),
                                       sektorStm.getColumn<float>(1).value_or(0));
             }
-            track.setSections(sections);
-            tracksResult.emplace_back(track);
+            track.setSections(std::move(sections));
+            tracksResult.emplace_back(Common::TrackRegistry::instance().intern(track));
         }
     } else {
         return std::nullopt;
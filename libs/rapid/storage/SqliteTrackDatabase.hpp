@@ -97,10 +97,13 @@ private:
     std::optional<std::size_t> savePosition(Common::PositionData const& position) const noexcept;
     std::optional<std::size_t> saveTrack(std::string const& name,
                                          std::size_t finishline,
-                                         std::optional<std::size_t> startline) const noexcept;
+                                         std::optional<std::size_t> startline,
+                                         Common::TrackTopology topology) const noexcept;
+    bool saveTrackPitLaneLine(std::size_t trackId, std::size_t pitLaneLine) const noexcept;
     bool saveSection(std::size_t trackId, Common::PositionData const& section, std::size_t index);
     std::optional<std::size_t> readFinishlinePositionId(std::size_t trackId) const noexcept;
     std::optional<std::size_t> readStartlinePositionId(std::size_t trackId) const noexcept;
+    std::optional<std::size_t> readPitLaneLinePositionId(std::size_t trackId) const noexcept;
     bool deletePositionId(std::size_t positionId);
     std::vector<std::size_t> getSectionPositionIds(std::size_t trackId);
     std::optional<std::size_t> readTrackCount();
@@ -5,11 +5,44 @@
 #include "Connection.hpp"
 #include <spdlog/spdlog.h>
 
+#include <string>
+#include <tuple>
 #include <utility>
 
 namespace Rapid::Storage::Private
 {
 
+namespace
+{
+
+int getUserVersion(sqlite3* handle) noexcept
+{
+    auto* stm = static_cast<sqlite3_stmt*>(nullptr);
+    auto version = 0;
+    if (sqlite3_prepare_v2(handle, "PRAGMA user_version", -1, &stm, nullptr) == SQLITE_OK &&
+        sqlite3_step(stm) == SQLITE_ROW) {
+        version = sqlite3_column_int(stm, 0);
+    }
+    sqlite3_finalize(stm);
+    return version;
+}
+
+bool hasColumn(sqlite3* handle, char const* table, char const* column) noexcept
+{
+    auto* stm = static_cast<sqlite3_stmt*>(nullptr);
+    auto found = false;
+    if (sqlite3_prepare_v2(handle, "SELECT COUNT(*) FROM pragma_table_info(?1) WHERE name = ?2", -1, &stm, nullptr) ==
+            SQLITE_OK &&
+        sqlite3_bind_text(stm, 1, table, -1, SQLITE_STATIC) == SQLITE_OK &&
+        sqlite3_bind_text(stm, 2, column, -1, SQLITE_STATIC) == SQLITE_OK && sqlite3_step(stm) == SQLITE_ROW) {
+        found = sqlite3_column_int(stm, 0) > 0;
+    }
+    sqlite3_finalize(stm);
+    return found;
+}
+
+} // namespace
+
 std::unordered_map<std::string, std::weak_ptr<Connection>> Connection::sConnections =
     std::unordered_map<std::string, std::weak_ptr<Connection>>{};
 
@@ -27,6 +60,11 @@ std::shared_ptr<Connection> Connection::connection(std::string const& database)
 
 Connection::~Connection()
 {
+    // Unfinalized statements keep the database open.
+    for (auto& [statement, handle] : mStatementCache) {
+        sqlite3_finalize(handle);
+    }
+    mStatementCache.clear();
     if (mHandle != nullptr) {
         sqlite3_close(mHandle);
     }
@@ -52,6 +90,7 @@ Connection::Connection(std::string database)
                         nullptr) == SQLITE_OK) {
         sqlite3_exec(mHandle, "PRAGMA foreign_keys = 1", nullptr, nullptr, nullptr);
         sqlite3_exec(mHandle, "PRAGMA journal_mode = wal", nullptr, nullptr, nullptr);
+        migrateSchema();
         return;
     }
 
@@ -59,6 +98,38 @@ Connection::Connection(std::string database)
     std::exit(255);
 }
 
+void Connection::migrateSchema()
+{
+    auto const version = getUserVersion(mHandle);
+    if (version >= SchemaVersion or not hasColumn(mHandle, "Track", "TrackId")) {
+        return;
+    }
+
+    SPDLOG_INFO("Migrate database {} from schema version {} to {}", mDatabase, version, SchemaVersion);
+    auto commitGuard = CommitGuard{*this};
+    auto execute = [this, &commitGuard](char const* statement) {
+        if (sqlite3_exec(mHandle, statement, nullptr, nullptr, nullptr) != SQLITE_OK) {
+            SPDLOG_ERROR("Failed to migrate database {}. Error: {}", mDatabase, getErrorMessage());
+            commitGuard.setRollback();
+            return false;
+        }
+        return true;
+    };
+
+    // Version 1 stores the topology and the pit lane line of a track. Databases created from the schema before the
+    // version was stored already have the columns.
+    if (not hasColumn(mHandle, "Track", "Topology") and
+        not execute("ALTER TABLE Track ADD COLUMN Topology INTEGER NOT NULL DEFAULT 0")) {
+        return;
+    }
+    if (not hasColumn(mHandle, "Track", "PitLanePositionId") and
+        not execute("ALTER TABLE Track ADD COLUMN PitLanePositionId INTEGER NULL "
+                    "REFERENCES Position (PositionId) ON DELETE CASCADE")) {
+        return;
+    }
+    std::ignore = execute(("PRAGMA user_version = " + std::to_string(SchemaVersion)).c_str());
+}
+
 std::string Connection::getErrorMessage() const noexcept
 {
     if (mHandle != nullptr) {
@@ -92,6 +163,48 @@ void Connection::rollback()
     sqlite3_exec(mHandle, "ROLLBACK", nullptr, nullptr, nullptr);
 }
 
+sqlite3_stmt* Connection::acquireStatement(std::string_view statement) const
+{
+    {
+        auto const guard = std::lock_guard<std::mutex>{mStatementCacheMutex};
+        auto const cached = mStatementCache.find(statement);
+        if (cached != mStatementCache.end()) {
+            auto* handle = cached->second;
+            mStatementCache.erase(cached);
+            return handle;
+        }
+    }
+
+    auto* handle = static_cast<sqlite3_stmt*>(nullptr);
+    if (sqlite3_prepare_v3(mHandle,
+                           statement.data(),
+                           static_cast<int>(statement.size()),
+                           SQLITE_PREPARE_PERSISTENT,
+                           &handle,
+                           nullptr) != SQLITE_OK) {
+        spdlog::error("Failed to prepare statement {} Error: {}", statement, getErrorMessage());
+        sqlite3_finalize(handle);
+        return nullptr;
+    }
+    return handle;
+}
+
+void Connection::releaseStatement(std::string_view statement, sqlite3_stmt* handle) const
+{
+    if (handle == nullptr) {
+        return;
+    }
+    sqlite3_reset(handle);
+    sqlite3_clear_bindings(handle);
+
+    auto const guard = std::lock_guard<std::mutex>{mStatementCacheMutex};
+    if (mStatementCache.size() >= MaximumCachedStatements) {
+        sqlite3_finalize(handle);
+        return;
+    }
+    mStatementCache.emplace(std::string{statement}, handle);
+}
+
 CommitGuard::CommitGuard(Connection& connection)
     : mConnection{connection}
 {
@@ -5,9 +5,12 @@
 #ifndef CONNECTION_HPP
 #define CONNECTION_HPP
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <sqlite3.h>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace Rapid::Storage::Private
@@ -27,8 +30,14 @@ public:
      */
     static std::shared_ptr<Connection> connection(std::string const& database);
 
+    /**
+     * The version of the database schema in db/schema.sql. It's stored in the user_version of the database.
+     */
+    static constexpr int SchemaVersion = 1;
+
     /**
      * Tries to open the sqlite3 database for the given string.
+     * A database of an older schema version is migrated to @ref SchemaVersion.
      * @param database The path to the database.
      */
     Connection(std::string database);
@@ -86,9 +95,46 @@ public:
      */
     void rollback();
 
+    /**
+     * The maximum number of idle prepared statements that are kept by the connection.
+     */
+    static constexpr std::size_t MaximumCachedStatements = 64;
+
+    /**
+     * Gives a prepared statement for the SQL. An idle statement from the statement cache is reused, otherwise the
+     * statement is prepared. The statement must be given back with @ref releaseStatement.
+     * The function is thread safe, a statement is never given to two callers at the same time.
+     * @param statement The SQL of the statement.
+     * @return The prepared statement or a nullptr when the statement couldn't be prepared.
+     */
+    sqlite3_stmt* acquireStatement(std::string_view statement) const;
+
+    /**
+     * Gives back a statement that was acquired with @ref acquireStatement. The statement is reset, its bindings are
+     * cleared and it's kept for the next caller with the same SQL.
+     * @param statement The SQL of the statement.
+     * @param handle The prepared statement.
+     */
+    void releaseStatement(std::string_view statement, sqlite3_stmt* handle) const;
+
 private:
+    void migrateSchema();
+
+    struct StatementHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view statement) const noexcept
+        {
+            return std::hash<std::string_view>{}(statement);
+        }
+    };
+
     sqlite3* mHandle{nullptr};
     std::string mDatabase;
+    // The connection is shared by the storage threads, the cache is guarded by its own mutex.
+    mutable std::mutex mStatementCacheMutex;
+    mutable std::unordered_multimap<std::string, sqlite3_stmt*, StatementHash, std::equal_to<>> mStatementCache;
     static std::unordered_map<std::string, std::weak_ptr<Connection>> sConnections;
 };
 
@@ -3,8 +3,6 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "Statement.hpp"
-#include "cstring"
-#include <spdlog/spdlog.h>
 
 namespace Rapid::Storage::Private
 {
@@ -16,30 +14,25 @@ Statement::Statement(Connection const& dbConnection)
 
 Statement::~Statement()
 {
-    if (mStatement != nullptr) {
-        sqlite3_finalize(mStatement);
-    }
+    release();
 }
 
 Statement& Statement::prepare(char const* statement) noexcept
 {
+    release();
     mPrepared = false;
-    auto* dbHandle = mDbConnection.getRawHandle();
-    if (dbHandle == nullptr or statement == nullptr) {
+    mBindError = false;
+    if (mDbConnection.getRawHandle() == nullptr or statement == nullptr) {
         mBindError = true;
+        return *this;
     }
 
-    // If the statement is reused and shall be prepared again, the statement must be reset to it's initial state.
+    mStatement = mDbConnection.acquireStatement(statement);
     if (mStatement != nullptr) {
-        reset();
-    }
-
-    auto const prepareResult =
-        sqlite3_prepare_v2(dbHandle, statement, static_cast<int>(std::strlen(statement)), &mStatement, nullptr);
-    if (prepareResult == SQLITE_OK) {
+        mStatementText = statement;
         mPrepared = true;
     } else {
-        spdlog::error("Failed to prepare statement {} Error: {}", statement, mDbConnection.getErrorMessage());
+        mBindError = true;
     }
 
     return *this;
@@ -64,16 +57,19 @@ ExecuteResult Statement::execute() noexcept
     }
 }
 
-void Statement::reset()
+Statement& Statement::reset() noexcept
 {
     if (mStatement != nullptr) {
         sqlite3_reset(mStatement);
+        sqlite3_clear_bindings(mStatement);
     }
+    mBindError = false;
+    return *this;
 }
 
 bool Statement::hasError()
 {
-    return mBindError;
+    return mBindError or not mPrepared;
 }
 
 std::size_t Statement::getColumnCount() const noexcept
@@ -106,6 +102,14 @@ ColumnType Statement::getColumnType(std::size_t index) const noexcept
     }
 }
 
+void Statement::release() noexcept
+{
+    if (mStatement != nullptr) {
+        mDbConnection.releaseStatement(mStatementText, mStatement);
+        mStatement = nullptr;
+    }
+}
+
 HasColumnValueResult Statement::hasColumnValue(std::size_t index) const noexcept
 {
     if (index > getColumnCount() || mStatement == nullptr) {
@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <optional>
 #include <sqlite3.h>
+#include <string>
 #include <type_traits>
 
 namespace Rapid::Storage::Private
@@ -53,7 +54,7 @@ public:
     Statement(Connection const& dbConnection);
 
     /**
-     * Default destructor finialize the statement if necessary.
+     * Default destructor gives the prepared statement back to the statement cache of the connection.
      */
     ~Statement();
 
@@ -81,6 +82,9 @@ public:
      * Prepares the statment for furhter use.
      * Can be used to chain the binding.
      * If the operation was succesful can be checked with @ref Statement::hasError.
+     * The prepared statement is taken from the statement cache of the connection, so preparing the same SQL again
+     * is cheap. Statements that are executed repeatedly should still be prepared once and @ref reset between the
+     * executions.
      * @param connection The database connection.
      * @param statement The state that shall be prepared.
      * @return A reference to the statement for function chainging.
@@ -97,9 +101,11 @@ public:
     ExecuteResult execute() noexcept;
 
     /**
-     * Resets the statement so it can be used with a different statement. Every fetched data is cleared.
+     * Resets the prepared statement so it can be executed again. Every fetched data and all bound values are
+     * cleared, the values for the next execution can be bound directly.
+     * @return A reference to the statement for function chainging.
      */
-    void reset();
+    Statement& reset() noexcept;
 
     /**
      * Binds a value to the given index.
@@ -128,12 +134,12 @@ public:
                                        static_cast<int>(index),
                                        value.c_str(),
                                        static_cast<int>(value.size()),
-                                       SQLITE_STATIC);
+                                       SQLITE_TRANSIENT);
         } else {
             static_assert("Unsupported Type passed to bindValue");
         }
         if (result != SQLITE_OK) {
-            mBindError = false;
+            mBindError = true;
         }
         return *this;
     }
@@ -141,7 +147,7 @@ public:
     /**
      * Check for bind error.
      * It's intended use is for the chainging of binding preparing.
-     * @return True a bind error happens otherwise false.
+     * @return True the statement isn't prepared or a bind error happens otherwise false.
      */
     bool hasError();
 
@@ -193,8 +199,12 @@ public:
         return result;
     }
 
+private:
+    void release() noexcept;
+
 private:
     sqlite3_stmt* mStatement{nullptr};
+    std::string mStatementText;
     Connection const& mDbConnection;
     bool mPrepared = false;
     bool mBindError = false;
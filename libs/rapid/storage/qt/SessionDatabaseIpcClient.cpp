@@ -58,6 +58,21 @@ std::optional<Common::SessionData> SessionDatabaseIpcClient::getSessionByIndex(s
     return std::nullopt;
 }
 
+std::optional<Common::SessionView> SessionDatabaseIpcClient::getSessionViewByIndex(std::size_t index) const noexcept
+{
+    auto call = QDBusPendingReply<QString>{mInterface->GetSessionByIndex(index)};
+    call.waitForFinished();
+    if (call.isError()) {
+        SPDLOG_ERROR("Session view request DBus call finished with an error: {}", call.error().message().toStdString());
+        return std::nullopt;
+    }
+    auto const maybeSession = readExchangedSession(call.argumentAt<0>());
+    if (not maybeSession.has_value()) {
+        return std::nullopt;
+    }
+    return Common::SessionView::fromSession(maybeSession.value());
+}
+
 std::shared_ptr<GetSessionResult> SessionDatabaseIpcClient::getSessionByIndexAsync(std::size_t index) noexcept
 {
     auto call = std::make_shared<QDBusPendingCallWatcher>(mInterface->GetSessionByIndex(index));
@@ -138,6 +153,77 @@ std::shared_ptr<System::AsyncResult> SessionDatabaseIpcClient::storeSession(Comm
     return result;
 }
 
+std::shared_ptr<OpenSessionResult> SessionDatabaseIpcClient::openSession(Common::SessionMetaData const& metaData)
+{
+    auto result = std::make_shared<OpenSessionResult>();
+    auto fileName = QString{"%1_%2.sessionMetaData"}.arg(QString::fromStdString(metaData.getSessionDate().asString()),
+                                                         QString::fromStdString(metaData.getSessionTime().asString()));
+    auto maybeFilePath = writeExchangeFile(fileName, JsonSerializer::Session::serialize(metaData));
+    if (not maybeFilePath.has_value()) {
+        SPDLOG_ERROR("Failed to write exchange with server");
+        result->setResult(System::Result::Error, std::string{"Failed write exchange file"});
+        return result;
+    }
+    auto call = std::make_shared<QDBusPendingCallWatcher>(mInterface->OpenSession(maybeFilePath.value()));
+    connect(call.get(),
+            &QDBusPendingCallWatcher::finished,
+            this,
+            [this, result, metaData](QDBusPendingCallWatcher* self) {
+                auto resultStatus = System::Result::Error;
+                auto call = QDBusPendingReply<qulonglong>{*self};
+                if (not call.isError()) {
+                    auto const sessionHandle = static_cast<std::size_t>(call.argumentAt<0>());
+                    mOpenedSessions.insert_or_assign(sessionHandle, metaData);
+                    result->setResultValue(sessionHandle);
+                    resultStatus = System::Result::Ok;
+                } else {
+                    SPDLOG_ERROR("Open session operation failed. Error: {}", call.error().message().toStdString());
+                }
+                mPendingCalls.erase(self);
+                result->setResult(resultStatus);
+            });
+    mPendingCalls.insert({call.get(), call});
+    return result;
+}
+
+std::shared_ptr<System::AsyncResult> SessionDatabaseIpcClient::appendLap(std::size_t sessionHandle,
+                                                                         Common::LapData&& lap)
+{
+    auto result = std::make_shared<System::AsyncResult>();
+    auto const openedSession = mOpenedSessions.find(sessionHandle);
+    if (openedSession == mOpenedSessions.cend()) {
+        SPDLOG_ERROR("Failed to append lap, the session with handle {} isn't opened", sessionHandle);
+        result->setResult(System::Result::Error, std::string{"Session not opened"});
+        return result;
+    }
+    auto laps = std::vector<Common::LapData>{};
+    laps.push_back(std::move(lap));
+    auto const content = JsonSerializer::Session::serialize(SessionData{openedSession->second, std::move(laps)});
+    // Every append has its own file, so a pending append isn't overwritten by the next one.
+    auto fileName = QString{"%1_%2.lap"}.arg(sessionHandle).arg(mAppendedLapCount++);
+    auto maybeFilePath = writeExchangeFile(fileName, content);
+    if (not maybeFilePath.has_value()) {
+        SPDLOG_ERROR("Failed to write exchange with server");
+        result->setResult(System::Result::Error, std::string{"Failed write exchange file"});
+        return result;
+    }
+    auto call = std::make_shared<QDBusPendingCallWatcher>(
+        mInterface->AppendLap(static_cast<qulonglong>(sessionHandle), maybeFilePath.value()));
+    connect(call.get(), &QDBusPendingCallWatcher::finished, this, [this, result](QDBusPendingCallWatcher* self) {
+        auto resultStatus = System::Result::Error;
+        auto call = QDBusPendingReply<bool>{*self};
+        if (not call.isError() && call.argumentAt<0>()) {
+            resultStatus = System::Result::Ok;
+        } else {
+            SPDLOG_ERROR("Append lap operation failed. Error: {}", call.error().message().toStdString());
+        }
+        mPendingCalls.erase(self);
+        result->setResult(resultStatus);
+    });
+    mPendingCalls.insert({call.get(), call});
+    return result;
+}
+
 void SessionDatabaseIpcClient::deleteSession(std::size_t index)
 {
     auto call = std::make_shared<QDBusPendingCallWatcher>(mInterface->DeleteSessionByIndex(index));
@@ -78,6 +78,13 @@ public:
      */
     std::optional<Common::SessionData> getSessionByIndex(std::size_t index) const noexcept override;
 
+    /**
+     * @copydoc @ref ISessionDatabase::getSessionViewByIndex
+     * The call blocks until the server sent the session. The whole session is exchanged, so the telemetry of the
+     * laps is already loaded.
+     */
+    std::optional<Common::SessionView> getSessionViewByIndex(std::size_t index) const noexcept override;
+
     /**
      * @copydoc @ref ISessionDatabase::getSessionByIndexAsync
      */
@@ -99,6 +106,17 @@ public:
      */
     std::shared_ptr<System::AsyncResult> storeSession(Common::SessionData const& session) override;
 
+    /**
+     * @copydoc @ref ISessionDatabase::openSession
+     */
+    std::shared_ptr<OpenSessionResult> openSession(Common::SessionMetaData const& metaData) override;
+
+    /**
+     * @copydoc @ref ISessionDatabase::appendLap
+     * The session must be opened by this client.
+     */
+    std::shared_ptr<System::AsyncResult> appendLap(std::size_t sessionHandle, Common::LapData&& lap) override;
+
     /**
      * @copydoc @ref ISessionDatabase::deleteSession
      */
@@ -123,6 +141,9 @@ private:
     std::unordered_map<QDBusPendingCallWatcher*, std::shared_ptr<QDBusPendingCallWatcher>> mPendingCalls;
     bool mInitialized = false;
     std::size_t mSessionCount = 0U;
+    // The meta data of the opened sessions, an appended lap is exchanged as a session with only this lap.
+    std::unordered_map<std::size_t, Common::SessionMetaData> mOpenedSessions;
+    std::size_t mAppendedLapCount = 0U;
 };
 
 } // namespace Rapid::Storage::Qt
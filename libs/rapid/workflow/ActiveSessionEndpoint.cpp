@@ -30,6 +30,8 @@ void ActiveSessionEndpoint::handleRestRequest(Rest::RestRequest& request) noexce
             handleTrackRequest(request);
         } else if (request.getPath().getEntry(1) == "lap") {
             handleLapRequest(request);
+        } else if (request.getPath().getEntry(1) == "statistics") {
+            handleStatisticsRequest(request);
         }
     } catch (std::exception const& e) {
         SPDLOG_ERROR("Failed to emit the finished signal. Error: Already emitting");
@@ -62,9 +64,37 @@ void ActiveSessionEndpoint::handleLapRequest(Rest::RestRequest& request)
     finished.emit(RequestHandleResult::Ok, request);
 }
 
+void ActiveSessionEndpoint::handleStatisticsRequest(Rest::RestRequest& request)
+{
+    auto const statistics = mActiveSessionWorkflow->getStatistics();
+    auto const toJson = [](std::optional<Timestamp> const& time) {
+        return time.has_value() ? nlohmann::ordered_json(time->asString()) : nlohmann::ordered_json{};
+    };
+
+    auto json = nlohmann::ordered_json{};
+    json["lapCount"] = statistics.getLapCount();
+    json["bestLap"] = toJson(statistics.getBestLaptime());
+    json["theoreticalBestLap"] = toJson(statistics.getTheoreticalBestLaptime());
+    json["averageLap"] = toJson(statistics.getAverageLaptime());
+    json["rollingAverageLap"] = toJson(statistics.getRollingAverageLaptime());
+    json["standardDeviation"] = toJson(statistics.getLaptimeStandardDeviation());
+    json["lastLapPersonalBest"] = statistics.isLastLapPersonalBest();
+    json["bestSectors"] = nlohmann::ordered_json::array();
+    json["lastSectorsPersonalBest"] = nlohmann::ordered_json::array();
+    auto const bestSectorTimes = statistics.getBestSectorTimes();
+    for (std::size_t index = 0; index < bestSectorTimes.size(); ++index) {
+        json["bestSectors"].push_back(bestSectorTimes[index].asString());
+        json["lastSectorsPersonalBest"].push_back(statistics.isLastSectorPersonalBest(index));
+    }
+
+    request.setReturnBody(json.dump());
+    request.setReturnType(RequestReturnType::Json);
+    finished.emit(RequestHandleResult::Ok, request);
+}
+
 bool ActiveSessionEndpoint::isValidPath(Rest::Path const& path) const noexcept
 {
-    if (path != "/activeSession/lap" and path != "/activeSession/track") {
+    if (path != "/activeSession/lap" and path != "/activeSession/track" and path != "/activeSession/statistics") {
         return false;
     }
     return true;
@@ -24,6 +24,12 @@ namespace Rapid::Workflow
  *            - Last sector time
  *            - Current lap time
  *            - Current sector time
+ *          - /activeSession/statistics
+ *            Provides the statistics of the finished laps
+ *            - Best lap and best sector times
+ *            - Theoretical best lap
+ *            - Average, rolling average and standard deviation of the laptimes
+ *            - Personal best flags of the last lap and its sectors
  */
 class ActiveSessionEndpoint : public Rest::IRestRequestHandler
 {
@@ -67,6 +73,7 @@ public:
 private:
     void handleTrackRequest(Rest::RestRequest& request);
     void handleLapRequest(Rest::RestRequest& request);
+    void handleStatisticsRequest(Rest::RestRequest& request);
     bool isValidPath(Rest::Path const& path) const noexcept;
 
     IActiveSessionWorkflow* mActiveSessionWorkflow = nullptr;
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "ActiveSessionWorkflow.hpp"
+#include "common/TrackRegistry.hpp"
 #include <spdlog/spdlog.h>
 
 using namespace Rapid::Common;
@@ -10,6 +11,28 @@ using namespace Rapid::Common;
 namespace Rapid::Workflow
 {
 
+namespace
+{
+
+void storeLaps(Storage::ISessionDatabase& database,
+               Storage::OpenSessionResult const& openResult,
+               SessionData const& session,
+               std::vector<LapData>& laps)
+{
+    auto const sessionHandle = openResult.getResultValue();
+    if (sessionHandle.has_value()) {
+        for (auto& lap : laps) {
+            database.appendLap(*sessionHandle, std::move(lap));
+        }
+    } else if (!laps.empty()) {
+        spdlog::warn("Failed to open the session in the database, the whole session is stored instead.");
+        database.storeSession(session);
+    }
+    laps.clear();
+}
+
+} // namespace
+
 ActiveSessionWorkflow::ActiveSessionWorkflow(Positioning::IGpsPositionProvider& positionDateTimeProvider,
                                              Algorithm::ILaptimer& laptimer,
                                              Storage::ISessionDatabase& database)
@@ -32,16 +55,31 @@ void ActiveSessionWorkflow::startActiveSession() noexcept
         mLaptimer.setTrack(mTrack.value_or(TrackData{}));
         std::ignore = mLaptimer.lapStarted.connect([this]() {
             mLapActive = true;
+            mDeltaEngine.startLap();
         });
 
         mPositionDateTimeUpdateHandle = mDateTimeProvider.gpsPosition.valueChanged().connect([this]() {
             mLaptimer.updatePositionAndTime(mDateTimeProvider.gpsPosition.get());
             if (mLapActive) {
                 mCurrentLap.addPosition(mDateTimeProvider.gpsPosition.get());
+                auto const delta = mDeltaEngine.update(mDateTimeProvider.gpsPosition.get());
+                if (delta.has_value()) {
+                    deltaTime.set(delta->deltaInMilliseconds);
+                    predictedLaptime.set(delta->predictedLaptime);
+                }
             }
         });
         auto dateTime = mDateTimeProvider.gpsPosition.get();
         mSession = Common::SessionData{mTrack.value_or(TrackData{}), dateTime.getDate(), dateTime.getTime()};
+        mPendingLaps.clear();
+        mOpenSessionResult = mDatabase.openSession(mSession.value());
+        mOpenSessionConnection = mOpenSessionResult->done.connect([this](System::AsyncResult*) {
+            storePendingLaps();
+        });
+        {
+            std::lock_guard<std::mutex> const guard{mStatisticsMutex};
+            mStatistics = SessionStatistics{};
+        }
         lapCount.set(0);
     } catch (std::exception const& e) {
         spdlog::error("Unknow Error on starting active session. Error: {}", e.what());
@@ -52,7 +90,19 @@ void ActiveSessionWorkflow::stopActiveSession() noexcept
 {
     try {
         mDateTimeProvider.gpsPosition.valueChanged().disconnect(mPositionDateTimeUpdateHandle);
+        mOpenSessionConnection->disconnect();
+        if (mSession.has_value() && !mPendingLaps.empty() && (mOpenSessionResult != nullptr)) {
+            // The session isn't opened yet, the finished laps are stored when the open is done. Storing the whole
+            // session now would create a second session next to the opened one.
+            std::ignore = mOpenSessionResult->done.connect(
+                [&database = mDatabase, session = mSession.value(), laps = std::move(mPendingLaps)](
+                    System::AsyncResult* result) mutable {
+                    storeLaps(database, *static_cast<Storage::OpenSessionResult*>(result), session, laps);
+                });
+        }
         mSession = std::nullopt;
+        mOpenSessionResult.reset();
+        mPendingLaps.clear();
     } catch (std::exception const& e) {
         spdlog::error("Unknow Error on stopping active session. Error: {}", e.what());
     }
@@ -60,7 +110,7 @@ void ActiveSessionWorkflow::stopActiveSession() noexcept
 
 void ActiveSessionWorkflow::setTrack(Common::TrackData const& track) noexcept
 {
-    mTrack = track;
+    mTrack = Common::TrackRegistry::instance().intern(track);
 }
 
 std::optional<Common::TrackData> ActiveSessionWorkflow::getTrack() const noexcept
@@ -76,6 +126,21 @@ std::optional<Common::SessionData> ActiveSessionWorkflow::getSession() const noe
     return mSession;
 }
 
+SessionStatistics ActiveSessionWorkflow::getStatistics() const
+{
+    std::lock_guard<std::mutex> const guard{mStatisticsMutex};
+    return mStatistics;
+}
+
+void ActiveSessionWorkflow::setReferenceLap(Common::LapData const& lap) noexcept
+{
+    try {
+        mDeltaEngine.setReferenceLap(lap);
+    } catch (std::exception const& e) {
+        spdlog::error("Failed to set the reference lap. Error: {}", e.what());
+    }
+}
+
 void Rapid::Workflow::ActiveSessionWorkflow::addSectorTime()
 {
     auto const sectorTime = mLaptimer.getLastSectorTime();
@@ -92,16 +157,41 @@ void ActiveSessionWorkflow::onLapFinished()
 
     addSectorTime();
 
-    mSession->addLap(mCurrentLap);
-    mDatabase.storeSession(mSession.value());
-    lastLaptime.set(mCurrentLap.getLaptime());
+    {
+        std::lock_guard<std::mutex> const guard{mStatisticsMutex};
+        mStatistics.addLap(mCurrentLap);
+    }
+
+    // The best lap of the session is the reference for the delta of the next laps.
+    auto const laptime = mCurrentLap.getLaptime();
+    if (!mDeltaEngine.hasReferenceLap() || laptime < mDeltaEngine.getReferenceLaptime()) {
+        mDeltaEngine.setReferenceLap(mCurrentLap);
+    }
+
+    // Only the finished lap is written to the database, the stored laps of the session are not written again.
+    mPendingLaps.push_back(mCurrentLap);
+    mSession->addLap(std::move(mCurrentLap));
     mCurrentLap = Common::LapData{};
+    storePendingLaps();
+    lastLaptime.set(laptime);
 
     auto const newLapCount = lapCount.get() + 1;
     lapCount.set(newLapCount);
     lapFinished.emit();
 }
 
+void ActiveSessionWorkflow::storePendingLaps()
+{
+    if (!mSession.has_value() || (mOpenSessionResult == nullptr)) {
+        return;
+    }
+
+    if (mOpenSessionResult->getResult() == System::Result::NotFinished) {
+        return;
+    }
+    storeLaps(mDatabase, *mOpenSessionResult, mSession.value(), mPendingLaps);
+}
+
 void ActiveSessionWorkflow::onSectorFinished()
 {
     addSectorTime();
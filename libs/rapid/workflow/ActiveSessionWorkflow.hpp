@@ -7,6 +7,8 @@
 
 #include "IActiveSessionWorkflow.hpp"
 #include <algorithm/ILaptimer.hpp>
+#include <algorithm/LapDeltaEngine.hpp>
+#include <mutex>
 #include <positioning/IGpsPositionProvider.hpp>
 #include <storage/ISessionDatabase.hpp>
 
@@ -50,6 +52,16 @@ public:
      */
     std::optional<Common::SessionData> getSession() const noexcept override;
 
+    /**
+     * @copydoc IActiveSessionWorkflow::getStatistics()
+     */
+    Common::SessionStatistics getStatistics() const override;
+
+    /**
+     * @copydoc IActiveSessionWorkflow::setReferenceLap()
+     */
+    void setReferenceLap(Common::LapData const& lap) noexcept override;
+
 private:
     /**
      * This function is called when the lap timer emits the lapFinished.
@@ -74,15 +86,30 @@ private:
 private:
     void addSectorTime();
 
+    /**
+     * Appends the finished laps that are not stored yet to the opened session in the database.
+     * When the session can't be opened the whole session is stored instead.
+     */
+    void storePendingLaps();
+
     Positioning::IGpsPositionProvider& mDateTimeProvider;
     Algorithm::ILaptimer& mLaptimer;
     Storage::ISessionDatabase& mDatabase;
     std::optional<Common::SessionData> mSession;
     std::optional<Common::TrackData> mTrack;
     Common::LapData mCurrentLap;
+    // The statistics are updated by the laptimer and read by the REST endpoint on its own thread.
+    mutable std::mutex mStatisticsMutex;
+    Common::SessionStatistics mStatistics;
     bool mLapActive = false;
+    Algorithm::LapDeltaEngine mDeltaEngine;
 
     KDBindings::ConnectionHandle mPositionDateTimeUpdateHandle;
+
+    std::shared_ptr<Storage::OpenSessionResult> mOpenSessionResult;
+    KDBindings::ScopedConnection mOpenSessionConnection;
+    // The finished laps that are waiting for the session to be opened.
+    std::vector<Common::LapData> mPendingLaps;
 };
 
 } // namespace Rapid::Workflow
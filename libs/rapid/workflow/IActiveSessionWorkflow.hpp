@@ -6,6 +6,8 @@
 #define IACTIVESESSIONWORKFLOW_HPP
 
 #include "common/SessionData.hpp"
+#include "common/SessionStatistics.hpp"
+#include <cstdint>
 #include <kdbindings/property.h>
 
 namespace Rapid::Workflow
@@ -71,6 +73,21 @@ public:
      */
     virtual std::optional<Common::SessionData> getSession() const noexcept = 0;
 
+    /**
+     * Gives the statistics of the laps of the active session.
+     * The statistics are updated with every finished lap and reset when the session is started.
+     * The statistics can be requested from another thread than the thread of the laptimer, e.g. by a REST endpoint.
+     * @return A snapshot of the statistics of the active session.
+     */
+    virtual Common::SessionStatistics getStatistics() const = 0;
+
+    /**
+     * Sets the lap the current lap is compared to, e.g. a stored lap of an earlier session.
+     * The reference lap is replaced by a faster lap of the active session.
+     * @param lap The reference lap with its log points.
+     */
+    virtual void setReferenceLap(Common::LapData const& lap) noexcept = 0;
+
     /**
      * This signal is emitted when the ActiveWorkSessionFlow detects a finished lap.
      */
@@ -101,6 +118,18 @@ public:
      */
     KDBindings::Property<Common::Timestamp> lastSectorTime;
 
+    /**
+     * This property holds the time difference of the current lap to the reference lap in milliseconds at the
+     * current position. Positive values are slower than the reference lap.
+     */
+    KDBindings::Property<std::int32_t> deltaTime;
+
+    /**
+     * This property holds the laptime of the current lap when the time difference to the reference lap stays the
+     * same until the finish.
+     */
+    KDBindings::Property<Common::Timestamp> predictedLaptime;
+
     /**
      * This property holds the lap count of the current session.
      */
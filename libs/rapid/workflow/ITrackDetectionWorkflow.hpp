@@ -54,9 +54,10 @@ public:
 
     /**
      * Sets a list that shall be used for the track detection.
+     * The list is taken over, pass an rvalue to avoid the copy of the list.
      * @param trackDatas A list of tracks which is used during the track detection.
      */
-    virtual void setTracks(std::vector<Common::TrackData> const& trackData) = 0;
+    virtual void setTracks(std::vector<Common::TrackData> trackData) = 0;
 
     /**
      * Gives the detected Track.
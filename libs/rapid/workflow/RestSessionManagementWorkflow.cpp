@@ -71,7 +71,9 @@ void RestSessionManagementWorkflow::downloadSession(std::size_t index) noexcept
                            mDownloadSessionCache,
                            mDownloadedSessions,
                            sessionDownloadFinshed,
-                           &Common::JsonDeserializer::Session::deserialize);
+                           [](std::string const& rawData) {
+                               return Common::JsonDeserializer::Session::deserialize(rawData);
+                           });
     });
 }
 
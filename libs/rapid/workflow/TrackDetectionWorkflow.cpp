@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "TrackDetectionWorkflow.hpp"
+#include "common/TrackRegistry.hpp"
 
 namespace Rapid::Workflow
 {
@@ -19,6 +20,7 @@ TrackDetectionWorkflow::~TrackDetectionWorkflow() = default;
 void TrackDetectionWorkflow::startDetection()
 {
     mActive = true;
+    mConfirmedTrack.reset();
     std::ignore =
         mPositionInfoProvider.gpsPosition.valueChanged().connect(&TrackDetectionWorkflow::onPositionInformationReceived,
                                                                  this);
@@ -29,9 +31,15 @@ void TrackDetectionWorkflow::stopDetection()
     mActive = false;
 }
 
-void TrackDetectionWorkflow::setTracks(std::vector<Common::TrackData> const& trackData)
+void TrackDetectionWorkflow::setTracks(std::vector<Common::TrackData> trackData)
 {
-    mTracksToDetect = trackData;
+    // The detected track is handed to the sessions, interning shares it with the tracks read from the database.
+    for (auto& track : trackData) {
+        track = Common::TrackRegistry::instance().intern(track);
+    }
+    mTracksToDetect = std::move(trackData);
+    mTrackIndex = Algorithm::TrackIndex{mTracksToDetect, mTrackDetector.getDetectionRadius()};
+    mConfirmedTrack.reset();
 }
 
 Common::TrackData TrackDetectionWorkflow::getDetectedTrack() const
@@ -45,9 +53,18 @@ void TrackDetectionWorkflow::onPositionInformationReceived()
         return;
     }
 
-    for (auto const& track : mTracksToDetect) {
-        if (mTrackDetector.isOnTrack(track, mPositionInfoProvider.gpsPosition.get().getPosition())) {
-            mDetectedTrack = track;
+    auto const position = mPositionInfoProvider.gpsPosition.get().getPosition();
+    if (mConfirmedTrack.has_value()) {
+        if (mTrackDetector.isOnTrack(mTracksToDetect[*mConfirmedTrack], position)) {
+            return;
+        }
+        mConfirmedTrack.reset();
+    }
+
+    for (auto const index : mTrackIndex.getCandidates(position)) {
+        if (mTrackDetector.isOnTrack(mTracksToDetect[index], position)) {
+            mDetectedTrack = mTracksToDetect[index];
+            mConfirmedTrack = index;
             trackDetected.emit();
             break;
         }
@@ -6,11 +6,19 @@
 
 #include "ITrackDetectionWorkflow.hpp"
 #include <algorithm/ITrackDetection.hpp>
+#include <algorithm/TrackIndex.hpp>
 #include <positioning/IGpsPositionProvider.hpp>
+#include <optional>
 
 namespace Rapid::Workflow
 {
 
+/**
+ * Detects the track of the current position.
+ * Only the tracks near the position are checked, the candidates are looked up in a @ref Algorithm::TrackIndex
+ * that is built when the tracks are set. Once a track is detected only this track is checked for the following
+ * positions and trackDetected isn't emitted again until the position leaves the track.
+ */
 class TrackDetectionWorkflow : public ITrackDetectionWorkflow
 {
 public:
@@ -58,9 +66,9 @@ public:
     void stopDetection() override;
 
     /**
-     * @copydoc ITrackDetectionWorkflow::setTracks(const std::vector<TrackData> &trackData)
+     * @copydoc ITrackDetectionWorkflow::setTracks(std::vector<TrackData> trackData)
      */
-    void setTracks(std::vector<Common::TrackData> const& trackData) override;
+    void setTracks(std::vector<Common::TrackData> trackData) override;
 
     /**
      * @copydoc ITrackDetectionWorkflow::getDetectedTrack()
@@ -74,6 +82,8 @@ private:
     bool mActive{false};
     Common::TrackData mDetectedTrack;
     std::vector<Common::TrackData> mTracksToDetect;
+    Algorithm::TrackIndex mTrackIndex;
+    std::optional<std::uint32_t> mConfirmedTrack;
     Algorithm::ITrackDetection& mTrackDetector;
     Positioning::IGpsPositionProvider& mPositionInfoProvider;
 };
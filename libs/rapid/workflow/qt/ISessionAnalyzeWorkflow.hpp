@@ -6,6 +6,7 @@
 #define ISESSIONANALYZEWORKFLOW_HPP
 
 #include <common/SessionData.hpp>
+#include <common/SessionView.hpp>
 #include <common/qt/GenericTableModel.hpp>
 #include <common/qt/LapDataProvider.hpp>
 #include <common/qt/LapListModel.hpp>
@@ -59,6 +60,14 @@ public:
      */
     virtual void setSession(Common::SessionData const& session) = 0;
 
+    /**
+     * Updates the session for analyzing by a lazy loaded view of the session.
+     * The lap models only need the lap and sector times, so no telemetry is loaded for them.
+     * When a new session is set the all properties of the @ref ISessionAnalyzeWorkflow are reevalulated.
+     * @param session The view of the new session which shall be analyzed.
+     */
+    virtual void setSession(Common::SessionView const& session) = 0;
+
     /**
      * Gives a model with all laps of the session set with @ref ISessionAnalyzerWorkflow::setSession
      * The model can be used to display laps of the session in QTableView
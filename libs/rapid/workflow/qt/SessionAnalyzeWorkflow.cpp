@@ -17,7 +17,17 @@ SessionAnalyzeWorkflow::~SessionAnalyzeWorkflow() = default;
 
 void SessionAnalyzeWorkflow::setSession(Common::SessionData const& session) noexcept
 {
-    if (mSession != session) {
+    try {
+        setSession(Common::SessionView::fromSession(session));
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to set session not sufficient memory. Error: {}", e.what());
+    }
+}
+
+void SessionAnalyzeWorkflow::setSession(Common::SessionView const& session) noexcept
+{
+    auto const& currentMetaData = static_cast<Common::SessionMetaData const&>(mSession);
+    if ((currentMetaData != session) or (mSession.getLaps() != session.getLaps())) {
         mSession = session;
         setLapModel();
     }
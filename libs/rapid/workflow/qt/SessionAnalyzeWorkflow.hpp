@@ -49,10 +49,15 @@ public:
      */
     void setSession(Common::SessionData const& session) noexcept override;
 
+    /**
+     * @copydoc ISessionAnalyzerWorkflow::setSession(Common::SessionView const&)
+     */
+    void setSession(Common::SessionView const& session) noexcept override;
+
 private:
     void setLapModel() noexcept;
 
-    Common::SessionData mSession;
+    Common::SessionView mSession;
     std::unique_ptr<Common::Qt::LapDataProvider> mLapDataProvider;
 };
 
@@ -18,6 +18,8 @@ public:
     MAKE_MOCK(setTrack, auto(Common::TrackData const&)->void, noexcept override);
     MAKE_MOCK(getTrack, auto()->std::optional<Common::TrackData>, const noexcept override);
     MAKE_MOCK(getSession, auto()->std::optional<Common::SessionData>, const noexcept override);
+    MAKE_MOCK(getStatistics, auto()->Common::SessionStatistics, const override);
+    MAKE_MOCK(setReferenceLap, auto(Common::LapData const&)->void, noexcept override);
 };
 
 } // namespace Rapid::TestHelper
@@ -16,10 +16,13 @@ public:
     // clang-format off
     MAKE_MOCK(getSessionCount, auto()->std::size_t, override);
     MAKE_MOCK(getSessionByIndex, auto(std::size_t)->std::optional<Common::SessionData>, const noexcept override);
+    MAKE_MOCK(getSessionViewByIndex, auto(std::size_t)->std::optional<Common::SessionView>, const noexcept override);
     MAKE_MOCK(getSessionByIndexAsync, auto(std::size_t)->std::shared_ptr<Storage::GetSessionResult>, noexcept override);
     MAKE_MOCK(getSessionByMetadataAsync, auto(Common::SessionMetaData const&)->std::shared_ptr<Storage::GetSessionResult>, noexcept override);
     MAKE_MOCK(getSessionMetaDataByIndexAsync, auto(std::size_t)->std::shared_ptr<Storage::GetSessionMetaDataResult>, noexcept override);
     MAKE_MOCK(storeSession, auto(Common::SessionData const&)->std::shared_ptr<System::AsyncResult>, override);
+    MAKE_MOCK(openSession, auto(Common::SessionMetaData const&)->std::shared_ptr<Storage::OpenSessionResult>, override);
+    MAKE_MOCK(appendLap, auto(std::size_t, Common::LapData&&)->std::shared_ptr<System::AsyncResult>, override);
     MAKE_MOCK(deleteSession, auto(std::size_t)->void, override);
     // clang-format on
 };
@@ -3,8 +3,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "Sessions.hpp"
+#include "TestFile.hpp"
 #include "Tracks.hpp"
 #include <common/GpsPositionData.hpp>
+#include <common/JsonDeserializer.hpp>
+#include <fstream>
+#include <sstream>
 
 using namespace Rapid::Common;
 
@@ -297,4 +301,12 @@ const char* getTestSessionMetadataAsJson2()
     return TestSessionAsJson;
 }
 
+SessionData getRealWorldSession()
+{
+    auto file = std::ifstream{TEST_FILE_PATH};
+    auto buffer = std::ostringstream{};
+    buffer << file.rdbuf();
+    return JsonDeserializer::Session::deserialize(buffer.str()).value_or(SessionData{});
+}
+
 } // namespace Rapid::TestHelper::Sessions
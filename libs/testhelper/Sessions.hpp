@@ -13,6 +13,8 @@ Common::SessionData getTestSession();
 Common::SessionData getTestSession2();
 Common::SessionData getTestSession3();
 Common::SessionData getTestSession4();
+// The recorded Oschersleben session of tests/common/RealWorld.session.
+Common::SessionData getRealWorldSession();
 char const* getTestSessionAsJson();
 
 Common::SessionMetaData getTestSessionMetaData();
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "SyntheticLaps.hpp"
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+using namespace Rapid::Common;
+
+namespace Rapid::TestHelper::SyntheticLaps
+{
+namespace
+{
+LocalPoint getCirclePointAtAngle(float radius, float angle)
+{
+    return LocalPoint{.x = radius * std::sin(angle), .y = radius * (1.0f - std::cos(angle))};
+}
+} // namespace
+
+LocalProjection const& getProjection()
+{
+    static auto const projection = LocalProjection{PositionData{52.0f, 11.0f}};
+    return projection;
+}
+
+LocalPoint getCirclePoint(float radius, float distance)
+{
+    return getCirclePointAtAngle(radius, distance / radius);
+}
+
+LapTelemetry createCircleLap(float radius, float speed)
+{
+    auto const lapLength = 2.0f * std::numbers::pi_v<float> * radius;
+    auto telemetry = LapTelemetry{};
+    for (std::int64_t index = 0; static_cast<float>(index) * speed / 10.0f < lapLength; ++index) {
+        auto const point = getCirclePoint(radius, static_cast<float>(index) * speed / 10.0f);
+        telemetry.append(
+            GpsPositionData{getProjection().unproject(point), Timestamp::fromMilliseconds(index * 100), Date{}, speed});
+    }
+    return telemetry;
+}
+
+LapTelemetry createCircleLaps(float radius, std::size_t laps)
+{
+    auto const pointsPerLap = static_cast<std::size_t>(2.0f * std::numbers::pi_v<float> * radius);
+    auto telemetry = LapTelemetry{};
+    for (std::size_t index = 0; index < laps * pointsPerLap; ++index) {
+        auto const angle =
+            2.0f * std::numbers::pi_v<float> * static_cast<float>(index) / static_cast<float>(pointsPerLap);
+        auto const point = getCirclePointAtAngle(radius, angle);
+        telemetry.append(GpsPositionData{getProjection().unproject(point), Timestamp{}, Date{}});
+    }
+    return telemetry;
+}
+
+} // namespace Rapid::TestHelper::SyntheticLaps
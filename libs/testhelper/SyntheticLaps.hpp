@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifndef SYNTHETICLAPS_HPP
+#define SYNTHETICLAPS_HPP
+
+#include "common/LapTelemetry.hpp"
+#include "common/TrackGeometry.hpp"
+
+namespace Rapid::TestHelper::SyntheticLaps
+{
+
+// The projection of the local coordinates of the synthetic laps.
+Common::LocalProjection const& getProjection();
+
+// The point at a distance along a circle that is driven counter clockwise, starting to the east at the origin.
+Common::LocalPoint getCirclePoint(float radius, float distance);
+
+// One lap around the circle with a constant speed in m/s and 10 Hz log points.
+Common::LapTelemetry createCircleLap(float radius, float speed);
+
+// Laps around the circle with a log point every meter and without time.
+Common::LapTelemetry createCircleLaps(float radius, std::size_t laps);
+
+} // namespace Rapid::TestHelper::SyntheticLaps
+
+#endif //! SYNTHETICLAPS_HPP
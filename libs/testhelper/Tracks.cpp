@@ -56,6 +56,15 @@ TrackData getOscherslebenTrack2()
     return createOscherslebenTrack2();
 }
 
+TrackData getOscherslebenGateTrack()
+{
+    auto track = TrackData{};
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setSections(
+        {Positions::getOscherslebenPositionSector1Line(), Positions::getOscherslebenPositionSector2Line()});
+    return track;
+}
+
 TrackData getTrackWithoutSector()
 {
     return createTrackWithoutSector();
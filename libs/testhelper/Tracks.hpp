@@ -12,6 +12,8 @@ namespace Rapid::TestHelper::Tracks
 Common::TrackData getTrackWithoutSector();
 Common::TrackData getOscherslebenTrack();
 Common::TrackData getOscherslebenTrack2();
+// The finish line and the section lines at the gate positions of the recorded Oschersleben laps.
+Common::TrackData getOscherslebenGateTrack();
 Common::TrackData getTrack();
 std::string getTrackAsJson();
 } // namespace Rapid::TestHelper::Tracks
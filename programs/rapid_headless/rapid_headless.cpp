@@ -9,11 +9,13 @@
 #include <DatabaseFile.hpp>
 #include <array>
 #include <boost/program_options.hpp>
+#include <chrono>
 #include <common/PositionData.hpp>
 #include <csignal>
 #include <filesystem>
 #include <fstream>
 #include <positioning/ConstantGpsPositionProvider.hpp>
+#include <positioning/FilteredGpsPositionProvider.hpp>
 #include <positioning/GpsdPositionInformationProvider.hpp>
 #include <positioning/UartUbloxDevice.hpp>
 #include <pwd.h>
@@ -113,18 +115,22 @@ int main(int argc, char** argv)
 
     auto options = options_description{"Options"};
     std::string gpsSourceFile{};
+    auto gpsRateMs = static_cast<unsigned int>(UbloxGpsPositionInformationProvider::DefaultMeasurementRate.count());
     // clang-format off
     options.add_options()
         ("help,h", "Show options overivew")
         ("gps-fake,g", "Enables a fake GPS source (useful for testing)")
         ("gps-source-file,f", value<std::string>(&gpsSourceFile), "Path to CSV file that contains GPS positions (useful for testing)")
         ("gps-source,s", value<std::string>(&gpsSourceFile), "Name of a UBX compatible device. Typically /dev/ttyUSB0")
+        ("gps-rate-ms,r", value<unsigned int>(&gpsRateMs), "UBX measurement interval in ms (default 40, min. 10)")
         ("gpsd,d",  "Use the GPS daemon on the system")
+        ("gps-filter", "Filter the GPS fixes of a receiver before the laptimer (outlier rejection and Kalman filter)")
     ;
     // clang-format on
     variables_map optionsMap;
     try {
         store(parse_command_line(argc, argv, options), optionsMap);
+        notify(optionsMap);
     } catch (std::exception const& e) {
         SPDLOG_ERROR("Inavlid option: {}", e.what());
         printHelp(options);
@@ -137,6 +143,7 @@ int main(int argc, char** argv)
     bool useFakeSource = optionsMap.contains("gps-fake") > 0;
     bool useRealSource = optionsMap.contains("gps-source") > 0;
     bool useGpsdSource = optionsMap.contains("gpsd") > 0;
+    bool useGpsFilter = optionsMap.contains("gps-filter") > 0;
 
     if (optionsMap.contains("gps-source-file") > 0) {
         gpsSourceFile = optionsMap["gps-source-file"].as<std::string>();
@@ -172,9 +179,10 @@ int main(int argc, char** argv)
             printHelp(options);
             return 0;
         }
-        SPDLOG_INFO("Use {} device as GPS source", device);
+        SPDLOG_INFO("Use {} device as GPS source with a measurement rate of {} ms", device, gpsRateMs);
         auto ubloxDevice = std::make_unique<UartUbloxDevice>(device);
-        auto ubloxGps = std::make_shared<UbloxGpsPositionInformationProvider>(std::move(ubloxDevice));
+        auto ubloxGps = std::make_shared<UbloxGpsPositionInformationProvider>(std::move(ubloxDevice),
+                                                                              std::chrono::milliseconds{gpsRateMs});
         gpsInfoProvider = ubloxGps;
         positionProvider = ubloxGps;
     } else if (useGpsdSource) {
@@ -187,6 +195,14 @@ int main(int argc, char** argv)
         return 0;
     }
 
+    // On request the fixes of a receiver are filtered before the laptimer sees them, the fake source is already
+    // smooth.
+    auto sourcePositionProvider = positionProvider;
+    if (useGpsFilter and not useFakeSource) {
+        SPDLOG_INFO("Filter the GPS fixes before the laptimer");
+        positionProvider = std::make_shared<FilteredGpsPositionProvider>(*sourcePositionProvider);
+    }
+
     // Setup session database
     auto const maybeDbFile = setupDatabase();
     if (not maybeDbFile.has_value()) {
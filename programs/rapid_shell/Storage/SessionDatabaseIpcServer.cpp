@@ -50,6 +50,8 @@ struct SessionDatabaseIpcServerPrivate
     std::unordered_map<System::AsyncResult*, std::shared_ptr<Rapid::Storage::GetSessionMetaDataResult>>
         mGetSessionMetaDataRequests;
     std::unordered_map<System::AsyncResult*, std::shared_ptr<System::AsyncResult>> mStoreSessionRequests;
+    std::unordered_map<System::AsyncResult*, std::shared_ptr<Rapid::Storage::OpenSessionResult>> mOpenSessionRequests;
+    std::unordered_map<System::AsyncResult*, std::shared_ptr<System::AsyncResult>> mAppendLapRequests;
     Rapid::Storage::ISessionDatabase& mDatabase;
     QString mTempFolder;
     SessionDatabaseIpcServer* q;
@@ -242,6 +244,56 @@ bool SessionDatabaseIpcServer::StoreSession(QString const& sessionPath, QDBusMes
     return false;
 }
 
+qulonglong SessionDatabaseIpcServer::OpenSession(QString const& sessionMetaDataPath,
+                                                 QDBusMessage const& message) noexcept
+{
+    message.setDelayedReply(true);
+    auto const maybeSessionMetadata = readSessionMetaDataJsonFile(sessionMetaDataPath);
+    if (not maybeSessionMetadata.has_value()) {
+        auto const reply =
+            message.createErrorReply(QDBusError::InvalidArgs,
+                                     QString{"Failed to read the session meta data: %1"}.arg(sessionMetaDataPath));
+        mD->mConnection.send(reply);
+        return 0;
+    }
+    auto result = mD->mDatabase.openSession(maybeSessionMetadata.value());
+    mD->mOpenSessionRequests.insert({result.get(), result});
+    if (result->getResult() != System::Result::NotFinished) {
+        handleOpenSession(result.get(), message);
+    } else {
+        std::ignore = result->done.connect([this, message](System::AsyncResult* result) {
+            handleOpenSession(result, message);
+        });
+    }
+    return 0;
+}
+
+bool SessionDatabaseIpcServer::AppendLap(qulonglong sessionHandle,
+                                         QString const& lapPath,
+                                         QDBusMessage const& message) noexcept
+{
+    message.setDelayedReply(true);
+    // The lap is exchanged as a session with only this lap.
+    auto maybeSession = readSessionJsonFile(lapPath);
+    if (not maybeSession.has_value() or maybeSession->getNumberOfLaps() != 1) {
+        auto const reply =
+            message.createErrorReply(QDBusError::InvalidArgs, QString{"Failed to read the lap: %1"}.arg(lapPath));
+        mD->mConnection.send(reply);
+        return false;
+    }
+    auto lap = maybeSession->getLaps().front();
+    auto result = mD->mDatabase.appendLap(static_cast<std::size_t>(sessionHandle), std::move(lap));
+    mD->mAppendLapRequests.insert({result.get(), result});
+    if (result->getResult() != System::Result::NotFinished) {
+        handleLapAppend(result.get(), message);
+    } else {
+        std::ignore = result->done.connect([this, message](System::AsyncResult* result) {
+            handleLapAppend(result, message);
+        });
+    }
+    return false;
+}
+
 void SessionDatabaseIpcServer::DeleteSessionByIndex(quint32 index)
 {
     mD->mDatabase.deleteSession(index);
@@ -260,6 +312,33 @@ void SessionDatabaseIpcServer::handleSessionStore(System::AsyncResult* result, Q
     mD->mConnection.send(reply);
 }
 
+void SessionDatabaseIpcServer::handleOpenSession(System::AsyncResult* result, QDBusMessage const& message)
+{
+    auto reply = QDBusMessage{};
+    auto const sessionHandle = mD->mOpenSessionRequests.at(result)->getResultValue();
+    if (sessionHandle.has_value()) {
+        reply = message.createReply();
+        reply << static_cast<qulonglong>(sessionHandle.value());
+    } else {
+        reply = message.createErrorReply(QDBusError::Failed, "Failed to open session. Internal database error.");
+    }
+    mD->mOpenSessionRequests.erase(result);
+    mD->mConnection.send(reply);
+}
+
+void SessionDatabaseIpcServer::handleLapAppend(System::AsyncResult* result, QDBusMessage const& message)
+{
+    auto reply = QDBusMessage{};
+    if (result->getResult() == System::Result::Ok) {
+        reply = message.createReply();
+        reply << true;
+    } else {
+        reply = message.createErrorReply(QDBusError::Failed, "Failed to append lap. Internal database error.");
+    }
+    mD->mAppendLapRequests.erase(result);
+    mD->mConnection.send(reply);
+}
+
 std::optional<QString> SessionDatabaseIpcServer::writeSession(Common::SessionData const& session) const noexcept
 {
     auto const filePath = mD->getTempFolder()
@@ -309,4 +388,24 @@ std::optional<Common::SessionMetaData> SessionDatabaseIpcServer::readSessionMeta
     return maybeSessionMetadata;
 }
 
+std::optional<Common::SessionData> SessionDatabaseIpcServer::readSessionJsonFile(QString const& path)
+{
+    auto file = QFile{path};
+    if (not file.exists()) {
+        SPDLOG_ERROR("Failed to read session file {}. File not found", path.toStdString());
+        return std::nullopt;
+    }
+    if (not file.open(QFile::ReadOnly)) {
+        SPDLOG_ERROR("Failed to open session file {}.", path.toStdString());
+        return std::nullopt;
+    }
+    auto content = file.readAll().toStdString();
+    auto maybeSession = Common::JsonDeserializer::Session::deserialize(content);
+    if (not maybeSession.has_value()) {
+        SPDLOG_ERROR("Failed to deserialize session file {}.", path.toStdString());
+        return std::nullopt;
+    }
+    return maybeSession;
+}
+
 } // namespace Rapid::RapidShell::Storage
@@ -61,15 +61,20 @@ public Q_SLOTS:
     QString GetSessionMetaDataByIndex(quint32 index, QDBusMessage const& message) noexcept;
     void DeleteSessionByIndex(quint32 index);
     bool StoreSession(QString const& sessionPath, QDBusMessage const& message) noexcept;
+    qulonglong OpenSession(QString const& sessionMetaDataPath, QDBusMessage const& message) noexcept;
+    bool AppendLap(qulonglong sessionHandle, QString const& lapPath, QDBusMessage const& message) noexcept;
 
 private:
     void handleGetSessionByIndex(System::AsyncResult* result, QDBusMessage const& msg);
     void handleGetSessionByMetadata(System::AsyncResult* result, QDBusMessage const& msg);
     void handleGetSessionMetaDataByIndex(System::AsyncResult* result, QDBusMessage const& msg);
     void handleSessionStore(System::AsyncResult* result, QDBusMessage const& message);
+    void handleOpenSession(System::AsyncResult* result, QDBusMessage const& message);
+    void handleLapAppend(System::AsyncResult* result, QDBusMessage const& message);
     std::optional<QString> writeSession(Common::SessionData const& session) const noexcept;
     bool writeJsonFile(QString const& path, std::string const& rawJson) const noexcept;
     std::optional<Common::SessionMetaData> readSessionMetaDataJsonFile(QString const& path);
+    std::optional<Common::SessionData> readSessionJsonFile(QString const& path);
 
 private:
     std::unique_ptr<SessionDatabaseIpcServerPrivate> mD;
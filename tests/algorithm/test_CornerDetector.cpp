@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/CornerDetector.hpp"
+#include "testhelper/Sessions.hpp"
+#include "testhelper/SyntheticLaps.hpp"
+#include <catch2/catch_all.hpp>
+#include <numbers>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+constexpr auto StraightLength = 300.0f;
+constexpr auto CornerRadius = 30.0f;
+constexpr auto CornerLength = std::numbers::pi_v<float> * CornerRadius;
+constexpr auto LapLength = 2.0f * (StraightLength + CornerLength);
+constexpr auto StraightSpeed = 50.0f;
+constexpr auto Braking = 8.0f;
+constexpr auto Acceleration = 10.0f;
+auto const& projection = SyntheticLaps::getProjection();
+
+/**
+ * Gives the point at a distance along an oval that is driven clockwise. The lap starts with the straight to the
+ * north, followed by two right hand hairpins.
+ */
+LocalPoint getOvalPoint(float distance)
+{
+    auto const half = std::fmod(distance, LapLength / 2.0f);
+    auto const second = distance >= LapLength / 2.0f;
+    auto point = LocalPoint{};
+    if (half < StraightLength) {
+        point = LocalPoint{.x = 0.0f, .y = half};
+    } else {
+        auto const angle = (half - StraightLength) / CornerRadius;
+        point = LocalPoint{.x = CornerRadius * (1.0f - std::cos(angle)),
+                           .y = StraightLength + (CornerRadius * std::sin(angle))};
+    }
+    // The second half is the first half rotated around the center of the oval.
+    return second ? LocalPoint{.x = (2.0f * CornerRadius) - point.x, .y = StraightLength - point.y} : point;
+}
+
+/**
+ * Gives the speed at a distance along the oval, the vehicle brakes to the corner speed and accelerates out of the
+ * corners.
+ */
+float getOvalSpeed(float distance, float cornerSpeed)
+{
+    auto const half = std::fmod(distance, LapLength / 2.0f);
+    if (half >= StraightLength) {
+        return cornerSpeed;
+    }
+    auto const accelerated = std::sqrt((cornerSpeed * cornerSpeed) + (2.0f * Acceleration * half));
+    auto const braked = std::sqrt((cornerSpeed * cornerSpeed) + (2.0f * Braking * (StraightLength - half)));
+    return std::min({StraightSpeed, accelerated, braked});
+}
+
+/**
+ * Gives the distance from the begin of the straight where the vehicle starts to brake.
+ */
+float getBrakingDistance(float cornerSpeed)
+{
+    return StraightLength - (((StraightSpeed * StraightSpeed) - (cornerSpeed * cornerSpeed)) / (2.0f * Braking));
+}
+
+/**
+ * Creates a lap around the oval with 10 Hz log points.
+ */
+LapData createOvalLap(float cornerSpeed)
+{
+    auto telemetry = LapTelemetry{};
+    auto distance = 0.0f;
+    auto time = std::int64_t{0};
+    for (; distance < LapLength; time += 100) {
+        auto const speed = getOvalSpeed(distance, cornerSpeed);
+        telemetry.append(GpsPositionData{
+            projection.unproject(getOvalPoint(distance)), Timestamp::fromMilliseconds(time), Date{}, speed});
+        distance += speed / 10.0f;
+    }
+    return LapData{{Timestamp::fromMilliseconds(time)}, std::move(telemetry)};
+}
+
+TrackData createOvalTrack()
+{
+    auto track = TrackData{};
+    track.setFinishline(projection.unproject(getOvalPoint(0.0f)));
+    track.setTopology(TrackTopology::Circuit);
+    return track;
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-unchecked-optional-access)
+
+TEST_CASE("The CornerDetector shall split a lap into corners")
+{
+    auto const detector = CornerDetector{createOvalTrack()};
+    auto const lap = createOvalLap(20.0f);
+
+    auto const corners = detector.detect(lap.getTelemetry().getView());
+
+    REQUIRE(corners.size() == 2);
+    for (std::size_t index = 0; index < corners.size(); ++index) {
+        auto const& corner = corners[index];
+        auto const cornerBegin = static_cast<float>(index) * (LapLength / 2.0f) + StraightLength;
+
+        // The headings are measured over a baseline, the detected corner is a bit longer than the hairpin.
+        REQUIRE(corner.entryDistance == Catch::Approx(cornerBegin).margin(LapComparison::HeadingBaseline + 5.0f));
+        REQUIRE(corner.exitDistance ==
+                Catch::Approx(cornerBegin + CornerLength).margin(LapComparison::HeadingBaseline + 5.0f));
+        REQUIRE(corner.apexDistance >= corner.entryDistance);
+        REQUIRE(corner.apexDistance <= corner.exitDistance);
+        REQUIRE(corner.headingChange == Catch::Approx(180.0f).margin(20.0f));
+
+        REQUIRE(corner.apexSpeed == Catch::Approx(20.0f).margin(0.5f));
+        REQUIRE(corner.entrySpeed >= corner.apexSpeed);
+        REQUIRE(corner.exitSpeed >= corner.apexSpeed);
+        REQUIRE(corner.duration == Catch::Approx((corner.exitDistance - corner.entryDistance) / 20.0f * 1000.0f)
+                                       .margin(500.0f));
+
+        REQUIRE(corner.brakingDistance.has_value());
+        auto const brakingDistance = static_cast<float>(index) * (LapLength / 2.0f) + getBrakingDistance(20.0f);
+        REQUIRE(*corner.brakingDistance == Catch::Approx(brakingDistance).margin(10.0f));
+    }
+}
+
+TEST_CASE("The CornerDetector shall find no corners on a straight")
+{
+    auto const detector = CornerDetector{createOvalTrack()};
+    auto telemetry = LapTelemetry{};
+    for (std::int64_t index = 0; index < 100; ++index) {
+        auto const point = LocalPoint{.x = 0.0f, .y = static_cast<float>(index) * 3.0f};
+        telemetry.append(
+            GpsPositionData{projection.unproject(point), Timestamp::fromMilliseconds(index * 100), Date{}, 30.0f});
+    }
+
+    REQUIRE(detector.detect(telemetry.getView()).empty());
+    REQUIRE(detector.detect(LapTelemetry{}.getView()).empty());
+}
+
+TEST_CASE("The CornerDetector shall rank the laps of a session in every corner")
+{
+    auto session = SessionData{};
+    session.addLaps({createOvalLap(20.0f), createOvalLap(22.0f), createOvalLap(18.0f)});
+    auto const detector = CornerDetector{createOvalTrack()};
+
+    auto const rankings = detector.rank(session);
+
+    REQUIRE(rankings.size() == 2);
+    for (auto const& ranking : rankings) {
+        REQUIRE(ranking.layout.apexSpeed == Catch::Approx(22.0f).margin(0.5f));
+        REQUIRE(ranking.results.size() == 3);
+        REQUIRE(ranking.results[0].lap == 1);
+        REQUIRE(ranking.results[1].lap == 0);
+        REQUIRE(ranking.results[2].lap == 2);
+
+        // All laps are measured between the same entry and exit.
+        for (auto const& result : ranking.results) {
+            REQUIRE(result.corner.entryDistance == ranking.layout.entryDistance);
+            REQUIRE(result.corner.exitDistance == ranking.layout.exitDistance);
+        }
+        REQUIRE(ranking.results[2].corner.apexSpeed == Catch::Approx(18.0f).margin(0.5f));
+        REQUIRE(ranking.results[0].corner.duration < ranking.results[2].corner.duration);
+    }
+
+    REQUIRE(detector.rank(SessionData{}).empty());
+}
+
+// NOLINTEND(bugprone-unchecked-optional-access)
+
+TEST_CASE("The CornerDetector session", "[.benchmark]")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto const detector = CornerDetector{session.getTrack()};
+
+    BENCHMARK("Rank the corners of all laps")
+    {
+        return detector.rank(session);
+    };
+}
@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/DerivedChannelEngine.hpp"
+#include "common/TrackGeometry.hpp"
+#include "testhelper/Sessions.hpp"
+#include "testhelper/SyntheticLaps.hpp"
+#include <catch2/catch_all.hpp>
+#include <numbers>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+constexpr auto Radius = 100.0f;
+constexpr auto Speed = 20.0f;
+constexpr auto Pi = std::numbers::pi_v<float>;
+auto const& projection = SyntheticLaps::getProjection();
+
+/**
+ * Creates a drive to the north that accelerates with 5 m/s².
+ */
+LapTelemetry createAcceleratingLap()
+{
+    auto telemetry = LapTelemetry{};
+    for (std::int64_t index = 0; index < 50; ++index) {
+        auto const seconds = static_cast<float>(index) / 10.0f;
+        auto const point = LocalPoint{.x = 0.0f, .y = 2.5f * seconds * seconds};
+        telemetry.append(GpsPositionData{
+            projection.unproject(point), Timestamp::fromMilliseconds(index * 100), Date{}, 5.0f * seconds});
+    }
+    return telemetry;
+}
+
+/**
+ * Adds a channel that counts its computations.
+ */
+void addCountingChannel(DerivedChannelEngine& engine, std::size_t& computations)
+{
+    REQUIRE(engine.addChannel(DerivedChannelEngine::ChannelDefinition{
+        .name = "double_distance",
+        .dependencies = {std::string{DerivedChannelEngine::DistanceChannel}},
+        .compute = [&computations](LapTelemetry const&,
+                                   std::span<std::span<float const> const> dependencies,
+                                   std::span<float> values) {
+            ++computations;
+            std::ranges::transform(dependencies[0], values.begin(), [](float distance) {
+                return 2.0f * distance;
+            });
+        }}));
+}
+
+} // namespace
+
+TEST_CASE("The DerivedChannelEngine shall derive the motion channels of a lap")
+{
+    auto engine = DerivedChannelEngine{};
+    auto const telemetry = SyntheticLaps::createCircleLap(Radius, Speed);
+
+    auto const distances = engine.getChannel(telemetry, DerivedChannelEngine::DistanceChannel);
+    auto const headings = engine.getChannel(telemetry, DerivedChannelEngine::HeadingChannel);
+    auto const longitudinal = engine.getChannel(telemetry, DerivedChannelEngine::LongitudinalAccelerationChannel);
+    auto const lateral = engine.getChannel(telemetry, DerivedChannelEngine::LateralAccelerationChannel);
+    auto const lean = engine.getChannel(telemetry, DerivedChannelEngine::LeanAngleChannel);
+
+    REQUIRE(distances.size() == telemetry.size());
+    REQUIRE(headings.size() == telemetry.size());
+    REQUIRE(longitudinal.size() == telemetry.size());
+    REQUIRE(lateral.size() == telemetry.size());
+    REQUIRE(lean.size() == telemetry.size());
+
+    // The circle is a left hand corner with an acceleration of v² / r, the positions have float precision.
+    auto const lateralAcceleration = -(Speed * Speed / Radius) / DerivedChannelEngine::Gravity;
+    for (std::size_t index = 10; index + 10 < telemetry.size(); index += 10) {
+        auto const distance = static_cast<float>(index) * Speed / 10.0f;
+        REQUIRE(distances[index] == Catch::Approx(distance).epsilon(0.01f));
+        auto const heading = std::fmod(450.0f - (distance / Radius * 180.0f / Pi), 360.0f);
+        REQUIRE(headings[index] == Catch::Approx(heading).margin(2.0f));
+        REQUIRE(longitudinal[index] == Catch::Approx(0.0f).margin(0.001f));
+        REQUIRE(lateral[index] == Catch::Approx(lateralAcceleration).margin(0.08f));
+        REQUIRE(lean[index] == Catch::Approx(std::atan(lateralAcceleration) * 180.0f / Pi).margin(4.0f));
+    }
+}
+
+TEST_CASE("The DerivedChannelEngine shall derive the longitudinal acceleration from the velocity")
+{
+    auto engine = DerivedChannelEngine{};
+    auto const telemetry = createAcceleratingLap();
+
+    auto const longitudinal = engine.getChannel(telemetry, DerivedChannelEngine::LongitudinalAccelerationChannel);
+    auto const headings = engine.getChannel(telemetry, DerivedChannelEngine::HeadingChannel);
+
+    for (std::size_t index = 0; index < telemetry.size(); ++index) {
+        REQUIRE(longitudinal[index] == Catch::Approx(5.0f / DerivedChannelEngine::Gravity));
+    }
+    REQUIRE(headings.back() == Catch::Approx(0.0f).margin(0.5f));
+}
+
+TEST_CASE("The DerivedChannelEngine shall compute a channel once per lap until the lap changes")
+{
+    auto engine = DerivedChannelEngine{};
+    auto computations = std::size_t{0};
+    addCountingChannel(engine, computations);
+    auto telemetry = createAcceleratingLap();
+
+    auto const values = engine.getChannel(telemetry, "double_distance");
+    REQUIRE(computations == 1);
+    REQUIRE(values.size() == telemetry.size());
+    REQUIRE(values.back() == Catch::Approx(2.0f * engine.getChannel(telemetry, "distance").back()));
+    REQUIRE(engine.getChannel(telemetry, "double_distance").data() == values.data());
+    REQUIRE(computations == 1);
+
+    // A copy has the same log points and uses the cached channels.
+    auto const copy = telemetry;
+    REQUIRE(engine.getChannel(copy, "double_distance").data() == values.data());
+    REQUIRE(computations == 1);
+
+    telemetry.append(GpsPositionData{projection.unproject(LocalPoint{.x = 0.0f, .y = 70.0f}),
+                                     Timestamp::fromMilliseconds(5000),
+                                     Date{},
+                                     25.0f});
+    REQUIRE(engine.getChannel(telemetry, "double_distance").size() == telemetry.size());
+    REQUIRE(computations == 2);
+
+    engine.clearCache();
+    std::ignore = engine.getChannel(telemetry, "double_distance");
+    REQUIRE(computations == 3);
+}
+
+TEST_CASE("The DerivedChannelEngine shall only cache the channels of the most recent laps")
+{
+    auto engine = DerivedChannelEngine{2};
+    auto computations = std::size_t{0};
+    addCountingChannel(engine, computations);
+    auto const laps = std::array{createAcceleratingLap(), createAcceleratingLap(), createAcceleratingLap()};
+
+    for (auto const& lap : laps) {
+        std::ignore = engine.getChannel(lap, "double_distance");
+    }
+    REQUIRE(computations == 3);
+
+    std::ignore = engine.getChannel(laps[2], "double_distance");
+    std::ignore = engine.getChannel(laps[1], "double_distance");
+    REQUIRE(computations == 3);
+    std::ignore = engine.getChannel(laps[0], "double_distance");
+    REQUIRE(computations == 4);
+}
+
+TEST_CASE("The DerivedChannelEngine shall only add channels with known dependencies")
+{
+    auto engine = DerivedChannelEngine{};
+    auto const compute = [](LapTelemetry const&, std::span<std::span<float const> const>, std::span<float>) {};
+
+    REQUIRE(engine.getChannelNames() ==
+            std::vector<std::string>{"distance", "heading", "g_long", "g_lat", "lean"});
+    REQUIRE_FALSE(engine.addChannel({.name = "heading", .dependencies = {}, .compute = compute}));
+    REQUIRE_FALSE(engine.addChannel({.name = "yaw", .dependencies = {"unknown"}, .compute = compute}));
+    REQUIRE_FALSE(engine.addChannel({.name = "yaw", .dependencies = {}, .compute = {}}));
+    REQUIRE_FALSE(engine.hasChannel("yaw"));
+    REQUIRE(engine.addChannel({.name = "yaw", .dependencies = {"heading"}, .compute = compute}));
+    REQUIRE(engine.hasChannel("yaw"));
+
+    REQUIRE(engine.getChannel(createAcceleratingLap(), "unknown").empty());
+    REQUIRE(engine.getChannel(LapTelemetry{}, "lean").empty());
+}
+
+TEST_CASE("The DerivedChannelEngine shall derive the channels of sampled points in m/s²")
+{
+    // A quarter circle with a radius of 100 m that is driven clockwise with 20 m/s, sampled every meter.
+    auto const count = std::size_t{158};
+    auto points = std::vector<LocalPoint>(count);
+    auto distances = std::vector<float>(count);
+    auto seconds = std::vector<float>(count);
+    auto const speeds = std::vector<float>(count, Speed);
+    for (std::size_t index = 0; index < count; ++index) {
+        auto const angle = static_cast<float>(index) / Radius;
+        points[index] = LocalPoint{.x = Radius * std::sin(angle), .y = Radius * std::cos(angle)};
+        distances[index] = static_cast<float>(index);
+        seconds[index] = static_cast<float>(index) / Speed;
+    }
+
+    auto headings = std::vector<float>(count);
+    auto longitudinal = std::vector<float>(count);
+    auto lateral = std::vector<float>(count);
+    DerivedChannelEngine::deriveHeadings(points, distances, headings);
+    DerivedChannelEngine::deriveLongitudinalAccelerations(speeds, seconds, longitudinal);
+    DerivedChannelEngine::deriveLateralAccelerations(speeds, seconds, distances, headings, lateral);
+
+    auto const index = count / 2;
+    REQUIRE(headings[index] == Catch::Approx(90.0f + (static_cast<float>(index) / Radius * 180.0f / Pi)).margin(1.0f));
+    REQUIRE(longitudinal[index] == Catch::Approx(0.0f).margin(0.01f));
+    REQUIRE(lateral[index] == Catch::Approx(Speed * Speed / Radius).margin(0.2f));
+}
+
+TEST_CASE("The DerivedChannelEngine session", "[.benchmark]")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto engine = DerivedChannelEngine{};
+
+    BENCHMARK("Derive all channels of all laps")
+    {
+        engine.clearCache();
+        auto count = std::size_t{0};
+        for (auto const& lap : session.getLaps()) {
+            for (auto const& name : engine.getChannelNames()) {
+                count += engine.getChannel(lap.getTelemetry(), name).size();
+            }
+        }
+        return count;
+    };
+}
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/DistanceCalculator.hpp"
+#include "testhelper/Sessions.hpp"
+#include <catch2/catch_all.hpp>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+LapTelemetry getRealWorldTelemetry()
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto telemetry = LapTelemetry{};
+    for (auto const& lap : session.getLaps()) {
+        for (auto const& position : lap.getTelemetry().toPositions()) {
+            telemetry.append(position);
+        }
+    }
+    return telemetry;
+}
+
+} // namespace
+
+TEST_CASE("The DistanceCalculator shall calculate the distances of consecutive positions")
+{
+    auto const telemetry = getRealWorldTelemetry();
+    auto const latitudes = telemetry.getLatitudes();
+    auto const longitudes = telemetry.getLongitudes();
+    REQUIRE(latitudes.size() > 100);
+
+    SECTION("Single precision distances match the distance of two positions")
+    {
+        auto distances = std::vector<float>(latitudes.size() - 1);
+        DistanceCalculator::calculateDistances(latitudes, longitudes, distances);
+
+        for (std::size_t index = 0; index < distances.size(); ++index) {
+            auto const expected = DistanceCalculator::calculateDistance(
+                PositionData{latitudes[index], longitudes[index]},
+                PositionData{latitudes[index + 1], longitudes[index + 1]});
+            REQUIRE(distances[index] == Catch::Approx(expected).margin(0.05));
+        }
+    }
+
+    SECTION("Double precision distances match the single precision distances")
+    {
+        auto const doubleLatitudes = std::vector<double>(latitudes.begin(), latitudes.end());
+        auto const doubleLongitudes = std::vector<double>(longitudes.begin(), longitudes.end());
+        auto doubleDistances = std::vector<double>(latitudes.size() - 1);
+        auto distances = std::vector<float>(latitudes.size() - 1);
+        DistanceCalculator::calculateDistances(doubleLatitudes, doubleLongitudes, doubleDistances);
+        DistanceCalculator::calculateDistances(latitudes, longitudes, distances);
+
+        for (std::size_t index = 0; index < distances.size(); ++index) {
+            REQUIRE(doubleDistances[index] == Catch::Approx(distances[index]).margin(0.01));
+        }
+    }
+
+    SECTION("Cumulative distances are the sum of the distances")
+    {
+        auto distances = std::vector<double>(latitudes.size() - 1);
+        auto cumulative = std::vector<double>(latitudes.size());
+        auto const doubleLatitudes = std::vector<double>(latitudes.begin(), latitudes.end());
+        auto const doubleLongitudes = std::vector<double>(longitudes.begin(), longitudes.end());
+        DistanceCalculator::calculateDistances(doubleLatitudes, doubleLongitudes, distances);
+        DistanceCalculator::calculateCumulativeDistances(doubleLatitudes, doubleLongitudes, cumulative);
+
+        REQUIRE(cumulative[0] == 0.0);
+        auto sum = 0.0;
+        for (std::size_t index = 0; index < distances.size(); ++index) {
+            sum += distances[index];
+            REQUIRE(cumulative[index + 1] == Catch::Approx(sum));
+        }
+    }
+}
+
+TEST_CASE("The DistanceCalculator shall handle too few positions and small outputs")
+{
+    auto const latitudes = std::vector<float>{52.0f, 52.0001f, 52.0002f};
+    auto const longitudes = std::vector<float>{11.0f, 11.0f, 11.0f};
+
+    SECTION("No distance for a single position")
+    {
+        auto distances = std::vector<float>{-1.0f};
+        DistanceCalculator::calculateDistances(
+            std::span{latitudes}.first(1), std::span{longitudes}.first(1), distances);
+        REQUIRE(distances[0] == -1.0f);
+    }
+
+    SECTION("Only the distances that fit into the output are calculated")
+    {
+        auto distances = std::vector<float>(1);
+        DistanceCalculator::calculateDistances(latitudes, longitudes, distances);
+        auto const expected = DistanceCalculator::calculateDistance(PositionData{latitudes[0], longitudes[0]},
+                                                                    PositionData{latitudes[1], longitudes[1]});
+        REQUIRE(distances[0] == Catch::Approx(expected).margin(0.05));
+    }
+
+    SECTION("The cumulative distance of a single position is zero")
+    {
+        auto distances = std::vector<float>{-1.0f};
+        DistanceCalculator::calculateCumulativeDistances(
+            std::span{latitudes}.first(1), std::span{longitudes}.first(1), distances);
+        REQUIRE(distances[0] == 0.0f);
+    }
+}
+
+TEST_CASE("The DistanceCalculator distances of a log", "[.benchmark]")
+{
+    auto const telemetry = getRealWorldTelemetry();
+    auto const latitudes = telemetry.getLatitudes();
+    auto const longitudes = telemetry.getLongitudes();
+    auto distances = std::vector<float>(latitudes.size() - 1);
+
+    BENCHMARK("Distance of two positions")
+    {
+        for (std::size_t index = 0; index < distances.size(); ++index) {
+            distances[index] =
+                DistanceCalculator::calculateDistance(PositionData{latitudes[index], longitudes[index]},
+                                                      PositionData{latitudes[index + 1], longitudes[index + 1]});
+        }
+        return distances.back();
+    };
+
+    BENCHMARK("Distances of the positions arrays")
+    {
+        DistanceCalculator::calculateDistances(latitudes, longitudes, distances);
+        return distances.back();
+    };
+}
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/LapComparison.hpp"
+#include "algorithm/TrackGenerator.hpp"
+#include "testhelper/Sessions.hpp"
+#include "testhelper/SyntheticLaps.hpp"
+#include <catch2/catch_all.hpp>
+#include <numbers>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+constexpr auto Radius = 100.0f;
+constexpr auto Pi = std::numbers::pi_v<float>;
+auto const& projection = SyntheticLaps::getProjection();
+
+/**
+ * Creates a track on the circle, the finish line is 5 meter after the start of the circle.
+ */
+TrackData createCircleTrack()
+{
+    auto const lapLength = 2.0f * Pi * Radius;
+    auto track = TrackData{};
+    track.setFinishline(projection.unproject(SyntheticLaps::getCirclePoint(Radius, 5.0f)));
+    track.setSections({projection.unproject(SyntheticLaps::getCirclePoint(Radius, 5.0f + (lapLength / 3.0f))),
+                       projection.unproject(SyntheticLaps::getCirclePoint(Radius, 5.0f + (2.0f * lapLength / 3.0f)))});
+    track.setTopology(TrackTopology::Circuit);
+    return track;
+}
+
+} // namespace
+
+TEST_CASE("The LapComparison shall resample the channels of a lap onto the distance grid")
+{
+    auto const comparison = LapComparison{createCircleTrack()};
+    auto const telemetry = SyntheticLaps::createCircleLap(Radius, 20.0f);
+
+    auto const lap = comparison.resample(telemetry.getView());
+
+    REQUIRE(lap.gridSpacing == LapComparison::DefaultGridSpacing);
+    REQUIRE(lap.size() == Catch::Approx(2.0f * Pi * Radius - 5.0f).margin(3.0f));
+    REQUIRE(lap.speeds.size() == lap.size());
+    REQUIRE(lap.headings.size() == lap.size());
+    REQUIRE(lap.longitudinalAccelerations.size() == lap.size());
+    REQUIRE(lap.lateralAccelerations.size() == lap.size());
+
+    // The grid starts at the finish line, 5 meter after the first log point.
+    REQUIRE(lap.times[0] == Catch::Approx(0.0f).margin(2.0f));
+    // The heading and the yaw rate need the grid points of the baseline on both sides. The positions have float
+    // precision, a latitude is only exact to about 0.4 meter.
+    auto lateralAccelerationSum = 0.0f;
+    auto lateralAccelerationCount = 0;
+    for (std::size_t index = 20; index + 20 < lap.size(); index += 10) {
+        auto const distance = static_cast<float>(index);
+        REQUIRE(lap.times[index] == Catch::Approx(distance / 20.0f * 1000.0f).epsilon(0.01f));
+        REQUIRE(lap.speeds[index] == Catch::Approx(20.0f));
+
+        // The circle is a left hand corner with an acceleration of v² / r.
+        auto const heading = std::fmod(450.0f - ((distance + 5.0f) / Radius * 180.0f / Pi), 360.0f);
+        REQUIRE(lap.headings[index] == Catch::Approx(heading).margin(2.0f));
+        REQUIRE(lap.longitudinalAccelerations[index] == Catch::Approx(0.0f).margin(0.01f));
+        REQUIRE(lap.lateralAccelerations[index] == Catch::Approx(-4.0f).margin(0.75f));
+        lateralAccelerationSum += lap.lateralAccelerations[index];
+        ++lateralAccelerationCount;
+    }
+    REQUIRE(lateralAccelerationSum / static_cast<float>(lateralAccelerationCount) == Catch::Approx(-4.0f).margin(0.1f));
+}
+
+TEST_CASE("The LapComparison shall give no channels for a lap with less than two log points")
+{
+    auto const comparison = LapComparison{createCircleTrack()};
+    auto telemetry = LapTelemetry{};
+    auto const position = projection.unproject(SyntheticLaps::getCirclePoint(Radius, 0.0f));
+    telemetry.append(GpsPositionData{position, Timestamp{}, Date{}, 20.0f});
+
+    REQUIRE(comparison.resample(telemetry.getView()).size() == 0);
+}
+
+TEST_CASE("The LapComparison shall give the delta time and the speed difference by distance")
+{
+    auto const comparison = LapComparison{createCircleTrack()};
+    auto const reference = comparison.resample(SyntheticLaps::createCircleLap(Radius, 20.0f).getView());
+    auto const lap = comparison.resample(SyntheticLaps::createCircleLap(Radius, 25.0f).getView());
+
+    auto const difference = LapComparison::compare(reference, lap);
+
+    REQUIRE(difference.deltaTimes.size() == std::min(reference.size(), lap.size()));
+    REQUIRE(difference.speedDifferences.size() == difference.deltaTimes.size());
+    for (std::size_t index = 0; index < difference.deltaTimes.size(); index += 50) {
+        auto const distance = static_cast<float>(index);
+        auto const delta = (distance / 25.0f - distance / 20.0f) * 1000.0f;
+        REQUIRE(difference.deltaTimes[index] == Catch::Approx(delta).margin(2.0f + (distance / 2.0f)));
+        REQUIRE(difference.speedDifferences[index] == Catch::Approx(5.0f));
+    }
+}
+
+// NOLINTBEGIN(bugprone-unchecked-optional-access)
+
+TEST_CASE("The LapComparison shall compare all laps of a session to the reference lap")
+{
+    auto const session = Sessions::getRealWorldSession();
+    REQUIRE(session.getNumberOfLaps() > 3);
+    auto const track = TrackGenerator{}.generate(session);
+    REQUIRE(track.has_value());
+    auto const comparison = LapComparison{track->track};
+
+    auto const differences = comparison.compareSession(session, 2, 4);
+
+    REQUIRE(differences.size() == session.getNumberOfLaps());
+    REQUIRE_FALSE(differences[2].deltaTimes.empty());
+    for (std::size_t index = 0; index < differences[2].deltaTimes.size(); ++index) {
+        REQUIRE(differences[2].deltaTimes[index] == 0.0f);
+        REQUIRE(differences[2].speedDifferences[index] == 0.0f);
+    }
+
+    // The parallel comparison gives the same traces as the comparison of every single lap.
+    auto const reference = comparison.resample(session.getLaps()[2].getTelemetry().getView());
+    for (std::size_t lap = 0; lap < session.getNumberOfLaps(); ++lap) {
+        auto const expected =
+            LapComparison::compare(reference, comparison.resample(session.getLaps()[lap].getTelemetry().getView()));
+        REQUIRE(differences[lap].deltaTimes == expected.deltaTimes);
+        REQUIRE(differences[lap].speedDifferences == expected.speedDifferences);
+    }
+
+    REQUIRE(comparison.compareSession(session, session.getNumberOfLaps()).empty());
+}
+
+// NOLINTEND(bugprone-unchecked-optional-access)
+
+TEST_CASE("The LapComparison session", "[.benchmark]")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto const comparison = LapComparison{session.getTrack()};
+
+    BENCHMARK("Compare all laps on a single thread")
+    {
+        return comparison.compareSession(session, 0, 1);
+    };
+
+    BENCHMARK("Compare all laps on all cores")
+    {
+        return comparison.compareSession(session, 0);
+    };
+}
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/LapDeltaEngine.hpp"
+#include "testhelper/Sessions.hpp"
+#include "testhelper/SyntheticLaps.hpp"
+#include <catch2/catch_all.hpp>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+/**
+ * Creates a straight lap to the north with a log point every 10 meter.
+ */
+std::vector<GpsPositionData> createStraight(std::int64_t millisecondsPerPoint)
+{
+    auto const& projection = SyntheticLaps::getProjection();
+    auto positions = std::vector<GpsPositionData>{};
+    for (std::int64_t index = 0; index < 11; ++index) {
+        auto const position = projection.unproject(LocalPoint{.x = 0.0f, .y = static_cast<float>(index) * 10.0f});
+        positions.emplace_back(position, Timestamp::fromMilliseconds(index * millisecondsPerPoint), Date{});
+    }
+    return positions;
+}
+
+LapData createLap(std::vector<GpsPositionData> const& positions, Timestamp const& laptime)
+{
+    return LapData{{laptime}, LapTelemetry::fromPositions(positions)};
+}
+
+} // namespace
+
+TEST_CASE("The LapDeltaEngine shall give no delta without reference lap")
+{
+    auto engine = LapDeltaEngine{};
+    engine.startLap();
+
+    REQUIRE_FALSE(engine.hasReferenceLap());
+    REQUIRE_FALSE(engine.update(createStraight(1000)[0]).has_value());
+}
+
+TEST_CASE("The LapDeltaEngine shall give the time difference to the reference lap at the same distance")
+{
+    auto engine = LapDeltaEngine{};
+    engine.setReferenceLap(createLap(createStraight(1000), Timestamp{"00:00:10.000"}));
+    REQUIRE(engine.hasReferenceLap());
+    REQUIRE(engine.getReferenceLaptime() == Timestamp{"00:00:10.000"});
+
+    // The current lap is 100 ms per log point slower than the reference lap.
+    auto const positions = createStraight(1100);
+    engine.startLap();
+    for (std::size_t index = 0; index < positions.size(); ++index) {
+        auto const delta = engine.update(positions[index]);
+        REQUIRE(delta.has_value());
+        // NOLINTBEGIN(bugprone-unchecked-optional-access)
+        REQUIRE(delta->deltaInMilliseconds == static_cast<std::int32_t>(index) * 100);
+        REQUIRE(delta->predictedLaptime.toMilliseconds() == 10000 + (static_cast<std::int64_t>(index) * 100));
+        REQUIRE(delta->distance == Catch::Approx(static_cast<float>(index) * 10.0f).margin(0.5));
+        // NOLINTEND(bugprone-unchecked-optional-access)
+    }
+}
+
+TEST_CASE("The LapDeltaEngine shall interpolate between the log points of the reference lap")
+{
+    auto engine = LapDeltaEngine{};
+    engine.setReferenceLap(createLap(createStraight(1000), Timestamp{"00:00:10.000"}));
+
+    auto const& projection = SyntheticLaps::getProjection();
+    engine.startLap();
+    std::ignore = engine.update(createStraight(1000)[0]);
+    auto const delta = engine.update(GpsPositionData{
+        projection.unproject(LocalPoint{.x = 2.0f, .y = 25.0f}), Timestamp::fromMilliseconds(2000), Date{}});
+
+    REQUIRE(delta.has_value());
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    REQUIRE(delta->deltaInMilliseconds == -500);
+    REQUIRE(delta->distance == Catch::Approx(25.0f).margin(0.5));
+    // NOLINTEND(bugprone-unchecked-optional-access)
+}
+
+TEST_CASE("The LapDeltaEngine shall give no delta for a position far away from the reference lap")
+{
+    auto engine = LapDeltaEngine{};
+    engine.setReferenceLap(createLap(createStraight(1000), Timestamp{"00:00:10.000"}));
+
+    engine.startLap();
+    REQUIRE_FALSE(engine.update(GpsPositionData{PositionData{52.1f, 11.1f}, Timestamp{}, Date{}}).has_value());
+}
+
+TEST_CASE("The LapDeltaEngine shall follow a recorded lap")
+{
+    auto const session = Sessions::getRealWorldSession();
+    REQUIRE(session.getNumberOfLaps() > 3);
+    auto const& reference = session.getLaps()[1];
+    auto const& lap = session.getLaps()[2];
+
+    auto engine = LapDeltaEngine{};
+    engine.setReferenceLap(reference);
+
+    SECTION("The reference lap has no delta to itself")
+    {
+        engine.startLap();
+        for (auto const& position : reference.getTelemetry().toPositions()) {
+            auto const delta = engine.update(position);
+            REQUIRE(delta.has_value());
+            // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+            REQUIRE(delta->deltaInMilliseconds == 0);
+        }
+    }
+
+    SECTION("The delta at the end of the lap is the difference of the laptimes")
+    {
+        auto delta = std::optional<LapDelta>{};
+        engine.startLap();
+        for (auto const& position : lap.getTelemetry().toPositions()) {
+            delta = engine.update(position).value_or(LapDelta{});
+        }
+
+        // The laps are measured from their first log point, the log points are 100 ms apart.
+        auto const expected = lap.getLaptime().toMilliseconds() - reference.getLaptime().toMilliseconds();
+        REQUIRE(delta.has_value());
+        // NOLINTBEGIN(bugprone-unchecked-optional-access)
+        REQUIRE(std::abs(delta->deltaInMilliseconds - expected) <= 200);
+        REQUIRE(std::abs(delta->predictedLaptime.toMilliseconds() - lap.getLaptime().toMilliseconds()) <= 200);
+        // NOLINTEND(bugprone-unchecked-optional-access)
+    }
+}
+
+TEST_CASE("The LapDeltaEngine update", "[.benchmark]")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto engine = LapDeltaEngine{};
+    engine.setReferenceLap(session.getLaps()[1]);
+    auto const positions = session.getLaps()[2].getTelemetry().toPositions();
+
+    BENCHMARK("Delta of all positions of a lap")
+    {
+        auto sum = std::int64_t{0};
+        engine.startLap();
+        for (auto const& position : positions) {
+            sum += engine.update(position).value_or(LapDelta{}).deltaInMilliseconds;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/LapReplayEngine.hpp"
+#include "algorithm/LineCrossingLaptimer.hpp"
+#include "testhelper/Positions.hpp"
+#include "testhelper/Sessions.hpp"
+#include "testhelper/Tracks.hpp"
+#include <catch2/catch_all.hpp>
+#include <array>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+void drive(LapTelemetry& telemetry, std::array<PositionData, 4> const& points, Timestamp const& startTime)
+{
+    for (std::size_t index = 0; index < points.size(); ++index) {
+        auto const time = startTime + Timestamp::fromMilliseconds(static_cast<std::int64_t>(index) * 1000);
+        telemetry.append(GpsPositionData{points[index], time, {}});
+    }
+}
+
+std::array<PositionData, 4> getStartFinishLinePoints()
+{
+    return {Positions::getOscherslebenStartFinishLine1(),
+            Positions::getOscherslebenStartFinishLine2(),
+            Positions::getOscherslebenStartFinishLine3(),
+            Positions::getOscherslebenStartFinishLine4()};
+}
+
+std::array<PositionData, 4> getSector1Points()
+{
+    return {Positions::getOscherslebenSector1Point1(),
+            Positions::getOscherslebenSector1Point2(),
+            Positions::getOscherslebenSector1Point3(),
+            Positions::getOscherslebenSector1Point4()};
+}
+
+std::array<PositionData, 4> getSector2Points()
+{
+    return {Positions::getOscherslebenSector2Point1(),
+            Positions::getOscherslebenSector2Point2(),
+            Positions::getOscherslebenSector2Point3(),
+            Positions::getOscherslebenSector2Point4()};
+}
+
+} // namespace
+
+TEST_CASE("The LapReplayEngine shall give the laps and sectors of the telemetry.")
+{
+    auto telemetry = LapTelemetry{};
+    drive(telemetry, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    drive(telemetry, getSector1Points(), Timestamp{"15:05:40.234"});
+    drive(telemetry, getSector2Points(), Timestamp{"15:06:00.234"});
+    drive(telemetry, getStartFinishLinePoints(), Timestamp{"15:06:10.247"});
+    drive(telemetry, getSector1Points(), Timestamp{"15:06:40.234"});
+
+    auto const laps = LapReplayEngine{Tracks::getOscherslebenGateTrack()}.replay(telemetry.getView());
+
+    // The second lap isn't finished.
+    REQUIRE(laps.size() == 1);
+    REQUIRE(laps[0].getSectorTimeCount() == 3);
+    REQUIRE(laps[0].getLaptime() == Timestamp{"00:01:00.013"});
+}
+
+TEST_CASE("The LapReplayEngine shall give the lap times of the line crossing laptimer.")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto const track = Tracks::getOscherslebenGateTrack();
+
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapTimes = std::vector<Timestamp>{};
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapFinished.connect([&lapTimes, &lapTimer]() {
+        lapTimes.push_back(lapTimer.getLastLaptime());
+    });
+    for (auto const& lap : session.getLaps()) {
+        for (auto const& position : lap.getTelemetry().toPositions()) {
+            lapTimer.updatePositionAndTime(position);
+        }
+    }
+
+    auto const laps = LapReplayEngine{track}.replay(session);
+
+    REQUIRE(laps.size() == 10);
+    REQUIRE(laps.size() == lapTimes.size());
+    for (std::size_t index = 0; index < laps.size(); ++index) {
+        INFO("Lap " << index);
+        REQUIRE(laps[index].getSectorTimeCount() == 3);
+        REQUIRE(laps[index].getLaptime() == lapTimes[index]);
+    }
+}
+
+TEST_CASE("The LapReplayEngine shall wait for the start line after the finish of a point to point track.")
+{
+    auto track = TrackData{};
+    track.setTopology(TrackTopology::PointToPoint);
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionSector1Line());
+
+    auto telemetry = LapTelemetry{};
+    drive(telemetry, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    drive(telemetry, getSector1Points(), Timestamp{"15:06:10.234"});
+    drive(telemetry, getSector1Points(), Timestamp{"15:07:10.234"});
+    drive(telemetry, getStartFinishLinePoints(), Timestamp{"15:08:10.234"});
+    drive(telemetry, getSector1Points(), Timestamp{"15:09:10.247"});
+
+    auto const laps = LapReplayEngine{track}.replay(telemetry.getView());
+
+    // Driving over the finish line again doesn't finish a lap without a start, the second lap is 13 ms slower.
+    REQUIRE(laps.size() == 2);
+    REQUIRE(laps[1].getLaptime().toMilliseconds() - laps[0].getLaptime().toMilliseconds() == 13);
+}
+
+TEST_CASE("The LapReplayEngine shall replay many sessions in parallel.")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto const track = Tracks::getOscherslebenGateTrack();
+    auto const sessions = std::vector<SessionData>(17, session);
+    auto const expectedLaps = LapReplayEngine{track}.replay(session);
+
+    auto const threadCount = GENERATE(std::size_t{0}, std::size_t{1}, std::size_t{4}, std::size_t{32});
+    auto const results = LapReplayEngine::replaySessions(track, sessions, threadCount);
+
+    REQUIRE(results.size() == sessions.size());
+    for (auto const& laps : results) {
+        REQUIRE(laps == expectedLaps);
+    }
+    REQUIRE(LapReplayEngine::replaySessions(track, {}, threadCount).empty());
+}
+
+TEST_CASE("The LapReplayEngine throughput", "[.benchmark]")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto const track = Tracks::getOscherslebenGateTrack();
+    auto const engine = LapReplayEngine{track};
+    auto const sessions = std::vector<SessionData>(64, session);
+
+    BENCHMARK("Replay of a session")
+    {
+        return engine.replay(session);
+    };
+
+    BENCHMARK("Replay of 64 sessions on all cores")
+    {
+        return LapReplayEngine::replaySessions(track, sessions);
+    };
+}
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/LineCrossingDetector.hpp"
+#include "common/TrackData.hpp"
+#include "testhelper/Positions.hpp"
+#include <algorithm>
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <vector>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+using Line = LineCrossingDetector::Line;
+
+std::vector<LineCrossingDetector::Crossing> drive(LineCrossingDetector& detector,
+                                                  std::array<PositionData, 4> const& points,
+                                                  double startTime)
+{
+    auto crossings = std::vector<LineCrossingDetector::Crossing>{};
+    for (std::size_t index = 0; index < points.size(); ++index) {
+        auto const crossing = detector.update(points[index], startTime + (static_cast<double>(index) * 1000.0));
+        if (crossing.has_value()) {
+            crossings.push_back(*crossing);
+        }
+    }
+    return crossings;
+}
+
+std::array<PositionData, 4> getStartFinishLinePoints()
+{
+    return {Positions::getOscherslebenStartFinishLine1(),
+            Positions::getOscherslebenStartFinishLine2(),
+            Positions::getOscherslebenStartFinishLine3(),
+            Positions::getOscherslebenStartFinishLine4()};
+}
+
+std::array<PositionData, 4> getSector1Points()
+{
+    return {Positions::getOscherslebenSector1Point1(),
+            Positions::getOscherslebenSector1Point2(),
+            Positions::getOscherslebenSector1Point3(),
+            Positions::getOscherslebenSector1Point4()};
+}
+
+std::array<PositionData, 4> getSector2Points()
+{
+    return {Positions::getOscherslebenSector2Point1(),
+            Positions::getOscherslebenSector2Point2(),
+            Positions::getOscherslebenSector2Point3(),
+            Positions::getOscherslebenSector2Point4()};
+}
+
+} // namespace
+
+TEST_CASE("The LineCrossingDetector shall report the lines of a circuit in the order of the track")
+{
+    auto track = TrackData{};
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setSections(
+        {Positions::getOscherslebenPositionSector1Line(), Positions::getOscherslebenPositionSector2Line()});
+    auto detector = LineCrossingDetector{track.getGeometry()};
+    REQUIRE_FALSE(detector.isLapActive());
+
+    // The section lines are only expected after the start.
+    REQUIRE(drive(detector, getSector1Points(), 0.0).empty());
+
+    auto crossings = drive(detector, getStartFinishLinePoints(), 10000.0);
+    REQUIRE(crossings.size() == 1);
+    REQUIRE(crossings[0].line == Line::Start);
+    REQUIRE(crossings[0].time > 10000.0);
+    REQUIRE(crossings[0].time < 13000.0);
+    REQUIRE(detector.isLapActive());
+
+    // The finish line isn't expected before the sections.
+    REQUIRE(drive(detector, getStartFinishLinePoints(), 20000.0).empty());
+    crossings = drive(detector, getSector1Points(), 30000.0);
+    REQUIRE(crossings.size() == 1);
+    REQUIRE(crossings[0].line == Line::Section);
+    crossings = drive(detector, getSector2Points(), 40000.0);
+    REQUIRE(crossings.size() == 1);
+    REQUIRE(crossings[0].line == Line::Section);
+
+    // The next lap of the circuit starts with the finish.
+    crossings = drive(detector, getStartFinishLinePoints(), 50000.0);
+    REQUIRE(crossings.size() == 1);
+    REQUIRE(crossings[0].line == Line::Finish);
+    REQUIRE(detector.isLapActive());
+}
+
+TEST_CASE("The LineCrossingDetector shall wait for the start line after the finish of a point to point track")
+{
+    auto track = TrackData{};
+    track.setTopology(TrackTopology::PointToPoint);
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionSector1Line());
+    auto detector = LineCrossingDetector{track.getGeometry()};
+
+    auto crossings = drive(detector, getStartFinishLinePoints(), 0.0);
+    REQUIRE(crossings.size() == 1);
+    REQUIRE(crossings[0].line == Line::Start);
+
+    crossings = drive(detector, getSector1Points(), 10000.0);
+    REQUIRE(crossings.size() == 1);
+    REQUIRE(crossings[0].line == Line::Finish);
+    REQUIRE_FALSE(detector.isLapActive());
+
+    REQUIRE(drive(detector, getSector1Points(), 20000.0).empty());
+}
+
+TEST_CASE("The LineCrossingDetector shall not count driving back over a gate")
+{
+    auto track = TrackData{};
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    auto detector = LineCrossingDetector{track.getGeometry()};
+
+    auto points = getStartFinishLinePoints();
+    auto crossings = drive(detector, points, 0.0);
+    REQUIRE(crossings.size() == 1);
+    REQUIRE(crossings[0].line == Line::Start);
+
+    // The finish gate took the direction of the start, so the way back isn't a lap.
+    std::ranges::reverse(points);
+    REQUIRE(drive(detector, points, 10000.0).empty());
+    std::ranges::reverse(points);
+    crossings = drive(detector, points, 20000.0);
+    REQUIRE(crossings.size() == 1);
+    REQUIRE(crossings[0].line == Line::Finish);
+}
@@ -0,0 +1,342 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/LineCrossingLaptimer.hpp"
+#include "testhelper/Positions.hpp"
+#include "testhelper/Sessions.hpp"
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <vector>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+std::array<PositionData, 4> getStartFinishLinePoints()
+{
+    return {Positions::getOscherslebenStartFinishLine1(),
+            Positions::getOscherslebenStartFinishLine2(),
+            Positions::getOscherslebenStartFinishLine3(),
+            Positions::getOscherslebenStartFinishLine4()};
+}
+
+std::array<PositionData, 4> getSector1Points()
+{
+    return {Positions::getOscherslebenSector1Point1(),
+            Positions::getOscherslebenSector1Point2(),
+            Positions::getOscherslebenSector1Point3(),
+            Positions::getOscherslebenSector1Point4()};
+}
+
+std::array<PositionData, 4> getSector2Points()
+{
+    return {Positions::getOscherslebenSector2Point1(),
+            Positions::getOscherslebenSector2Point2(),
+            Positions::getOscherslebenSector2Point3(),
+            Positions::getOscherslebenSector2Point4()};
+}
+
+void drive(ILaptimer& laptimer, std::array<PositionData, 4> const& points, Timestamp const& startTime)
+{
+    for (std::size_t index = 0; index < points.size(); ++index) {
+        auto const time = startTime + Timestamp::fromMilliseconds(static_cast<std::int64_t>(index) * 1000);
+        laptimer.updatePositionAndTime(GpsPositionData{points[index], time, {}});
+    }
+}
+
+} // namespace
+
+TEST_CASE("The line crossing laptimer shall emit lapStarted when crossing the start line for the first time.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapStartedEmitted = false;
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapStarted.connect([&lapStartedEmitted]() {
+        lapStartedEmitted = true;
+    });
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+
+    REQUIRE(lapStartedEmitted == true);
+}
+
+TEST_CASE("The line crossing laptimer shall send all signals for a whole lap.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapStartedEmitted = false;
+    auto sectorFinishedEmitted = std::uint32_t{0};
+    auto lapFinishedEmitted = false;
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setSections(
+        {Positions::getOscherslebenPositionSector1Line(), Positions::getOscherslebenPositionSector2Line()});
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapStarted.connect([&lapStartedEmitted]() {
+        lapStartedEmitted = true;
+    });
+    std::ignore = lapTimer.sectorFinished.connect([&sectorFinishedEmitted]() {
+        ++sectorFinishedEmitted;
+    });
+    std::ignore = lapTimer.lapFinished.connect([&lapFinishedEmitted]() {
+        lapFinishedEmitted = true;
+    });
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    REQUIRE(lapStartedEmitted == true);
+
+    drive(lapTimer, getSector1Points(), Timestamp{"15:06:10.234"});
+    REQUIRE(sectorFinishedEmitted == 1);
+
+    drive(lapTimer, getSector2Points(), Timestamp{"15:07:10.234"});
+    REQUIRE(sectorFinishedEmitted == 2);
+
+    lapStartedEmitted = false;
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:08:10.234"});
+    REQUIRE(lapFinishedEmitted == true);
+    REQUIRE(lapStartedEmitted == true);
+}
+
+TEST_CASE("The line crossing laptimer shall wait for the start line after the track is changed during a lap.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapStartedEmitted = false;
+    auto lapFinishedEmitted = false;
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setSections(
+        {Positions::getOscherslebenPositionSector1Line(), Positions::getOscherslebenPositionSector2Line()});
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapStarted.connect([&lapStartedEmitted]() {
+        lapStartedEmitted = true;
+    });
+    std::ignore = lapTimer.lapFinished.connect([&lapFinishedEmitted]() {
+        lapFinishedEmitted = true;
+    });
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    drive(lapTimer, getSector1Points(), Timestamp{"15:06:10.234"});
+
+    // The new track has no sections, the lap of the previous track must not be continued.
+    auto trackWithoutSections = TrackData{};
+    trackWithoutSections.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    trackWithoutSections.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    lapTimer.setTrack(trackWithoutSections);
+    REQUIRE(lapTimer.currentLaptime.get() == Timestamp{});
+
+    lapStartedEmitted = false;
+    drive(lapTimer, getSector2Points(), Timestamp{"15:07:10.234"});
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:08:10.234"});
+    REQUIRE(lapStartedEmitted == true);
+    REQUIRE(lapFinishedEmitted == false);
+}
+
+TEST_CASE("The line crossing laptimer shall interpolate the lap time between the positions. Lap is without sector.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapFinishedEmitted = std::uint32_t{0};
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapFinished.connect([&lapFinishedEmitted]() {
+        ++lapFinishedEmitted;
+    });
+
+    // The line is crossed between the second and the third position, the current laptime starts at the crossing.
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    REQUIRE(lapTimer.currentLaptime.get() > Timestamp{"00:00:01.000"});
+    REQUIRE(lapTimer.currentLaptime.get() < Timestamp{"00:00:02.000"});
+
+    // The same positions one minute and 13 milliseconds later, the time between the crossings is exact and not
+    // quantized to the time between the positions. Driving back to the first position isn't a crossing.
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:06:10.247"});
+    REQUIRE(lapFinishedEmitted == 1);
+    REQUIRE(lapTimer.getLastLaptime() == Timestamp{"00:01:00.013"});
+    REQUIRE(lapTimer.getLastSectorTime() == Timestamp{"00:01:00.013"});
+}
+
+TEST_CASE("The line crossing laptimer shall give the sector time from the crossing of the start line.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setSections({Positions::getOscherslebenPositionSector1Line()});
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    lapTimer.setTrack(track);
+
+    // Both lines are crossed between the second and the third position.
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    drive(lapTimer, getSector1Points(), Timestamp{"15:06:10.234"});
+
+    REQUIRE(lapTimer.getLastSectorTime() > Timestamp{"00:00:59.000"});
+    REQUIRE(lapTimer.getLastSectorTime() < Timestamp{"00:01:01.000"});
+    REQUIRE(lapTimer.currentSectorTime.get() > Timestamp{"00:00:01.000"});
+    REQUIRE(lapTimer.currentSectorTime.get() < Timestamp{"00:00:02.000"});
+}
+
+TEST_CASE("The line crossing laptimer shall emit the signals sector and lap started finished even for two laps.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapStartedEmitted = std::uint32_t{0};
+    auto lapFinishedEmitted = std::uint32_t{0};
+    auto sectorFinishedEmitted = std::uint32_t{0};
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setSections({Positions::getOscherslebenPositionSector1Line()});
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapStarted.connect([&lapStartedEmitted]() {
+        ++lapStartedEmitted;
+    });
+    std::ignore = lapTimer.lapFinished.connect([&lapFinishedEmitted]() {
+        ++lapFinishedEmitted;
+    });
+    std::ignore = lapTimer.sectorFinished.connect([&sectorFinishedEmitted]() {
+        ++sectorFinishedEmitted;
+    });
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    drive(lapTimer, getSector1Points(), Timestamp{"15:06:10.234"});
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:07:10.234"});
+    drive(lapTimer, getSector1Points(), Timestamp{"15:08:10.234"});
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:09:10.234"});
+
+    REQUIRE(lapStartedEmitted == 3);
+    REQUIRE(sectorFinishedEmitted == 2);
+    REQUIRE(lapFinishedEmitted == 2);
+}
+
+TEST_CASE("The line crossing laptimer shall handle a lap over midnight.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    lapTimer.setTrack(track);
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"23:59:30.000"});
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"00:00:30.500"});
+
+    REQUIRE(lapTimer.getLastLaptime() == Timestamp{"00:01:00.500"});
+}
+
+TEST_CASE("The line crossing laptimer shall give the lap times of the recorded Oschersleben laps.")
+{
+    auto const session = Sessions::getRealWorldSession();
+    REQUIRE(session.getNumberOfLaps() == 11);
+
+    // The gates are placed on the track by hand, a gate isn't perpendicular to the chord between its neighbours.
+    auto const sections = GENERATE(std::vector<PositionData>{Positions::getOscherslebenPositionSector1Line()},
+                                   std::vector<PositionData>{Positions::getOscherslebenPositionSector2Line()},
+                                   std::vector<PositionData>{Positions::getOscherslebenPositionSector1Line(),
+                                                             Positions::getOscherslebenPositionSector2Line()});
+    auto track = TrackData{};
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setSections(sections);
+
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapTimes = std::vector<Timestamp>{};
+    auto sectorsFinished = std::size_t{0};
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapFinished.connect([&lapTimes, &lapTimer]() {
+        lapTimes.push_back(lapTimer.getLastLaptime());
+    });
+    std::ignore = lapTimer.sectorFinished.connect([&sectorsFinished]() {
+        ++sectorsFinished;
+    });
+
+    for (auto const& lap : session.getLaps()) {
+        for (auto const& position : lap.getTelemetry().toPositions()) {
+            lapTimer.updatePositionAndTime(position);
+        }
+    }
+
+    // The log points of the first lap start behind the finish line, so the first lap isn't timed. The recorded
+    // points are 100 ms apart, the interpolated lap times match the recorded lap times by a few milliseconds.
+    INFO("Sections " << sections.size());
+    REQUIRE(lapTimes.size() == session.getNumberOfLaps() - 1);
+    REQUIRE(sectorsFinished == lapTimes.size() * sections.size());
+    for (std::size_t index = 0; index < lapTimes.size(); ++index) {
+        auto const expected = session.getLaps()[index + 1].getLaptime().toMilliseconds();
+        auto const lapTime = lapTimes[index].toMilliseconds();
+        INFO("Lap " << index + 1);
+        REQUIRE(std::abs(lapTime - expected) <= 3);
+    }
+}
+
+TEST_CASE("The line crossing laptimer shall wait for the start line after the finish of a point to point track.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapStartedEmitted = std::uint32_t{0};
+    auto lapFinishedEmitted = std::uint32_t{0};
+
+    auto track = TrackData{};
+    track.setTopology(TrackTopology::PointToPoint);
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionSector1Line());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapStarted.connect([&lapStartedEmitted]() {
+        ++lapStartedEmitted;
+    });
+    std::ignore = lapTimer.lapFinished.connect([&lapFinishedEmitted]() {
+        ++lapFinishedEmitted;
+    });
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    drive(lapTimer, getSector1Points(), Timestamp{"15:06:10.234"});
+    REQUIRE(lapStartedEmitted == 1);
+    REQUIRE(lapFinishedEmitted == 1);
+    REQUIRE(lapTimer.currentLaptime.get() == Timestamp{});
+
+    // Driving over the finish line again doesn't finish a lap without a start.
+    drive(lapTimer, getSector1Points(), Timestamp{"15:07:10.234"});
+    REQUIRE(lapFinishedEmitted == 1);
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:08:10.234"});
+    drive(lapTimer, getSector1Points(), Timestamp{"15:09:10.247"});
+    REQUIRE(lapStartedEmitted == 2);
+    REQUIRE(lapFinishedEmitted == 2);
+}
+
+TEST_CASE("The line crossing laptimer shall finish a lap at the pit lane line of a circuit.")
+{
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapStartedEmitted = std::uint32_t{0};
+    auto lapFinishedEmitted = std::uint32_t{0};
+
+    auto track = TrackData{};
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setPitLaneLine(Positions::getOscherslebenPositionSector1Line());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapStarted.connect([&lapStartedEmitted]() {
+        ++lapStartedEmitted;
+    });
+    std::ignore = lapTimer.lapFinished.connect([&lapFinishedEmitted]() {
+        ++lapFinishedEmitted;
+    });
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:05:10.234"});
+    drive(lapTimer, getSector1Points(), Timestamp{"15:06:10.234"});
+    REQUIRE(lapFinishedEmitted == 1);
+    REQUIRE(lapStartedEmitted == 2);
+
+    drive(lapTimer, getStartFinishLinePoints(), Timestamp{"15:07:10.234"});
+    REQUIRE(lapFinishedEmitted == 2);
+    REQUIRE(lapStartedEmitted == 3);
+}
@@ -4,12 +4,80 @@
 
 #include "algorithm/SimpleLaptimer.hpp"
 #include "testhelper/Positions.hpp"
+#include "testhelper/Sessions.hpp"
+#include "testhelper/Tracks.hpp"
 #include <catch2/catch_all.hpp>
 
 using namespace Rapid::Algorithm;
 using namespace Rapid::Common;
 using namespace Rapid::TestHelper;
 
+namespace
+{
+
+/**
+ * Gives the positions of all laps of the session, the recorded positions are logged with 10 Hz.
+ */
+std::vector<GpsPositionData> getPositions(SessionData const& session)
+{
+    auto positions = std::vector<GpsPositionData>{};
+    for (auto const& lap : session.getLaps()) {
+        auto const lapPositions = lap.getTelemetry().toPositions();
+        positions.insert(positions.end(), lapPositions.cbegin(), lapPositions.cend());
+    }
+    return positions;
+}
+
+/**
+ * Upsamples the positions to 100 Hz by linear interpolation between two positions, like a receiver with a
+ * measurement rate of 10 ms would give them.
+ */
+std::vector<GpsPositionData> upsample(std::vector<GpsPositionData> const& positions)
+{
+    constexpr auto interval = std::int64_t{10};
+    auto upsampled = std::vector<GpsPositionData>{};
+    for (std::size_t index = 0; index + 1 < positions.size(); ++index) {
+        auto const& from = positions[index];
+        auto const& to = positions[index + 1];
+        auto const duration = (to.getTime() - from.getTime()).toMilliseconds();
+        for (auto offset = std::int64_t{0}; offset < duration; offset += interval) {
+            auto const ratio = static_cast<float>(offset) / static_cast<float>(duration);
+            auto const interpolate = [ratio](float start, float end) {
+                return start + (ratio * (end - start));
+            };
+            auto const position =
+                PositionData{interpolate(from.getPosition().getLatitude(), to.getPosition().getLatitude()),
+                             interpolate(from.getPosition().getLongitude(), to.getPosition().getLongitude())};
+            auto const velocity = interpolate(static_cast<float>(from.getVelocity().getVelocity()),
+                                              static_cast<float>(to.getVelocity().getVelocity()));
+            upsampled.emplace_back(position,
+                                   from.getTime() + Timestamp::fromMilliseconds(offset),
+                                   from.getDate(),
+                                   VelocityData{velocity});
+        }
+    }
+    if (!positions.empty()) {
+        upsampled.push_back(positions.back());
+    }
+    return upsampled;
+}
+
+std::vector<Timestamp> getLaptimes(std::vector<GpsPositionData> const& positions)
+{
+    auto lapTimer = SimpleLaptimer{};
+    auto laptimes = std::vector<Timestamp>{};
+    lapTimer.setTrack(Tracks::getOscherslebenGateTrack());
+    std::ignore = lapTimer.lapFinished.connect([&laptimes, &lapTimer]() {
+        laptimes.push_back(lapTimer.getLastLaptime());
+    });
+    for (auto const& position : positions) {
+        lapTimer.updatePositionAndTime(position);
+    }
+    return laptimes;
+}
+
+} // namespace
+
 TEST_CASE("The laptimer shall emit lapStarted Signal when crossing the start line for the first time. Case1")
 {
     SimpleLaptimer lapTimer;
@@ -535,3 +603,148 @@ TEST_CASE("The laptimer shall emit the signals sector and lap started finished e
     REQUIRE(lapFinishedEmitted == true);
     REQUIRE(lapStartedEmitted == true);
 }
+
+TEST_CASE("The laptimer shall wait for the start line after the finish of a point to point track.")
+{
+    SimpleLaptimer lapTimer;
+    std::uint32_t lapStartedEmitted = 0;
+    std::uint32_t lapFinishedEmitted = 0;
+
+    auto track = TrackData{};
+    track.setTopology(TrackTopology::PointToPoint);
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionSector1Line());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapStarted.connect([&lapStartedEmitted]() {
+        ++lapStartedEmitted;
+    });
+    std::ignore = lapTimer.lapFinished.connect([&lapFinishedEmitted]() {
+        ++lapFinishedEmitted;
+    });
+
+    auto const startPoints = {Positions::getOscherslebenStartFinishLine1(),
+                              Positions::getOscherslebenStartFinishLine2(),
+                              Positions::getOscherslebenStartFinishLine3(),
+                              Positions::getOscherslebenStartFinishLine4()};
+    auto const finishPoints = {Positions::getOscherslebenSector1Point1(),
+                               Positions::getOscherslebenSector1Point2(),
+                               Positions::getOscherslebenSector1Point3(),
+                               Positions::getOscherslebenSector1Point4()};
+
+    for (auto const& point : startPoints) {
+        lapTimer.updatePositionAndTime(GpsPositionData{point, Timestamp{"15:05:10.234"}, {}});
+    }
+    for (auto const& point : finishPoints) {
+        lapTimer.updatePositionAndTime(GpsPositionData{point, Timestamp{"15:06:10.234"}, {}});
+    }
+    REQUIRE(lapStartedEmitted == 1);
+    REQUIRE(lapFinishedEmitted == 1);
+
+    // Passing the finish line again doesn't finish a lap without a start.
+    for (auto const& point : finishPoints) {
+        lapTimer.updatePositionAndTime(GpsPositionData{point, Timestamp{"15:07:10.234"}, {}});
+    }
+    REQUIRE(lapStartedEmitted == 1);
+    REQUIRE(lapFinishedEmitted == 1);
+
+    for (auto const& point : startPoints) {
+        lapTimer.updatePositionAndTime(GpsPositionData{point, Timestamp{"15:08:10.234"}, {}});
+    }
+    REQUIRE(lapStartedEmitted == 2);
+}
+
+TEST_CASE("The laptimer shall finish a lap at the pit lane line of a circuit.")
+{
+    SimpleLaptimer lapTimer;
+    bool lapFinishedEmitted = false;
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setPitLaneLine(Positions::getOscherslebenPositionSector1Line());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapFinished.connect([&lapFinishedEmitted]() {
+        lapFinishedEmitted = true;
+    });
+
+    lapTimer.updatePositionAndTime(GpsPositionData{Positions::getOscherslebenStartFinishLine1(), {}, {}});
+    lapTimer.updatePositionAndTime(GpsPositionData{Positions::getOscherslebenStartFinishLine2(), {}, {}});
+    lapTimer.updatePositionAndTime(GpsPositionData{Positions::getOscherslebenStartFinishLine3(), {}, {}});
+    lapTimer.updatePositionAndTime(GpsPositionData{Positions::getOscherslebenStartFinishLine4(), {}, {}});
+
+    lapTimer.updatePositionAndTime(GpsPositionData{Positions::getOscherslebenSector1Point1(), {}, {}});
+    lapTimer.updatePositionAndTime(GpsPositionData{Positions::getOscherslebenSector1Point2(), {}, {}});
+    lapTimer.updatePositionAndTime(GpsPositionData{Positions::getOscherslebenSector1Point3(), {}, {}});
+    lapTimer.updatePositionAndTime(GpsPositionData{Positions::getOscherslebenSector1Point4(), {}, {}});
+
+    REQUIRE(lapFinishedEmitted == true);
+}
+
+TEST_CASE("The laptimer shall give the same lap times for positions with 10 Hz and 100 Hz.")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto const positions = getPositions(session);
+    auto const upsampled = upsample(positions);
+    REQUIRE(upsampled.size() > 9 * positions.size());
+
+    auto const laptimes = getLaptimes(positions);
+    auto const upsampledLaptimes = getLaptimes(upsampled);
+
+    // The recording starts right after the finish line, the first lap isn't started. The recording ends closest to
+    // the finish line, only the interpolated 100 Hz positions move away from it and finish the last lap.
+    REQUIRE(session.getNumberOfLaps() == 11);
+    REQUIRE(upsampledLaptimes.size() == 10);
+    REQUIRE(laptimes.size() == 9);
+    for (std::size_t index = 0; index < upsampledLaptimes.size(); ++index) {
+        INFO("Lap " << index);
+        auto const recordedLaptime = session.getLaps()[index + 1].getLaptime().toMilliseconds();
+        // The gate is detected with the first position after the closest one, this is earlier with 100 Hz.
+        REQUIRE(upsampledLaptimes[index].toMilliseconds() == Catch::Approx(recordedLaptime).margin(100));
+        if (index < laptimes.size()) {
+            REQUIRE(laptimes[index].toMilliseconds() == Catch::Approx(recordedLaptime).margin(100));
+        }
+    }
+}
+
+TEST_CASE("The laptimer shall emit the lap started signal for positions with 100 Hz.")
+{
+    SimpleLaptimer lapTimer;
+    bool lapStartedEmitted = false;
+
+    auto track = TrackData{};
+    track.setStartline(Positions::getOscherslebenPositionStartFinishLine());
+    lapTimer.setTrack(track);
+    std::ignore = lapTimer.lapStarted.connect([&lapStartedEmitted]() {
+        lapStartedEmitted = true;
+    });
+
+    auto const positions = upsample({
+        GpsPositionData{Positions::getOscherslebenStartFinishLine1(), Timestamp{"15:05:10.000"}, {}},
+        GpsPositionData{Positions::getOscherslebenStartFinishLine2(), Timestamp{"15:05:10.100"}, {}},
+        GpsPositionData{Positions::getOscherslebenStartFinishLine3(), Timestamp{"15:05:10.200"}, {}},
+        GpsPositionData{Positions::getOscherslebenStartFinishLine4(), Timestamp{"15:05:10.300"}, {}},
+    });
+    REQUIRE(positions.size() == 31);
+    for (auto const& position : positions) {
+        lapTimer.updatePositionAndTime(position);
+    }
+
+    REQUIRE(lapStartedEmitted == true);
+}
+
+TEST_CASE("The laptimer update", "[.benchmark]")
+{
+    auto const positions = getPositions(Sessions::getRealWorldSession());
+    auto const upsampled = upsample(positions);
+
+    // The cost per position shall be the same for both rates, the 100 Hz session has 10 times the positions.
+    BENCHMARK("Update the positions of the session with 10 Hz")
+    {
+        return getLaptimes(positions);
+    };
+
+    BENCHMARK("Update the positions of the session with 100 Hz")
+    {
+        return getLaptimes(upsampled);
+    };
+}
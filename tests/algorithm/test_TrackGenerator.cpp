@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/LapReplayEngine.hpp"
+#include "algorithm/LineCrossingLaptimer.hpp"
+#include "algorithm/TrackGenerator.hpp"
+#include "testhelper/Sessions.hpp"
+#include "testhelper/SyntheticLaps.hpp"
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <numbers>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+// NOLINTBEGIN(bugprone-unchecked-optional-access)
+
+TEST_CASE("The TrackGenerator shall create a circuit from the closed loop of a recording")
+{
+    auto const telemetry = SyntheticLaps::createCircleLaps(100.0f, 2);
+    auto const generator = TrackGenerator{3};
+
+    auto const track = generator.generate(telemetry.getView());
+
+    REQUIRE(track.has_value());
+    REQUIRE(track->lapLength == Catch::Approx(2.0f * std::numbers::pi_v<float> * 100.0f).margin(5.0f));
+    REQUIRE(track->track.getTopology() == TrackTopology::Circuit);
+    REQUIRE(track->track.getNumberOfSections() == 3);
+
+    // The sections are spaced evenly along the lap.
+    auto const& projection = track->track.getGeometry().getProjection();
+    auto const finish = projection.project(track->track.getFinishline());
+    auto previous = finish;
+    for (auto const& section : track->track.getSections()) {
+        auto const point = projection.project(section);
+        REQUIRE(length(point - previous) == Catch::Approx(std::sqrt(2.0f) * 100.0f).margin(5.0f));
+        previous = point;
+    }
+
+    // The finish gate is perpendicular to the direction of travel, the circle is driven counter clockwise.
+    auto const center = projection.project(telemetry.getPosition(0).getPosition()) + LocalPoint{.x = 0.0f, .y = 100.0f};
+    auto const radial = center - finish;
+    REQUIRE(std::abs(dot(track->finishGate.direction, radial)) < 0.05f * length(radial));
+    REQUIRE(std::abs(dot(track->finishGate.end - track->finishGate.begin, track->finishGate.direction)) < 0.01f);
+}
+
+TEST_CASE("The TrackGenerator shall give no track for a recording without closed loop")
+{
+    auto const generator = TrackGenerator{};
+
+    SECTION("Too few positions")
+    {
+        REQUIRE_FALSE(generator.generate(LapTelemetry{}.getView()).has_value());
+    }
+
+    SECTION("A loop shorter than the minimum lap length")
+    {
+        REQUIRE_FALSE(generator.generate(SyntheticLaps::createCircleLaps(20.0f, 3).getView()).has_value());
+    }
+
+    SECTION("A straight line")
+    {
+        auto const& projection = SyntheticLaps::getProjection();
+        auto telemetry = LapTelemetry{};
+        for (std::size_t index = 0; index < 2000; ++index) {
+            auto const point = LocalPoint{.x = 0.0f, .y = static_cast<float>(index)};
+            telemetry.append(GpsPositionData{projection.unproject(point), Timestamp{}, Date{}});
+        }
+        REQUIRE_FALSE(generator.generate(telemetry.getView()).has_value());
+    }
+}
+
+TEST_CASE("The TrackGenerator shall create a track on which the recorded laps are detected")
+{
+    auto const session = Sessions::getRealWorldSession();
+    REQUIRE(session.getNumberOfLaps() > 3);
+
+    auto const track = TrackGenerator{}.generate(session);
+    REQUIRE(track.has_value());
+
+    auto const laps = LapReplayEngine{track->track}.replay(session);
+    REQUIRE(laps.size() >= session.getNumberOfLaps() - 2);
+    REQUIRE(laps[0].getSectorTimes().size() == TrackGenerator::DefaultSectionCount + 1);
+
+    // The finish line moved, but the laps keep about the recorded laptimes.
+    auto const laptime = [](LapData const& lap) {
+        return lap.getLaptime().toMilliseconds();
+    };
+    auto const recordedBest = std::ranges::min(session.getLaps() | std::views::transform(laptime));
+    auto const replayedBest = std::ranges::min(laps | std::views::transform(laptime));
+    REQUIRE(std::abs(replayedBest - recordedBest) < 1000);
+}
+
+TEST_CASE("The TrackGenerator shall create a track on which the line crossing laptimer times the recorded laps")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto const track = TrackGenerator{}.generate(session);
+    REQUIRE(track.has_value());
+
+    auto lapTimer = LineCrossingLaptimer{};
+    auto lapTimes = std::vector<std::int64_t>{};
+    auto sectorsFinished = std::size_t{0};
+    lapTimer.setTrack(track->track);
+    std::ignore = lapTimer.lapFinished.connect([&lapTimes, &lapTimer]() {
+        lapTimes.push_back(lapTimer.getLastLaptime().toMilliseconds());
+    });
+    std::ignore = lapTimer.sectorFinished.connect([&sectorsFinished]() {
+        ++sectorsFinished;
+    });
+    for (auto const& lap : session.getLaps()) {
+        for (auto const& position : lap.getTelemetry().toPositions()) {
+            lapTimer.updatePositionAndTime(position);
+        }
+    }
+
+    // The first and the last recorded lap are only partly driven behind the generated finish line, the recording
+    // ends after the sections of the last lap.
+    REQUIRE(lapTimes.size() >= session.getNumberOfLaps() - 2);
+    REQUIRE(sectorsFinished == (lapTimes.size() + 1) * TrackGenerator::DefaultSectionCount);
+
+    // The finish line moved, so the single laps differ from the recorded laps, but not the total of the laps.
+    auto const total = std::accumulate(lapTimes.begin(), lapTimes.end(), std::int64_t{0});
+    auto recordedTotal = std::int64_t{0};
+    for (std::size_t index = 0; index < lapTimes.size(); ++index) {
+        recordedTotal += session.getLaps()[index + 1].getLaptime().toMilliseconds();
+    }
+    INFO("Total " << total << " recorded " << recordedTotal);
+    REQUIRE(std::abs(total - recordedTotal) < 100);
+}
+
+// NOLINTEND(bugprone-unchecked-optional-access)
+
+TEST_CASE("The TrackGenerator recording", "[.benchmark]")
+{
+    auto const telemetry = SyntheticLaps::createCircleLaps(500.0f, 30);
+    auto const generator = TrackGenerator{};
+    REQUIRE(telemetry.size() > 90000);
+
+    BENCHMARK("Generate the track of 30 laps")
+    {
+        return generator.generate(telemetry.getView());
+    };
+}
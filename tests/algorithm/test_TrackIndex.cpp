@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/TrackDetection.hpp"
+#include "algorithm/TrackIndex.hpp"
+#include "testhelper/Positions.hpp"
+#include "testhelper/Tracks.hpp"
+#include <catch2/catch_all.hpp>
+
+using namespace Rapid::Common;
+using namespace Rapid::Algorithm;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+/**
+ * Creates a grid of tracks with a finish line every 0.25 degree around the world.
+ */
+std::vector<TrackData> createTracks()
+{
+    auto tracks = std::vector<TrackData>{};
+    for (auto latitude = -80.0f; latitude <= 80.0f; latitude += 0.25f) {
+        for (auto longitude = -179.0f; longitude <= 179.0f; longitude += 8.0f) {
+            auto track = TrackData{};
+            track.setFinishline(PositionData{latitude, longitude});
+            tracks.push_back(std::move(track));
+        }
+    }
+    return tracks;
+}
+} // namespace
+
+TEST_CASE("The TrackIndex shall give the tracks near a position")
+{
+    auto tracks = createTracks();
+    tracks.push_back(Tracks::getOscherslebenTrack());
+    auto const index = TrackIndex{tracks, 500.0f};
+
+    auto const candidates = index.getCandidates(Positions::getOscherslebenPositionCamp());
+
+    REQUIRE(candidates.size() == 1);
+    REQUIRE(candidates[0] == tracks.size() - 1);
+}
+
+TEST_CASE("The TrackIndex shall give no candidates far away from all tracks")
+{
+    auto const tracks = std::vector<TrackData>{Tracks::getOscherslebenTrack()};
+    auto const index = TrackIndex{tracks, 500.0f};
+
+    REQUIRE(index.getCandidates(PositionData{48.0f, 2.0f}).empty());
+    REQUIRE(TrackIndex{}.getCandidates(Positions::getOscherslebenPositionCamp()).empty());
+}
+
+TEST_CASE("The TrackIndex shall give every track that is detected at the position as candidate")
+{
+    auto const tracks = createTracks();
+    auto const detection = TrackDetection{500};
+    auto const index = TrackIndex{tracks, detection.getDetectionRadius()};
+
+    // Positions around the finish lines, also on the borders of the grid cells.
+    auto const latitude = GENERATE(-45.0f, 0.0f, 0.1f, 52.25f, 79.75f);
+    auto const longitude = GENERATE(-179.0f, 13.0f);
+    auto const offset = GENERATE(-0.004f, -0.001f, 0.0f, 0.001f, 0.004f);
+    auto const position = PositionData{latitude + offset, longitude - offset};
+
+    auto const candidates = index.getCandidates(position);
+    for (std::uint32_t track = 0; track < tracks.size(); ++track) {
+        if (detection.isOnTrack(tracks[track], position)) {
+            INFO("Track " << track);
+            REQUIRE(std::ranges::find(candidates, track) != candidates.end());
+        }
+    }
+}
+
+TEST_CASE("The TrackIndex lookup", "[.benchmark]")
+{
+    auto const tracks = createTracks();
+    auto const index = TrackIndex{tracks, 500.0f};
+    auto const position = Positions::getOscherslebenPositionCamp();
+
+    BENCHMARK("Candidates of a position")
+    {
+        return index.getCandidates(position).size();
+    };
+}
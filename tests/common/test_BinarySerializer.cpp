@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "TestFile.hpp"
+#include <catch2/catch_all.hpp>
+#include <common/BinarySerializer.hpp>
+#include <common/BinarySessionFormat.hpp>
+#include <common/BinarySessionReader.hpp>
+#include <common/JsonDeserializer.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <testhelper/Sessions.hpp>
+
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+SessionData getSessionWithChannel()
+{
+    auto session = Sessions::getTestSession3();
+    auto laps = session.releaseLaps();
+    auto telemetry = laps[0].takeTelemetry();
+    telemetry.addChannel("throttle");
+    for (std::size_t index = 0; index < telemetry.size(); ++index) {
+        telemetry.setChannelValue("throttle", index, static_cast<float>(index) * 0.5f);
+    }
+    laps[0].setTelemetry(std::move(telemetry));
+    session.addLaps(std::move(laps));
+    return session;
+}
+
+} // namespace
+
+TEST_CASE("The BinarySerializer shall write a session that is read again by the BinarySessionReader")
+{
+    auto const session = getSessionWithChannel();
+    auto const bytes = BinarySerializer::Session::serialize(session);
+
+    auto const reader = BinarySessionReader::fromBytes(bytes);
+    REQUIRE(reader.has_value());
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    REQUIRE(reader->getVersion() == BinarySessionFormat::Version);
+    REQUIRE(reader->getMetaData() == SessionMetaData{session});
+    REQUIRE(reader->getNumberOfLaps() == session.getNumberOfLaps());
+    REQUIRE(reader->getSectorTimes(0) == session.getLaps()[0].getSectorTimes());
+    REQUIRE(reader->getChannelNames(0) == std::vector<std::string>{"throttle"});
+    REQUIRE(reader->getChannelNames(1).empty());
+    REQUIRE(reader->readSession() == session);
+    // NOLINTEND(bugprone-unchecked-optional-access)
+}
+
+TEST_CASE("The BinarySerializer shall write the topology and the pit lane line of the track")
+{
+    auto track = Sessions::getTestSession3().getTrack();
+    track.setTopology(TrackTopology::PointToPoint);
+    track.setPitLaneLine(PositionData{52.0271, 11.2804});
+    auto const session = SessionData{track, Date{"01.01.1970"}, Timestamp{"13:00:00.000"}};
+
+    auto const reader = BinarySessionReader::fromBytes(BinarySerializer::Session::serialize(session));
+    REQUIRE(reader.has_value());
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    REQUIRE(reader->getMetaData().getTrack() == track);
+
+    track.setPitLaneLine(std::nullopt);
+    auto const withoutPitLane = BinarySessionReader::fromBytes(
+        BinarySerializer::Session::serialize(SessionData{track, Date{"01.01.1970"}, Timestamp{"13:00:00.000"}}));
+    REQUIRE(withoutPitLane.has_value());
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    REQUIRE_FALSE(withoutPitLane->getMetaData().getTrack().getPitLaneLine().has_value());
+}
+
+TEST_CASE("The BinarySessionReader shall give the columns of a mapped file without copy")
+{
+    auto const session = getSessionWithChannel();
+    auto const file = std::filesystem::temp_directory_path() / "test_BinarySerializer.rsession";
+    REQUIRE(BinarySerializer::Session::serialize(session, file));
+
+    auto const reader = BinarySessionReader::open(file);
+    std::filesystem::remove(file);
+    REQUIRE(reader.has_value());
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    auto const& telemetry = session.getLaps()[0].getTelemetry();
+    auto const latitudes = reader->getLatitudes(0);
+    REQUIRE(std::ranges::equal(latitudes, telemetry.getLatitudes()));
+    REQUIRE(std::ranges::equal(reader->getLongitudes(0), telemetry.getLongitudes()));
+    REQUIRE(std::ranges::equal(reader->getVelocities(0), telemetry.getVelocities()));
+    REQUIRE(std::ranges::equal(reader->getChannel(0, "throttle"), telemetry.getChannel("throttle")));
+    REQUIRE(reader->getTimes(0) == std::vector<Timestamp>{telemetry.getTimes().begin(), telemetry.getTimes().end()});
+    REQUIRE(reader->getDates(0) == std::vector<Date>{telemetry.getDates().begin(), telemetry.getDates().end()});
+    REQUIRE(reader->getChannel(0, "brake").empty());
+    REQUIRE(reader->getLatitudes(reader->getNumberOfLaps()).empty());
+
+    // Copies share the mapping, so the spans point to the same memory.
+    auto const copy = reader.value();
+    REQUIRE(copy.getLatitudes(0).data() == latitudes.data());
+    // NOLINTEND(bugprone-unchecked-optional-access)
+}
+
+TEST_CASE("The BinarySerializer shall write the header in little endian byte order")
+{
+    auto const bytes = BinarySerializer::Session::serialize(Sessions::getTestSession3());
+    REQUIRE(bytes.size() > BinarySessionFormat::HeaderSize);
+
+    REQUIRE(bytes[4] == std::byte{BinarySessionFormat::Version & 0xFFU});
+    REQUIRE(bytes[5] == std::byte{BinarySessionFormat::Version >> 8U});
+    REQUIRE(bytes[6] == std::byte{BinarySessionFormat::HeaderSize});
+    REQUIRE(bytes[7] == std::byte{0});
+
+    auto fileSize = std::uint64_t{0};
+    for (std::size_t index = 0; index < sizeof(fileSize); ++index) {
+        fileSize |= static_cast<std::uint64_t>(bytes[16 + index]) << (8U * index);
+    }
+    REQUIRE(fileSize == bytes.size());
+}
+
+TEST_CASE("The BinarySessionReader shall reject damaged containers")
+{
+    auto bytes = BinarySerializer::Session::serialize(Sessions::getTestSession3());
+
+    SECTION("Changed content")
+    {
+        bytes[bytes.size() - 1] ^= std::byte{0x01};
+        REQUIRE_FALSE(BinarySessionReader::fromBytes(bytes).has_value());
+    }
+
+    SECTION("Changed header")
+    {
+        bytes[8] ^= std::byte{0x01};
+        REQUIRE_FALSE(BinarySessionReader::fromBytes(bytes).has_value());
+    }
+
+    SECTION("Truncated content")
+    {
+        bytes.resize(bytes.size() / 2);
+        REQUIRE_FALSE(BinarySessionReader::fromBytes(bytes).has_value());
+    }
+
+    SECTION("Unknown version")
+    {
+        bytes[4] = std::byte{0xFF};
+        REQUIRE_FALSE(BinarySessionReader::fromBytes(bytes).has_value());
+    }
+
+    SECTION("No container")
+    {
+        REQUIRE_FALSE(BinarySessionReader::fromBytes({}).has_value());
+        REQUIRE_FALSE(BinarySessionReader::open("/does/not/exist.rsession").has_value());
+    }
+}
+
+TEST_CASE("The BinarySerializer shall write a real world session smaller than the JSON session")
+{
+    auto file = std::ifstream{TEST_FILE_PATH};
+    REQUIRE(file.is_open());
+    auto buffer = std::ostringstream{};
+    buffer << file.rdbuf();
+    auto const json = buffer.str();
+    auto const session = JsonDeserializer::Session::deserialize(json);
+    REQUIRE(session.has_value());
+
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    auto const bytes = BinarySerializer::Session::serialize(session.value());
+    REQUIRE(bytes.size() * 4 < json.size());
+    REQUIRE(BinarySessionReader::fromBytes(bytes)->readSession() == session.value());
+    // NOLINTEND(bugprone-unchecked-optional-access)
+}
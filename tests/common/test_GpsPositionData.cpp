@@ -5,6 +5,7 @@
 #define CATCH_CONFIG_MAIN
 #include "common/GpsPositionData.hpp"
 #include <catch2/catch_all.hpp>
+#include <type_traits>
 
 using namespace Rapid::Common;
 
@@ -72,3 +73,24 @@ TEST_CASE("It shall be possible to compare two PositionDateTime for unequal")
 
     REQUIRE(posDateTime1 != posDateTime2);
 }
+
+TEST_CASE("The GpsPositionData and its parts shall be trivially copyable value types")
+{
+    STATIC_REQUIRE(std::is_trivially_copyable_v<PositionData>);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<Timestamp>);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<Date>);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<VelocityData>);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<GpsPositionData>);
+}
+
+TEST_CASE("The GpsPositionData shall be constructible at compile time")
+{
+    constexpr auto position = PositionData{52.0270889f, 11.2803483f};
+    constexpr auto velocity = VelocityData::createFromKmH(36.0);
+    constexpr auto gpsPosition = GpsPositionData{position, Timestamp{}, Date{}, velocity};
+
+    STATIC_REQUIRE(gpsPosition.getPosition() == position);
+    STATIC_REQUIRE(gpsPosition.getVelocity() == VelocityData{10.0});
+    STATIC_REQUIRE(gpsPosition.getTime() == Timestamp{});
+    STATIC_REQUIRE(gpsPosition.getDate() == Date{});
+}
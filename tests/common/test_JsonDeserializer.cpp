@@ -5,6 +5,7 @@
 #include "TestFile.hpp"
 #include <catch2/catch_all.hpp>
 #include <common/JsonDeserializer.hpp>
+#include <common/JsonSerializer.hpp>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -64,6 +65,21 @@ TEST_CASE("The JsonDeserializer shall deserialize a valid json string into a Tra
     REQUIRE(track.value_or(TrackData{}) == expTrack);
 }
 
+TEST_CASE("The JsonDeserializer shall deserialize the topology and the pit lane line of a track",
+          "[JSONDESERIALIZER_TRACK]")
+{
+    auto expTrack = Tracks::getTrack();
+    expTrack.setTopology(TrackTopology::PointToPoint);
+    expTrack.setPitLaneLine(PositionData{52.0258333f, 11.279166666f});
+    auto track = JsonDeserializer::Track::deserialize(JsonSerializer::Track::serialize(expTrack));
+    REQUIRE(track.has_value());
+    REQUIRE(track.value_or(TrackData{}) == expTrack);
+
+    auto const circuit = JsonDeserializer::Track::deserialize(Tracks::getTrackAsJson());
+    REQUIRE(circuit.value_or(TrackData{}).getTopology() == TrackTopology::Circuit);
+    REQUIRE_FALSE(circuit.value_or(TrackData{}).getPitLaneLine().has_value());
+}
+
 TEST_CASE("The JsonDeserializer shall deserialize a valid json string into a TrackData",
           "[JSONDESERIALIZER][GPSPOSITION]")
 {
@@ -77,3 +77,43 @@ TEST_CASE("The LapData shall store the position and time data for that lap.")
         REQUIRE(positions == std::vector<GpsPositionData>{expPos1, expPos2});
     }
 }
+
+TEST_CASE("The LapData shall take over the buffers of moved sector times and log points")
+{
+    auto const position = GpsPositionData{PositionData{0.12, 0.13}, Timestamp{"00:12:33.123"}, Date{"01.01.1970"}};
+    auto sectorTimes = std::vector<Timestamp>{Timestamp{"00:00:21.000"}, Timestamp{"00:00:22.000"}};
+    auto telemetry = LapTelemetry::fromPositions(std::vector<GpsPositionData>{position, position});
+    auto const* sectorTimesBuffer = sectorTimes.data();
+    auto const* latitudeBuffer = telemetry.getLatitudes().data();
+
+    auto const lap = LapData{std::move(sectorTimes), std::move(telemetry)};
+
+    REQUIRE(lap.getSectorTimes().data() == sectorTimesBuffer);
+    REQUIRE(lap.getTelemetry().getLatitudes().data() == latitudeBuffer);
+    REQUIRE(lap.getLaptime() == Timestamp{"00:00:43.000"});
+}
+
+TEST_CASE("The LapData shall give the log points to the caller when they are taken")
+{
+    auto const position = GpsPositionData{PositionData{0.12, 0.13}, Timestamp{"00:12:33.123"}, Date{"01.01.1970"}};
+    auto lap = LapData{Timestamp{"00:00:45.112"}};
+    lap.setTelemetry(LapTelemetry::fromPositions(std::vector<GpsPositionData>{position}));
+
+    SECTION("Take the log points of an unshared lap")
+    {
+        auto const* latitudeBuffer = lap.getTelemetry().getLatitudes().data();
+        auto const telemetry = lap.takeTelemetry();
+        REQUIRE(telemetry.getLatitudes().data() == latitudeBuffer);
+        REQUIRE(lap.getTelemetry().empty());
+        REQUIRE(lap.getLaptime() == Timestamp{"00:00:45.112"});
+    }
+
+    SECTION("Take the log points of a shared lap")
+    {
+        auto const copy = lap;
+        REQUIRE(lap.takePositions() == std::vector<GpsPositionData>{position});
+        REQUIRE(lap.getTelemetry().empty());
+        REQUIRE(lap.getLaptime() == Timestamp{"00:00:45.112"});
+        REQUIRE(copy.getPositions() == std::vector<GpsPositionData>{position});
+    }
+}
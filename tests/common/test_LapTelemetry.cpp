@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/LapData.hpp"
+#include "common/LapTelemetry.hpp"
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace Rapid::Common;
+
+namespace
+{
+GpsPositionData createPosition(std::size_t index)
+{
+    auto const offset = static_cast<float>(index) * 0.001f;
+    return GpsPositionData{PositionData{52.0f + offset, 11.0f + offset},
+                           Timestamp::fromMilliseconds(static_cast<std::int64_t>(index) * 40),
+                           Date{"01.01.1970"},
+                           VelocityData{static_cast<double>(index)}};
+}
+
+LapTelemetry createTelemetry(std::size_t count)
+{
+    auto telemetry = LapTelemetry{};
+    telemetry.reserve(count);
+    for (std::size_t index = 0; index < count; ++index) {
+        telemetry.append(createPosition(index));
+    }
+    return telemetry;
+}
+} // namespace
+
+TEST_CASE("The LapTelemetry shall store the log points column wise", "[LAPTELEMETRY]")
+{
+    auto const telemetry = createTelemetry(3);
+
+    REQUIRE(telemetry.size() == 3);
+    REQUIRE_FALSE(telemetry.empty());
+    REQUIRE(telemetry.getLatitudes().size() == 3);
+    REQUIRE(telemetry.getLongitudes().size() == 3);
+    REQUIRE(telemetry.getVelocities().size() == 3);
+    REQUIRE(telemetry.getTimes().size() == 3);
+    REQUIRE(telemetry.getDates().size() == 3);
+    REQUIRE(telemetry.getVelocities()[2] == 2.0);
+    REQUIRE(telemetry.getTimes()[1] == Timestamp::fromMilliseconds(40));
+    REQUIRE(telemetry.getPosition(1) == createPosition(1));
+    REQUIRE(telemetry.toPositions() ==
+            std::vector<GpsPositionData>{createPosition(0), createPosition(1), createPosition(2)});
+}
+
+TEST_CASE("The LapTelemetry shall not reallocate the columns when appending within the reserved capacity",
+          "[LAPTELEMETRY]")
+{
+    auto telemetry = LapTelemetry{};
+    telemetry.reserve(100);
+    telemetry.append(createPosition(0));
+    auto const* const latitudes = telemetry.getLatitudes().data();
+    auto const* const times = telemetry.getTimes().data();
+
+    for (std::size_t index = 1; index < 100; ++index) {
+        telemetry.append(createPosition(index));
+    }
+
+    REQUIRE(telemetry.getLatitudes().data() == latitudes);
+    REQUIRE(telemetry.getTimes().data() == times);
+}
+
+TEST_CASE("The LapTelemetry shall support additional channels", "[LAPTELEMETRY]")
+{
+    auto telemetry = createTelemetry(2);
+
+    REQUIRE(telemetry.addChannel("lean"));
+    REQUIRE_FALSE(telemetry.addChannel("lean"));
+    REQUIRE(telemetry.hasChannel("lean"));
+    REQUIRE_FALSE(telemetry.hasChannel("heading"));
+    REQUIRE(telemetry.getChannel("heading").empty());
+    REQUIRE(telemetry.getChannelNames() == std::vector<std::string>{"lean"});
+
+    telemetry.append(createPosition(2));
+    REQUIRE(telemetry.setChannelValue("lean", 2, 42.0f));
+    REQUIRE_FALSE(telemetry.setChannelValue("lean", 3, 42.0f));
+    REQUIRE_FALSE(telemetry.setChannelValue("heading", 0, 42.0f));
+
+    auto const& constTelemetry = telemetry;
+    REQUIRE(constTelemetry.getChannel("lean").size() == 3);
+    REQUIRE(constTelemetry.getChannel("lean")[0] == 0.0f);
+    REQUIRE(constTelemetry.getChannel("lean")[2] == 42.0f);
+
+    auto const values = std::vector<float>{1.0f, 2.0f, 3.0f};
+    REQUIRE(telemetry.setChannel("lean", values));
+    REQUIRE(std::ranges::equal(telemetry.getChannel("lean"), values));
+    REQUIRE_FALSE(telemetry.setChannel("lean", std::span{values}.first(2)));
+    REQUIRE_FALSE(telemetry.setChannel("heading", values));
+}
+
+TEST_CASE("The LapTelemetry shall give views on a range of log points without copying", "[LAPTELEMETRY]")
+{
+    auto telemetry = createTelemetry(10);
+    telemetry.addChannel("lean");
+
+    auto const slice = telemetry.slice(2, 3);
+    REQUIRE(slice.size() == 3);
+    REQUIRE(slice.getLatitudes().data() == telemetry.getLatitudes().data() + 2);
+    REQUIRE(slice.getTimes().data() == telemetry.getTimes().data() + 2);
+    REQUIRE(slice.getChannel("lean").data() == telemetry.getChannel("lean").data() + 2);
+    REQUIRE(slice.getPosition(0) == createPosition(2));
+
+    auto const subSlice = slice.slice(1, 10);
+    REQUIRE(subSlice.size() == 2);
+    REQUIRE(subSlice.getPosition(0) == createPosition(3));
+
+    REQUIRE(telemetry.slice(20, 5).empty());
+    REQUIRE(telemetry.slice(8, 5).size() == 2);
+}
+
+TEST_CASE("The LapTelemetry shall get a new revision on every modification", "[LAPTELEMETRY]")
+{
+    auto telemetry = createTelemetry(3);
+    auto revision = telemetry.getRevision();
+    auto const requireNewRevision = [&] {
+        REQUIRE(telemetry.getRevision() != revision);
+        revision = telemetry.getRevision();
+    };
+
+    auto copy = telemetry;
+    REQUIRE(copy.getRevision() == revision);
+    REQUIRE(createTelemetry(3).getRevision() != revision);
+
+    telemetry.append(createPosition(3));
+    requireNewRevision();
+    telemetry.addChannel("lean");
+    requireNewRevision();
+    telemetry.setChannelValue("lean", 0, 1.0f);
+    requireNewRevision();
+    telemetry.setChannel("lean", std::vector<float>(telemetry.size(), 2.0f));
+    requireNewRevision();
+    std::ignore = telemetry.getChannel("lean");
+    REQUIRE(telemetry.getRevision() == revision);
+    telemetry.clear();
+    requireNewRevision();
+
+    auto const copyRevision = copy.getRevision();
+    auto const moved = std::move(copy);
+    REQUIRE(moved.getRevision() == copyRevision);
+    REQUIRE(copy.getRevision() != copyRevision); // NOLINT(bugprone-use-after-move)
+}
+
+TEST_CASE("The LapData shall store the log points as LapTelemetry", "[LAPTELEMETRY]")
+{
+    auto const telemetry = createTelemetry(4);
+    auto lap = LapData{};
+    lap.setTelemetry(telemetry);
+
+    REQUIRE(lap.getTelemetry() == telemetry);
+    REQUIRE(lap.getPositions() == telemetry.toPositions());
+
+    lap.addPosition(createPosition(4));
+    REQUIRE(lap.getTelemetry().size() == 5);
+    REQUIRE(lap.getTelemetry() != telemetry);
+}
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_all.hpp>
+#include <common/BinarySerializer.hpp>
+#include <common/BinarySessionReader.hpp>
+#include <common/JsonDeserializer.hpp>
+#include <common/LapTelemetry.hpp>
+#include <common/SessionArena.hpp>
+#include <testhelper/Sessions.hpp>
+
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+LapTelemetry createTelemetry(std::shared_ptr<std::pmr::memory_resource> resource, std::size_t count)
+{
+    auto telemetry = LapTelemetry{std::move(resource)};
+    telemetry.reserve(count);
+    for (std::size_t index = 0; index < count; ++index) {
+        telemetry.append(GpsPositionData{PositionData{52.0f, 11.0f},
+                                         Timestamp::fromMilliseconds(static_cast<std::int64_t>(index) * 40),
+                                         Date{"01.01.1970"},
+                                         VelocityData{static_cast<double>(index)}});
+    }
+    return telemetry;
+}
+} // namespace
+
+TEST_CASE("The LapTelemetry shall allocate the log points from the given memory resource")
+{
+    auto const arena = SessionArena::create();
+    auto const telemetry = createTelemetry(arena, 100);
+
+    REQUIRE(telemetry.getMemoryResource() == arena.get());
+    REQUIRE(arena->getAllocatedBytes() >= 100 * (sizeof(float) * 2 + sizeof(double)));
+    REQUIRE(LapTelemetry{}.getMemoryResource() == std::pmr::get_default_resource());
+    REQUIRE(LapTelemetry{nullptr}.getMemoryResource() == std::pmr::get_default_resource());
+}
+
+TEST_CASE("The LapTelemetry shall allocate a channel from the memory resource of the telemetry")
+{
+    auto const arena = SessionArena::create();
+    auto telemetry = createTelemetry(arena, 10);
+    auto const allocatedBytes = arena->getAllocatedBytes();
+
+    telemetry.addChannel("throttle");
+
+    REQUIRE(arena->getAllocatedBytes() >= allocatedBytes + 10 * sizeof(float));
+}
+
+TEST_CASE("The LapTelemetry shall copy the log points into the default memory resource")
+{
+    auto const arena = SessionArena::create();
+    auto const telemetry = createTelemetry(arena, 10);
+
+    auto const copy = telemetry;
+
+    REQUIRE(copy == telemetry);
+    REQUIRE(copy.getMemoryResource() == std::pmr::get_default_resource());
+}
+
+TEST_CASE("The LapTelemetry shall take over the memory resource on move")
+{
+    auto const arena = SessionArena::create();
+    auto telemetry = createTelemetry(arena, 10);
+    auto const* latitudes = telemetry.getLatitudes().data();
+
+    SECTION("Move construction")
+    {
+        auto const moved = LapTelemetry{std::move(telemetry)};
+        REQUIRE(moved.getMemoryResource() == arena.get());
+        REQUIRE(moved.getLatitudes().data() == latitudes);
+    }
+
+    SECTION("Move assignment")
+    {
+        auto moved = LapTelemetry{};
+        moved = std::move(telemetry);
+        REQUIRE(moved.getMemoryResource() == arena.get());
+        REQUIRE(moved.getLatitudes().data() == latitudes);
+    }
+}
+
+TEST_CASE("The LapTelemetry shall put a moved from telemetry on the default memory resource")
+{
+    auto arena = SessionArena::create();
+    auto telemetry = createTelemetry(arena, 10);
+    telemetry.addChannel("lean");
+    arena.reset();
+
+    SECTION("Move construction")
+    {
+        std::ignore = LapTelemetry{std::move(telemetry)};
+    }
+
+    SECTION("Move assignment")
+    {
+        auto moved = LapTelemetry{};
+        moved = std::move(telemetry);
+    }
+
+    // The arena is released with the moved telemetry, the moved from telemetry can be used again.
+    // NOLINTBEGIN(bugprone-use-after-move)
+    REQUIRE(telemetry.getMemoryResource() == std::pmr::get_default_resource());
+    REQUIRE(telemetry.empty());
+    REQUIRE(telemetry.getChannelNames().empty());
+    telemetry.append(GpsPositionData{});
+    REQUIRE(telemetry.size() == 1);
+    // NOLINTEND(bugprone-use-after-move)
+}
+
+TEST_CASE("The LapTelemetry shall keep the arena alive")
+{
+    auto arena = SessionArena::create();
+    auto const weakArena = std::weak_ptr<SessionArena>{arena};
+    auto telemetry = createTelemetry(arena, 10);
+    arena.reset();
+
+    REQUIRE_FALSE(weakArena.expired());
+    REQUIRE(telemetry.getVelocities()[9] == 9.0);
+
+    telemetry = LapTelemetry{};
+    REQUIRE(weakArena.expired());
+}
+
+TEST_CASE("The JsonDeserializer shall allocate all log points of a session from the given memory resource")
+{
+    auto const arena = SessionArena::create();
+    auto const session = JsonDeserializer::Session::deserialize(Sessions::getTestSessionAsJson(), arena);
+
+    REQUIRE(session.has_value());
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    REQUIRE(session.value() == Sessions::getTestSession());
+    for (auto const& lap : session->getLaps()) {
+        REQUIRE(lap.getTelemetry().getMemoryResource() == arena.get());
+    }
+    // NOLINTEND(bugprone-unchecked-optional-access)
+}
+
+TEST_CASE("The BinarySessionReader shall read all laps of a session into one memory resource")
+{
+    auto const expectedSession = Sessions::getTestSession3();
+    auto const reader = BinarySessionReader::fromBytes(BinarySerializer::Session::serialize(expectedSession));
+    REQUIRE(reader.has_value());
+
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    auto const session = reader->readSession();
+    REQUIRE(session.has_value());
+    REQUIRE(session.value() == expectedSession);
+    auto const& laps = session->getLaps();
+    REQUIRE(laps.size() > 1);
+    auto const* resource = laps[0].getTelemetry().getMemoryResource();
+    REQUIRE(resource != std::pmr::get_default_resource());
+    for (auto const& lap : laps) {
+        REQUIRE(lap.getTelemetry().getMemoryResource() == resource);
+    }
+    // NOLINTEND(bugprone-unchecked-optional-access)
+}
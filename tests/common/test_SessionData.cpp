@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/SessionData.hpp"
+#include <catch2/catch_all.hpp>
+#include <testhelper/Sessions.hpp>
+
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+TEST_CASE("The SessionData shall move added laps into the session")
+{
+    auto const reference = Sessions::getTestSession3();
+    auto session = SessionData{reference.getTrack(), reference.getSessionDate(), reference.getSessionTime()};
+    auto lap = reference.getLaps()[0];
+    lap.addSectorTime(Timestamp{"00:00:01.000"});
+    auto const* telemetry = &lap.getTelemetry();
+
+    session.addLap(std::move(lap));
+
+    REQUIRE(session.getNumberOfLaps() == 1);
+    REQUIRE(&session.getLaps()[0].getTelemetry() == telemetry);
+}
+
+TEST_CASE("The SessionData shall take over a list of laps without copy")
+{
+    auto const reference = Sessions::getTestSession3();
+    auto laps = reference.getLaps();
+    auto const* lapBuffer = laps.data();
+
+    SECTION("Create the session with the laps")
+    {
+        auto const session = SessionData{reference, std::move(laps)};
+        REQUIRE(session.getLaps().data() == lapBuffer);
+        REQUIRE(session == reference);
+    }
+
+    SECTION("Add the laps to an empty session")
+    {
+        auto session = SessionData{reference.getTrack(), reference.getSessionDate(), reference.getSessionTime()};
+        session.addLaps(std::move(laps));
+        REQUIRE(session.getLaps().data() == lapBuffer);
+        REQUIRE(session == reference);
+    }
+}
+
+TEST_CASE("The SessionData shall give the laps to the caller when they are released")
+{
+    auto session = Sessions::getTestSession3();
+    auto const expectedLaps = session.getLaps();
+
+    SECTION("Release the laps of an unshared session")
+    {
+        auto const* lapBuffer = session.getLaps().data();
+        auto const laps = session.releaseLaps();
+        REQUIRE(laps.data() == lapBuffer);
+        REQUIRE(laps == expectedLaps);
+        REQUIRE(session.getNumberOfLaps() == 0);
+    }
+
+    SECTION("Release the laps of a shared session")
+    {
+        auto const copy = session;
+        REQUIRE(session.releaseLaps() == expectedLaps);
+        REQUIRE(session.getNumberOfLaps() == 0);
+        REQUIRE(copy.getLaps() == expectedLaps);
+    }
+}
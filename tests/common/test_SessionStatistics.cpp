@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_all.hpp>
+#include <common/SessionStatistics.hpp>
+#include <testhelper/Tracks.hpp>
+
+using namespace Rapid::Common;
+
+TEST_CASE("The SessionStatistics shall give no lap statistics without laps")
+{
+    auto const statistics = SessionStatistics{};
+
+    REQUIRE(statistics.getLapCount() == 0);
+    REQUIRE_FALSE(statistics.getBestLaptime().has_value());
+    REQUIRE_FALSE(statistics.getBestLapIndex().has_value());
+    REQUIRE_FALSE(statistics.getTheoreticalBestLaptime().has_value());
+    REQUIRE_FALSE(statistics.getAverageLaptime().has_value());
+    REQUIRE_FALSE(statistics.getRollingAverageLaptime().has_value());
+    REQUIRE_FALSE(statistics.getLaptimeStandardDeviation().has_value());
+    REQUIRE_FALSE(statistics.isLastLapPersonalBest());
+    REQUIRE(statistics.getBestSectorTimes().empty());
+}
+
+TEST_CASE("The SessionStatistics shall aggregate the lap and sector times")
+{
+    auto statistics = SessionStatistics{2};
+
+    statistics.addLap(LapData{{Timestamp{"00:00:30.000"}, Timestamp{"00:00:32.000"}, Timestamp{"00:00:31.000"}}});
+    REQUIRE(statistics.isLastLapPersonalBest());
+    REQUIRE(statistics.isLastSectorPersonalBest(0));
+    REQUIRE(statistics.isLastSectorPersonalBest(2));
+
+    statistics.addLap(LapData{{Timestamp{"00:00:29.000"}, Timestamp{"00:00:33.000"}, Timestamp{"00:00:31.500"}}});
+    REQUIRE_FALSE(statistics.isLastLapPersonalBest());
+    REQUIRE(statistics.isLastSectorPersonalBest(0));
+    REQUIRE_FALSE(statistics.isLastSectorPersonalBest(1));
+    REQUIRE_FALSE(statistics.isLastSectorPersonalBest(3));
+
+    statistics.addLap(LapData{{Timestamp{"00:00:30.500"}, Timestamp{"00:00:31.000"}, Timestamp{"00:00:30.500"}}});
+    REQUIRE(statistics.isLastLapPersonalBest());
+    REQUIRE_FALSE(statistics.isLastSectorPersonalBest(0));
+    REQUIRE(statistics.isLastSectorPersonalBest(1));
+
+    // A lap without sector times isn't counted.
+    statistics.addLap(LapData{});
+
+    // The laptimes are 93.000, 93.500 and 92.000 seconds.
+    REQUIRE(statistics.getLapCount() == 3);
+    REQUIRE(statistics.getBestLaptime() == Timestamp{"00:01:32.000"});
+    REQUIRE(statistics.getBestLapIndex() == 2);
+    REQUIRE(statistics.getBestSectorTimes().size() == 3);
+    REQUIRE(statistics.getBestSectorTimes()[0] == Timestamp{"00:00:29.000"});
+    REQUIRE(statistics.getTheoreticalBestLaptime() == Timestamp{"00:01:30.500"});
+    REQUIRE(statistics.getAverageLaptime() == Timestamp{"00:01:32.833"});
+    REQUIRE(statistics.getRollingAverageLaptime() == Timestamp{"00:01:32.750"});
+    REQUIRE(statistics.getLaptimeStandardDeviation() == Timestamp{"00:00:00.764"});
+}
+
+TEST_CASE("The SessionStatistics shall calculate the statistics of a stored session")
+{
+    auto session = SessionData{Rapid::TestHelper::Tracks::getOscherslebenTrack(), Date{}, Timestamp{}};
+    auto expected = SessionStatistics{};
+    for (auto const& laptime : {"00:01:31.000", "00:01:30.000", "00:01:32.000"}) {
+        auto const lap = LapData{{Timestamp{laptime}}};
+        session.addLap(lap);
+        expected.addLap(lap);
+    }
+
+    auto const statistics = SessionStatistics::fromSession(session);
+
+    REQUIRE(statistics == expected);
+    REQUIRE(statistics.getBestLapIndex() == 1);
+    REQUIRE(statistics.getRollingAverageLaptime() == Timestamp{"00:01:31.000"});
+    REQUIRE(statistics.getLaptimeStandardDeviation() == Timestamp{"00:00:01.000"});
+}
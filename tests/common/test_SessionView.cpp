@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/SessionView.hpp"
+#include <catch2/catch_all.hpp>
+#include <testhelper/Sessions.hpp>
+
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+TEST_CASE("The SessionView shall give the lap times without loading the telemetry")
+{
+    auto const session = Sessions::getTestSession3();
+    auto loadCount = std::size_t{0};
+    auto const view = SessionView{session, session.getLaps(), [&](std::size_t) -> std::optional<LapTelemetry> {
+                                      ++loadCount;
+                                      return std::nullopt;
+                                  }};
+
+    REQUIRE(view.getNumberOfLaps() == session.getNumberOfLaps());
+    REQUIRE(view.getLap(0)->getLaptime() == session.getLaps()[0].getLaptime());
+    REQUIRE(view.getLap(0)->getSectorTimes() == session.getLaps()[0].getSectorTimes());
+    REQUIRE(view.getLap(0)->getTelemetry().empty());
+    REQUIRE_FALSE(view.getLap(view.getNumberOfLaps()).has_value());
+    REQUIRE(view.getTrack() == session.getTrack());
+    REQUIRE(loadCount == 0);
+}
+
+TEST_CASE("The SessionView shall load the telemetry of a lap once and share it with copies")
+{
+    auto const session = Sessions::getTestSession3();
+    auto loadCount = std::size_t{0};
+    auto const view =
+        SessionView{session, session.getLaps(), [&](std::size_t lapIndex) -> std::optional<LapTelemetry> {
+                        ++loadCount;
+                        return session.getLaps()[lapIndex].getTelemetry();
+                    }};
+    auto const copy = view;
+
+    REQUIRE_FALSE(view.isTelemetryLoaded(0));
+    auto const telemetry = view.getTelemetry(0);
+    REQUIRE(telemetry != nullptr);
+    REQUIRE(*telemetry == session.getLaps()[0].getTelemetry());
+    REQUIRE(loadCount == 1);
+
+    REQUIRE(copy.isTelemetryLoaded(0));
+    REQUIRE(copy.getTelemetry(0) == telemetry);
+    REQUIRE_FALSE(copy.isTelemetryLoaded(1));
+    REQUIRE(loadCount == 1);
+
+    REQUIRE(view.getTelemetry(view.getNumberOfLaps()) == nullptr);
+    REQUIRE(loadCount == 1);
+}
+
+TEST_CASE("The SessionView shall not cache telemetry that failed to load")
+{
+    auto const session = Sessions::getTestSession3();
+    auto loadCount = std::size_t{0};
+    auto const view = SessionView{session, session.getLaps(), [&](std::size_t) -> std::optional<LapTelemetry> {
+                                      ++loadCount;
+                                      return std::nullopt;
+                                  }};
+
+    REQUIRE(view.getTelemetry(0) == nullptr);
+    REQUIRE_FALSE(view.loadLap(0).has_value());
+    REQUIRE_FALSE(view.toSessionData().has_value());
+    REQUIRE_FALSE(view.isTelemetryLoaded(0));
+    REQUIRE(loadCount == 3);
+}
+
+TEST_CASE("The SessionView shall create the complete session of a loaded session")
+{
+    auto const session = Sessions::getTestSession3();
+    auto const view = SessionView::fromSession(session);
+
+    REQUIRE(view.loadLap(1) == session.getLaps()[1]);
+    REQUIRE(view.toSessionData() == session);
+    REQUIRE(SessionView{}.getNumberOfLaps() == 0);
+}
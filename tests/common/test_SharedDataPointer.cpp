@@ -6,6 +6,7 @@
 #include "common/SharedDataPointer.hpp"
 #include <catch2/catch_all.hpp>
 #include <cstdint>
+#include <vector>
 
 using namespace Rapid::Common;
 
@@ -51,6 +52,7 @@ public:
     bool* dtorCalledFlag{nullptr};
     std::uint8_t dummyInt{0};
 };
+
 } // namespace
 
 TEST_CASE("SharedDataPointer shall free stored data on destruction when reference count is 0")
@@ -181,3 +183,30 @@ TEST_CASE("SharedDataPointer shall be able to check of unequal a different Share
 
     REQUIRE(pointer != pointer2);
 }
+
+TEST_CASE("SharedDataPointer shall not wrap the reference counter with more than 255 copies.")
+{
+    auto dtorFlag = false;
+    auto* testData = new TestData{&dtorFlag}; // NOLINT(cppcoreguidelines-owning-memory)
+    auto const pointer = SharedDataPointer<TestData>{testData};
+    {
+        auto copies = std::vector<SharedDataPointer<TestData>>(300, pointer);
+        REQUIRE(pointer.getRefCount() == 301);
+    }
+
+    REQUIRE(pointer.getRefCount() == 1);
+    REQUIRE(dtorFlag == false);
+}
+
+TEST_CASE("SharedDataPointer shall give constant access with constData without detach.")
+{
+    auto testData = new TestData{}; // NOLINT(cppcoreguidelines-owning-memory)
+    auto pointer = SharedDataPointer<TestData>{testData};
+    auto pointer2 = SharedDataPointer<TestData>{pointer};
+
+    TestData const* immutablePtr = pointer.constData();
+
+    REQUIRE(immutablePtr == testData);
+    REQUIRE(pointer.getRefCount() == 2);
+    REQUIRE(pointer2.getRefCount() == 2);
+}
@@ -4,7 +4,9 @@
 
 #define CATCH_CONFIG_MAIN
 #include "common/Timestamp.hpp"
+#include <array>
 #include <catch2/catch_all.hpp>
+#include <string_view>
 
 using namespace Rapid::Common;
 
@@ -195,3 +197,59 @@ TEST_CASE("The time shall support the greater than operator")
         REQUIRE_FALSE(ts1 > ts2);
     }
 }
+
+TEST_CASE("The Timestamp shall give the elapsed time when the subtraction passes midnight.")
+{
+    Timestamp ts1{"23:59:59.500"};
+    Timestamp ts2{"00:00:01.250"};
+
+    REQUIRE((ts2 - ts1) == Timestamp{"00:00:01.750"});
+}
+
+TEST_CASE("The Timestamp shall be constructible at compile time")
+{
+    constexpr auto zero = Timestamp{};
+    constexpr auto ts = Timestamp{1, 48, 55, 500};
+
+    STATIC_REQUIRE(zero.toMilliseconds() == 0);
+    STATIC_REQUIRE(ts.toMilliseconds() == 6'535'500);
+    STATIC_REQUIRE(ts == Timestamp::fromMilliseconds(6'535'500));
+    STATIC_REQUIRE(Timestamp{std::chrono::seconds{57}} == Timestamp{0, 0, 57});
+    STATIC_REQUIRE(ts.getHour() == 1);
+    STATIC_REQUIRE(ts.getMinute() == 48);
+    STATIC_REQUIRE(ts.getSecond() == 55);
+    STATIC_REQUIRE(ts.getFractionalOfSecond() == 500);
+}
+
+TEST_CASE("The Timestamp shall write the time into a caller provided buffer")
+{
+    auto const ts = Timestamp{13, 5, 7, 42};
+
+    SECTION("The buffer is big enough")
+    {
+        auto buffer = std::array<char, Timestamp::StringLength>{};
+        auto const result = ts.toChars(buffer.data(), buffer.data() + buffer.size());
+
+        REQUIRE(result.ec == std::errc{});
+        REQUIRE(std::string_view(buffer.data(), result.ptr) == "13:05:07.042");
+    }
+
+    SECTION("The buffer is too small")
+    {
+        auto buffer = std::array<char, Timestamp::StringLength - 1>{};
+        auto const result = ts.toChars(buffer.data(), buffer.data() + buffer.size());
+
+        REQUIRE(result.ec == std::errc::value_too_large);
+    }
+}
+
+TEST_CASE("The Timestamp shall reject strings with an invalid format")
+{
+    REQUIRE_FALSE(Timestamp::fromString("").has_value());
+    REQUIRE_FALSE(Timestamp::fromString("01:02").has_value());
+    REQUIRE_FALSE(Timestamp::fromString("01:02:03").has_value());
+    REQUIRE_FALSE(Timestamp::fromString("01:02:03.").has_value());
+    REQUIRE_FALSE(Timestamp::fromString("aa:02:03.000").has_value());
+    REQUIRE_FALSE(Timestamp::fromString("01:02:03.1234").has_value());
+    REQUIRE(Timestamp::fromString("01:02:03.5") == Timestamp{1, 2, 3, 500});
+}
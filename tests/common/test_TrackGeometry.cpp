@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/TrackData.hpp"
+#include "common/TrackGeometry.hpp"
+#include <catch2/catch_all.hpp>
+#include <testhelper/Tracks.hpp>
+
+using namespace Rapid::Common;
+
+namespace
+{
+
+TrackData getSquareTrack()
+{
+    // Finish line in the south west, the track is driven counter clockwise.
+    auto track = TrackData{};
+    track.setTrackName("Square");
+    track.setFinishline(PositionData{52.0f, 11.0f});
+    track.setSections({PositionData{52.0f, 11.01f}, PositionData{52.01f, 11.01f}, PositionData{52.01f, 11.0f}});
+    return track;
+}
+
+} // namespace
+
+TEST_CASE("The LocalProjection shall project positions in meter around the origin")
+{
+    auto const projection = LocalProjection{PositionData{52.0f, 11.0f}};
+
+    auto const origin = projection.project(PositionData{52.0f, 11.0f});
+    REQUIRE(origin.x == Catch::Approx(0.0f));
+    REQUIRE(origin.y == Catch::Approx(0.0f));
+
+    auto const north = projection.project(PositionData{52.01f, 11.0f});
+    REQUIRE(north.x == Catch::Approx(0.0f));
+    REQUIRE(north.y == Catch::Approx(1113.0f).margin(1.0f));
+
+    auto const east = projection.project(PositionData{52.0f, 11.01f});
+    REQUIRE(east.x == Catch::Approx(685.2f).margin(1.0f));
+    REQUIRE(east.y == Catch::Approx(0.0f));
+
+    REQUIRE(projection.unproject(north) == PositionData{52.01f, 11.0f});
+}
+
+TEST_CASE("The TrackGeometry shall create the gates without direction of travel")
+{
+    auto const track = getSquareTrack();
+    auto const& geometry = track.getGeometry();
+
+    REQUIRE_FALSE(geometry.hasStartGate());
+    REQUIRE(geometry.getSectionGates().size() == 3);
+
+    // The direction isn't known before the gate is driven through.
+    auto const& finish = geometry.getFinishGate();
+    REQUIRE(finish.center == LocalPoint{});
+    REQUIRE_FALSE(finish.hasDirection());
+    REQUIRE(finish.halfWidth == TrackGeometry::DefaultGateHalfWidth);
+    REQUIRE(&geometry.getStartGate() == &finish);
+    for (auto const& gate : geometry.getSectionGates()) {
+        REQUIRE_FALSE(gate.hasDirection());
+    }
+}
+
+TEST_CASE("The Gate shall place the segment perpendicular to the direction of travel")
+{
+    auto gate = getSquareTrack().getGeometry().getFinishGate();
+    gate.setDirection(LocalPoint{.x = 3.0f, .y = -3.0f});
+
+    REQUIRE(gate.hasDirection());
+    REQUIRE(length(gate.direction) == Catch::Approx(1.0f));
+    REQUIRE(gate.direction.x > 0.0f);
+    REQUIRE(gate.direction.y < 0.0f);
+    REQUIRE(length(gate.end - gate.begin) == Catch::Approx(2 * TrackGeometry::DefaultGateHalfWidth));
+    REQUIRE(dot(gate.end - gate.begin, gate.direction) == Catch::Approx(0.0f).margin(0.001f));
+
+    // A standing vehicle has no heading.
+    auto const direction = gate.direction;
+    gate.setDirection(LocalPoint{});
+    REQUIRE(gate.direction == direction);
+}
+
+TEST_CASE("The Gate shall give the fraction of a movement that crosses the gate")
+{
+    auto gate = getSquareTrack().getGeometry().getSectionGates()[0];
+    gate.setDirection(LocalPoint{.x = 0.0f, .y = 1.0f});
+
+    auto const before = gate.center - gate.direction * 10.0f;
+    auto const after = gate.center + gate.direction * 30.0f;
+    auto const fraction = gate.crossing(before, after);
+    REQUIRE(fraction.has_value());
+    REQUIRE(fraction.value() == Catch::Approx(0.25f));
+
+    auto const farAway = gate.center + gate.direction * 100.0f;
+    REQUIRE_FALSE(gate.crossing(after, farAway).has_value());
+
+    auto const besideGate = LocalPoint{.x = -gate.direction.y, .y = gate.direction.x} * 100.0f;
+    REQUIRE_FALSE(gate.crossing(before + besideGate, after + besideGate).has_value());
+}
+
+TEST_CASE("The TrackGeometry shall contain all gates in the bounding box")
+{
+    auto const track = getSquareTrack();
+    auto const& geometry = track.getGeometry();
+    auto const& box = geometry.getBoundingBox();
+
+    // The segments can take any direction, so the box contains the half width around every gate.
+    auto const halfWidth = TrackGeometry::DefaultGateHalfWidth;
+    REQUIRE(box.contains(geometry.getFinishGate().center - LocalPoint{.x = halfWidth, .y = halfWidth}));
+    REQUIRE(box.contains(geometry.getFinishGate().center + LocalPoint{.x = halfWidth, .y = -halfWidth}));
+    for (auto const& gate : geometry.getSectionGates()) {
+        REQUIRE(box.contains(gate.center));
+    }
+    REQUIRE_FALSE(box.contains(LocalPoint{.x = -1000.0f, .y = 0.0f}));
+    REQUIRE(box.contains(LocalPoint{.x = -1000.0f, .y = 0.0f}, 1000.0f));
+}
+
+TEST_CASE("The TrackData shall update the geometry when the gates are changed")
+{
+    auto track = Rapid::TestHelper::Tracks::getOscherslebenTrack();
+    auto const copy = track;
+
+    track.setFinishline(PositionData{52.0f, 11.0f});
+
+    REQUIRE(track.getGeometry().getProjection().getOrigin() == PositionData{52.0f, 11.0f});
+    REQUIRE(copy.getGeometry().getProjection().getOrigin() == copy.getFinishline());
+}
+
+TEST_CASE("The TrackGeometry shall create the gates for the topology of the track")
+{
+    auto track = getSquareTrack();
+    track.setStartline(PositionData{51.995f, 11.0f});
+
+    SECTION("Circuit with a start line at the pit lane exit and a pit lane line")
+    {
+        track.setPitLaneLine(PositionData{51.9995f, 11.0f});
+        auto const& geometry = track.getGeometry();
+
+        REQUIRE(geometry.getTopology() == TrackTopology::Circuit);
+        REQUIRE(geometry.getSectionGates().size() == 3);
+        REQUIRE(geometry.hasStartGate());
+        REQUIRE(geometry.getStartGate().center == geometry.getProjection().project(PositionData{51.995f, 11.0f}));
+        REQUIRE(geometry.getPitLaneGate() != nullptr);
+        REQUIRE(geometry.getBoundingBox().contains(geometry.getPitLaneGate()->center));
+    }
+
+    SECTION("Point to point from the start line to the finish line")
+    {
+        track.setPitLaneLine(PositionData{51.9995f, 11.0f});
+        track.setTopology(TrackTopology::PointToPoint);
+        auto const& geometry = track.getGeometry();
+
+        REQUIRE(geometry.getTopology() == TrackTopology::PointToPoint);
+        REQUIRE(geometry.getSectionGates().size() == 3);
+        REQUIRE(geometry.hasStartGate());
+        REQUIRE(geometry.getFinishGate().center == LocalPoint{});
+        REQUIRE(geometry.getPitLaneGate() == nullptr);
+    }
+}
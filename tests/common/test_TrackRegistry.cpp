@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/TrackRegistry.hpp"
+#include <catch2/catch_all.hpp>
+#include <testhelper/Tracks.hpp>
+
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+TEST_CASE("The TrackRegistry shall share the storage of equal tracks")
+{
+    auto& registry = TrackRegistry::instance();
+    registry.clear();
+
+    auto const track0 = registry.intern(Tracks::getOscherslebenTrack());
+    auto const track1 = registry.intern(Tracks::getOscherslebenTrack());
+
+    REQUIRE(track0 == Tracks::getOscherslebenTrack());
+    REQUIRE(track0 == track1);
+    REQUIRE(&track0.getSections() == &track1.getSections());
+    REQUIRE(registry.size() == 1);
+}
+
+TEST_CASE("The TrackRegistry shall keep different tracks apart")
+{
+    auto& registry = TrackRegistry::instance();
+    registry.clear();
+
+    auto const oschersleben = registry.intern(Tracks::getOscherslebenTrack());
+    auto const track = registry.intern(Tracks::getTrack());
+
+    REQUIRE(oschersleben == Tracks::getOscherslebenTrack());
+    REQUIRE(track == Tracks::getTrack());
+    REQUIRE(registry.size() == 2);
+}
+
+TEST_CASE("A modified handle of the TrackRegistry shall not change the interned track")
+{
+    auto& registry = TrackRegistry::instance();
+    registry.clear();
+
+    auto modified = registry.intern(Tracks::getOscherslebenTrack());
+    modified.setTrackName("Modified");
+
+    auto const interned = registry.intern(Tracks::getOscherslebenTrack());
+    REQUIRE(interned.getTrackName() == Tracks::getOscherslebenTrack().getTrackName());
+    REQUIRE(&interned.getSections() != &modified.getSections());
+    REQUIRE(registry.size() == 1);
+}
+
+TEST_CASE("Handles of the TrackRegistry shall stay valid after clearing the registry")
+{
+    auto& registry = TrackRegistry::instance();
+    registry.clear();
+
+    auto const track = registry.intern(Tracks::getOscherslebenTrack());
+    registry.clear();
+
+    REQUIRE(registry.size() == 0);
+    REQUIRE(track == Tracks::getOscherslebenTrack());
+}
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/TrackGeometry.hpp"
+#include "positioning/FilteredGpsPositionProvider.hpp"
+#include "testhelper/PositionDateTimeProvider.hpp"
+#include "testhelper/SyntheticLaps.hpp"
+#include <catch2/catch_all.hpp>
+
+using namespace Rapid::Positioning;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+auto const& projection = SyntheticLaps::getProjection();
+
+GpsPositionData createFix(std::int64_t index, float offsetEast = 0.0f)
+{
+    auto const point = LocalPoint{.x = offsetEast, .y = static_cast<float>(index) * 3.0f};
+    return GpsPositionData{projection.unproject(point), Timestamp::fromMilliseconds(index * 100), Date{}};
+}
+
+/**
+ * Filter that rejects every second fix and counts the passed fixes.
+ */
+class AlternatingFilter final : public IGpsPositionFilter
+{
+public:
+    std::optional<GpsPositionData> filter(GpsPositionData const& position) override
+    {
+        ++calls;
+        if (calls % 2 == 0) {
+            return std::nullopt;
+        }
+        return position;
+    }
+
+    void reset() override
+    {
+        calls = 0;
+    }
+
+    std::size_t calls{0};
+};
+
+class TestFixture
+{
+public:
+    PositionDateTimeProvider source;
+    std::vector<GpsPositionData> published;
+
+    void connect(FilteredGpsPositionProvider& provider)
+    {
+        std::ignore = provider.gpsPosition.valueChanged().connect([this](GpsPositionData const& position) {
+            published.push_back(position);
+        });
+    }
+};
+
+} // namespace
+
+TEST_CASE_METHOD(TestFixture, "The FilteredGpsPositionProvider shall publish only the fixes passing all filters")
+{
+    auto filters = std::vector<std::unique_ptr<IGpsPositionFilter>>{};
+    filters.push_back(std::make_unique<AlternatingFilter>());
+    filters.push_back(std::make_unique<AlternatingFilter>());
+    auto* second = static_cast<AlternatingFilter*>(filters.back().get());
+    auto provider = FilteredGpsPositionProvider{source, std::move(filters)};
+    connect(provider);
+
+    for (std::int64_t index = 0; index < 4; ++index) {
+        source.gpsPosition.set(createFix(index));
+    }
+
+    // The second filter only receives the fixes passed by the first filter.
+    REQUIRE(second->calls == 2);
+    REQUIRE(published.size() == 1);
+    REQUIRE(published[0] == createFix(0));
+
+    provider.reset();
+    REQUIRE(second->calls == 0);
+}
+
+TEST_CASE_METHOD(TestFixture, "The FilteredGpsPositionProvider shall drop outliers with the default filters")
+{
+    auto provider = FilteredGpsPositionProvider{source};
+    connect(provider);
+
+    for (std::int64_t index = 0; index < 20; ++index) {
+        source.gpsPosition.set(createFix(index, index == 10 ? 30.0f : 0.0f));
+    }
+
+    REQUIRE(published.size() == 19);
+    for (auto const& position : published) {
+        REQUIRE(std::abs(projection.project(position.getPosition()).x) < 1.0f);
+    }
+}
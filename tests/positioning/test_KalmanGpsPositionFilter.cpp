@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/TrackGeometry.hpp"
+#include "positioning/KalmanGpsPositionFilter.hpp"
+#include "testhelper/SyntheticLaps.hpp"
+#include <catch2/catch_all.hpp>
+#include <random>
+
+using namespace Rapid::Positioning;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+auto const& projection = SyntheticLaps::getProjection();
+
+/**
+ * Creates the fix of a vehicle driving north east with 20 m/s per axis and 10 Hz fixes.
+ */
+GpsPositionData createFix(std::int64_t index, LocalPoint const& error = LocalPoint{})
+{
+    auto const distance = static_cast<float>(index) * 2.0f;
+    auto const point = LocalPoint{.x = distance, .y = distance} + error;
+    return GpsPositionData{projection.unproject(point), Timestamp::fromMilliseconds(index * 100), Date{}};
+}
+
+LocalPoint getError(GpsPositionData const& fix, std::int64_t index)
+{
+    return projection.project(fix.getPosition()) - projection.project(createFix(index).getPosition());
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-unchecked-optional-access)
+
+TEST_CASE("The KalmanGpsPositionFilter shall follow a constant velocity without delay")
+{
+    auto filter = KalmanGpsPositionFilter{};
+    for (std::int64_t index = 0; index < 50; ++index) {
+        auto const filtered = filter.filter(createFix(index));
+        REQUIRE(filtered.has_value());
+        REQUIRE(filtered->getTime() == createFix(index).getTime());
+        // The filter needs a few fixes to estimate the velocity.
+        if (index >= 10) {
+            REQUIRE(length(getError(*filtered, index)) < 0.05f);
+        }
+    }
+}
+
+TEST_CASE("The KalmanGpsPositionFilter shall reduce the noise of the fixes")
+{
+    auto generator = std::mt19937{42};
+    auto noise = std::normal_distribution<float>{0.0f, 1.5f};
+    auto filter = KalmanGpsPositionFilter{};
+    auto rawError = 0.0f;
+    auto filteredError = 0.0f;
+
+    for (std::int64_t index = 0; index < 300; ++index) {
+        auto const fix = createFix(index, LocalPoint{.x = noise(generator), .y = noise(generator)});
+        auto const filtered = filter.filter(fix);
+        REQUIRE(filtered.has_value());
+        // The filter needs a few fixes to estimate the velocity.
+        if (index >= 20) {
+            rawError += squaredLength(getError(fix, index));
+            filteredError += squaredLength(getError(*filtered, index));
+        }
+    }
+
+    REQUIRE(filteredError < rawError * 0.5f);
+}
+
+TEST_CASE("The KalmanGpsPositionFilter shall start again after a gap")
+{
+    auto filter = KalmanGpsPositionFilter{};
+    for (std::int64_t index = 0; index < 10; ++index) {
+        std::ignore = filter.filter(createFix(index));
+    }
+
+    // After the gap the vehicle stands still, a started filter gives the fix itself.
+    auto const fix = GpsPositionData{createFix(0).getPosition(), Timestamp::fromMilliseconds(10000), Date{}};
+    REQUIRE(filter.filter(fix) == fix);
+}
+
+// NOLINTEND(bugprone-unchecked-optional-access)
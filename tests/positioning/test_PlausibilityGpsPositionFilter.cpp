@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: 2025 All contributors
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "algorithm/SimpleLaptimer.hpp"
+#include "common/TrackGeometry.hpp"
+#include "positioning/PlausibilityGpsPositionFilter.hpp"
+#include "testhelper/Positions.hpp"
+#include "testhelper/Sessions.hpp"
+#include "testhelper/SyntheticLaps.hpp"
+#include <catch2/catch_all.hpp>
+#include <vector>
+
+using namespace Rapid::Algorithm;
+using namespace Rapid::Positioning;
+using namespace Rapid::Common;
+using namespace Rapid::TestHelper;
+
+namespace
+{
+
+auto const& projection = SyntheticLaps::getProjection();
+
+/**
+ * Creates the fix of a vehicle driving north with 30 m/s and 10 Hz fixes.
+ */
+GpsPositionData createFix(std::int64_t index, float offsetEast = 0.0f)
+{
+    auto const point = LocalPoint{.x = offsetEast, .y = static_cast<float>(index) * 3.0f};
+    return GpsPositionData{projection.unproject(point), Timestamp::fromMilliseconds(index * 100), Date{}};
+}
+
+} // namespace
+
+TEST_CASE("The PlausibilityGpsPositionFilter shall accept the fixes of a plausible drive")
+{
+    auto filter = PlausibilityGpsPositionFilter{};
+    for (std::int64_t index = 0; index < 20; ++index) {
+        auto const fix = createFix(index);
+        REQUIRE(filter.filter(fix) == fix);
+    }
+}
+
+TEST_CASE("The PlausibilityGpsPositionFilter shall reject implausible fixes")
+{
+    auto filter = PlausibilityGpsPositionFilter{};
+    for (std::int64_t index = 0; index < 5; ++index) {
+        REQUIRE(filter.filter(createFix(index)).has_value());
+    }
+
+    SECTION("Reject a fix beside the predicted position")
+    {
+        REQUIRE_FALSE(filter.filter(createFix(5, 20.0f)).has_value());
+        REQUIRE(filter.filter(createFix(6)).has_value());
+    }
+
+    SECTION("Reject a fix that requires a too high velocity")
+    {
+        auto const jump = GpsPositionData{createFix(50).getPosition(), createFix(5).getTime(), Date{}};
+        REQUIRE_FALSE(filter.filter(jump).has_value());
+        REQUIRE(filter.filter(createFix(5)).has_value());
+    }
+
+    SECTION("Reject a fix that isn't after the last fix")
+    {
+        REQUIRE_FALSE(filter.filter(createFix(4)).has_value());
+        REQUIRE_FALSE(filter.filter(createFix(3)).has_value());
+        REQUIRE(filter.filter(createFix(5)).has_value());
+    }
+}
+
+TEST_CASE("The PlausibilityGpsPositionFilter shall continue at a rejected fix that is confirmed by the next fix")
+{
+    auto filter = PlausibilityGpsPositionFilter{};
+    for (std::int64_t index = 0; index < 5; ++index) {
+        REQUIRE(filter.filter(createFix(index)).has_value());
+    }
+
+    // The vehicle is 100 meter away after a signal loss.
+    REQUIRE_FALSE(filter.filter(createFix(5, 100.0f)).has_value());
+    REQUIRE(filter.filter(createFix(6, 100.0f)).has_value());
+    REQUIRE(filter.filter(createFix(7, 100.0f)).has_value());
+}
+
+TEST_CASE("The PlausibilityGpsPositionFilter shall start again after too many rejected fixes")
+{
+    auto filter = PlausibilityGpsPositionFilter{PlausibilityGpsPositionFilter::Limits{.maxRejections = 3}};
+    for (std::int64_t index = 0; index < 5; ++index) {
+        REQUIRE(filter.filter(createFix(index)).has_value());
+    }
+
+    // The outliers jump from one side to the other, so they don't confirm each other.
+    REQUIRE_FALSE(filter.filter(createFix(5, 100.0f)).has_value());
+    REQUIRE_FALSE(filter.filter(createFix(6, -100.0f)).has_value());
+    REQUIRE(filter.filter(createFix(7, 100.0f)).has_value());
+    REQUIRE(filter.filter(createFix(8, 100.0f)).has_value());
+}
+
+TEST_CASE("The PlausibilityGpsPositionFilter shall keep the laps of the recorded Oschersleben session")
+{
+    auto const session = Sessions::getRealWorldSession();
+    auto track = TrackData{};
+    track.setFinishline(Positions::getOscherslebenPositionStartFinishLine());
+    track.setSections(
+        {Positions::getOscherslebenPositionSector1Line(), Positions::getOscherslebenPositionSector2Line()});
+
+    auto const getLapTimes = [&](bool filtered) {
+        auto filter = PlausibilityGpsPositionFilter{};
+        auto lapTimer = SimpleLaptimer{};
+        auto lapTimes = std::vector<Timestamp>{};
+        lapTimer.setTrack(track);
+        std::ignore = lapTimer.lapFinished.connect([&lapTimes, &lapTimer]() {
+            lapTimes.push_back(lapTimer.getLastLaptime());
+        });
+        for (auto const& lap : session.getLaps()) {
+            for (auto const& position : lap.getTelemetry().toPositions()) {
+                auto const fix = filtered ? filter.filter(position) : std::optional<GpsPositionData>{position};
+                if (fix.has_value()) {
+                    lapTimer.updatePositionAndTime(*fix);
+                }
+            }
+        }
+        return lapTimes;
+    };
+
+    // The recording turns sharper than a vehicle can, the filter drops a fix in these corners, but no lap.
+    auto const recordedLapTimes = getLapTimes(false);
+    auto const filteredLapTimes = getLapTimes(true);
+    REQUIRE(recordedLapTimes.size() == session.getNumberOfLaps() - 2);
+    REQUIRE(filteredLapTimes == recordedLapTimes);
+}
+
+TEST_CASE("The PlausibilityGpsPositionFilter shall start again after a reset")
+{
+    auto filter = PlausibilityGpsPositionFilter{};
+    REQUIRE(filter.filter(createFix(0)).has_value());
+    REQUIRE(filter.filter(createFix(1)).has_value());
+
+    filter.reset();
+
+    REQUIRE(filter.filter(createFix(2, 100.0f)).has_value());
+}
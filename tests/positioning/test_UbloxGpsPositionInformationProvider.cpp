@@ -312,6 +312,32 @@ TEST_CASE_METHOD(TestFixture,
         ubloxDevice->dataReady.emit();
     }
 
+    SECTION("Configure CFG-RATE with the measurement rate of 100 Hz")
+    {
+        auto callCount = 0;
+        auto defaultRateCfg = createCfgRateResp(40, 1, 0);
+        auto successResponse = createAckResp(CFG_RATE_CLASS_ID, CFG_RATE_MSG_ID);
+        successResponse.insert(successResponse.end(), defaultRateCfg.begin(), defaultRateCfg.end());
+        // 1. must check for initialied device.
+        REQUIRE_CALL(*ubloxDevice, isReady()).RETURN(true);
+        // 2. Send poll request for cfg rate
+        REQUIRE_CALL(*ubloxDevice, write(_))
+            .LR_SIDE_EFFECT(++callCount)
+            .LR_SIDE_EFFECT(ubloxDevice->dataReady.emit())
+            .LR_WITH(_1 == CFG_RATE_POLL);
+        // 3. Give the success response with the default cfg rate
+        REQUIRE_CALL(*ubloxDevice, read()).LR_WITH(callCount == 1).RETURN(successResponse);
+        // 4. Write the cfg rate configuration with 10 ms to the device
+        REQUIRE_CALL(*ubloxDevice, write(_)).LR_SIDE_EFFECT(++callCount).LR_WITH(_1 == createCfgRateResp(10, 1, 0));
+        // 5. Send ack response
+        REQUIRE_CALL(*ubloxDevice, read())
+            .LR_WITH(callCount == 2)
+            .LR_RETURN(createAckResp(CFG_RATE_CLASS_ID, CFG_RATE_MSG_ID));
+        auto ubloxGps = UbloxGpsPositionInformationProvider{std::move(ubloxDevicePtr), std::chrono::milliseconds{10}};
+        (void)ubloxGps;
+        ubloxDevice->dataReady.emit();
+    }
+
     SECTION("Don't configure CFG-RATE when correctly configured")
     {
         auto callCount = 0;
@@ -395,6 +421,30 @@ TEST_CASE_METHOD(TestFixture, "Upate the GPS position when NAV-PVT response rece
         REQUIRE(posChangedSyp.getCount() == 1);
     }
 
+    SECTION("Update GPS postion on a NAV-PVT message that is split over two reads")
+    {
+        auto const navPvt = createNavPvtResp();
+        auto const half = static_cast<std::ptrdiff_t>(navPvt.size() / 2);
+        auto readCount = 0;
+        //1. Simulate the NAV-PVT payload in two parts
+        REQUIRE_CALL(*ubloxDevice, read())
+            .TIMES(2)
+            .LR_SIDE_EFFECT(++readCount)
+            .LR_RETURN(readCount == 1 ? std::vector<std::uint8_t>(navPvt.begin(), navPvt.begin() + half)
+                                      : std::vector<std::uint8_t>(navPvt.begin() + half, navPvt.end()));
+
+        auto ubloxGps = UbloxGpsPositionInformationProvider{std::move(ubloxDevicePtr)};
+        auto posChangedSyp = SignalSpy{ubloxGps.gpsPosition.valueChanged()};
+        ubloxDevice->dataReady.emit();
+        REQUIRE(posChangedSyp.getCount() == 0);
+        ubloxDevice->dataReady.emit();
+
+        auto expectedGpsPos = createGpsPositionData();
+        CHECK(ubloxGps.gpsPosition.get().getPosition() == expectedGpsPos.getPosition());
+        CHECK(ubloxGps.gpsPosition.get().getTime() == expectedGpsPos.getTime());
+        REQUIRE(posChangedSyp.getCount() == 1);
+    }
+
     SECTION("Update satellite on new NAV-PVT message")
     {
         //1. Simulate NAV-PVT payload
@@ -287,4 +287,63 @@ TEST_CASE_METHOD(TestFixture, "the SessionDatabaseIpcServer shall provide sessio
     }
 }
 
+TEST_CASE_METHOD(TestFixture, "the SessionDatabaseIpcServer shall append laps to an opened session")
+{
+    auto const session = Sessions::getTestSession();
+    constexpr auto sessionHandle = std::size_t{42};
+
+    SECTION("give the handle of the opened session")
+    {
+        auto const openResult = std::make_shared<Rapid::Storage::OpenSessionResult>();
+        openResult->setResultValue(sessionHandle);
+        openResult->setResult(Result::Ok);
+        REQUIRE_CALL(db, openSession(trompeloeil::_))
+            .WITH(SessionMetaData{_1} == SessionMetaData{session})
+            .RETURN(openResult);
+        auto request = client.OpenSession(storeSessionMetaData(session));
+        REQUIRE(QTest::qWaitFor([&request] {
+            return request.isFinished();
+        }));
+        CHECK_FALSE(request.isError());
+        REQUIRE(request.value() == sessionHandle);
+    }
+
+    SECTION("send an error message to the caller when the session can't be opened")
+    {
+        auto const openResult = std::make_shared<Rapid::Storage::OpenSessionResult>();
+        openResult->setResult(Result::Error);
+        REQUIRE_CALL(db, openSession(trompeloeil::_)).RETURN(openResult);
+        auto request = client.OpenSession(storeSessionMetaData(session));
+        REQUIRE(QTest::qWaitFor([&request] {
+            return request.isFinished();
+        }));
+        REQUIRE(request.isError());
+    }
+
+    SECTION("append the lap of the passed file")
+    {
+        auto const appendResult = std::make_shared<AsyncResult>();
+        appendResult->setResult(Result::Ok);
+        auto const expectedLap = session.getLaps().front();
+        REQUIRE_CALL(db, appendLap(sessionHandle, trompeloeil::_)).WITH(_2 == expectedLap).RETURN(appendResult);
+        auto request = client.AppendLap(sessionHandle, storeSession(SessionData{session, {expectedLap}}));
+        REQUIRE(QTest::qWaitFor([&request] {
+            return request.isFinished();
+        }));
+        CHECK_FALSE(request.isError());
+        REQUIRE(request.value());
+    }
+
+    SECTION("send an error message to the caller when the lap file isn't found")
+    {
+        FORBID_CALL(db, appendLap(trompeloeil::_, trompeloeil::_));
+        auto request = client.AppendLap(sessionHandle, "/tmp/asdfasdfaaa");
+        REQUIRE(QTest::qWaitFor([&request] {
+            return request.isFinished();
+        }));
+        REQUIRE(request.isError());
+        REQUIRE(request.error().type() == QDBusError::InvalidArgs);
+    }
+}
+
 QT_CATCH2_TEST_MAIN()
@@ -27,6 +27,8 @@ public:
     MAKE_MOCK(GetSessionByMetaData, auto(QString)->QString);
     MAKE_MOCK(GetSessionMetaDataByIndex, auto(uint)->QString);
     MAKE_MOCK(StoreSession, auto(QString)->bool);
+    MAKE_MOCK(OpenSession, auto(QString)->qulonglong);
+    MAKE_MOCK(AppendLap, auto(qulonglong, QString)->bool);
 
 private:
     QDBusConnection mConnection;
@@ -272,4 +272,73 @@ TEST_CASE_METHOD(TestFixture, "The SessionDatabaseIpcClient shall give the reque
     }
 }
 
+TEST_CASE_METHOD(TestFixture, "The SessionDatabaseIpcClient shall give a view of the requested session")
+{
+    constexpr auto index = std::size_t{1};
+    auto const session = Sessions::getTestSession();
+    ALLOW_CALL(server, GetSessionCount()).RETURN(2);
+    auto ipcClient = SessionDatabaseIpcClient{};
+    waitForInit(ipcClient);
+
+    SECTION("The view has the laps and the telemetry of the session")
+    {
+        REQUIRE_CALL(server, GetSessionByIndex(trompeloeil::_))
+            .WITH(_1 == index)
+            .LR_RETURN(createSessionRequest(session));
+        auto const view = ipcClient.getSessionViewByIndex(index);
+        REQUIRE(view.has_value());
+        // NOLINTBEGIN(bugprone-unchecked-optional-access)
+        REQUIRE(view->getLaps() == session.getLaps());
+        REQUIRE(*view->getTelemetry(0) == session.getLaps().front().getTelemetry());
+        // NOLINTEND(bugprone-unchecked-optional-access)
+    }
+
+    SECTION("No view when the server has no session for the index")
+    {
+        REQUIRE_CALL(server, GetSessionByIndex(trompeloeil::_)).RETURN(QString{"/does/not/exist.session"});
+        REQUIRE_FALSE(ipcClient.getSessionViewByIndex(index).has_value());
+    }
+}
+
+TEST_CASE_METHOD(TestFixture, "The SessionDatabaseIpcClient shall append laps to an opened session")
+{
+    constexpr auto sessionHandle = qulonglong{42};
+    auto const session = Sessions::getTestSession();
+    ALLOW_CALL(server, GetSessionCount()).RETURN(0);
+    auto ipcClient = SessionDatabaseIpcClient{};
+    waitForInit(ipcClient);
+
+    SECTION("The lap is exchanged with the meta data of the opened session")
+    {
+        REQUIRE_CALL(server, OpenSession(trompeloeil::_)).RETURN(sessionHandle);
+        auto const openResult = ipcClient.openSession(session);
+        REQUIRE(QTest::qWaitFor([&openResult] {
+            return openResult->getResult() == Result::Ok;
+        }));
+        REQUIRE(openResult->getResultValue() == sessionHandle);
+
+        auto lapPath = QString{};
+        REQUIRE_CALL(server, AppendLap(sessionHandle, trompeloeil::_)).LR_SIDE_EFFECT(lapPath = _2).RETURN(true);
+        auto const appendResult = ipcClient.appendLap(sessionHandle, LapData{session.getLaps().front()});
+        REQUIRE(QTest::qWaitFor([&appendResult] {
+            return appendResult->getResult() == Result::Ok;
+        }));
+        auto lapFile = QFile{lapPath};
+        REQUIRE(lapFile.open(QFile::ReadOnly));
+        auto const lapSession = JsonDeserializer::Session::deserialize(lapFile.readAll().toStdString());
+        REQUIRE(lapSession.has_value());
+        // NOLINTBEGIN(bugprone-unchecked-optional-access)
+        REQUIRE(SessionMetaData{lapSession.value()} == SessionMetaData{session});
+        REQUIRE(lapSession->getLaps() == std::vector<LapData>{session.getLaps().front()});
+        // NOLINTEND(bugprone-unchecked-optional-access)
+    }
+
+    SECTION("A lap of a session that isn't opened isn't sent to the server")
+    {
+        FORBID_CALL(server, AppendLap(trompeloeil::_, trompeloeil::_));
+        auto const appendResult = ipcClient.appendLap(sessionHandle, LapData{session.getLaps().front()});
+        REQUIRE(appendResult->getResult() == Result::Error);
+    }
+}
+
 QT_CATCH2_TEST_MAIN()
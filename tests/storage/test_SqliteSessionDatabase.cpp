@@ -61,6 +61,23 @@ struct TestFixture
     }
 };
 
+/**
+ * Creates a lap with 25 Hz log points, a lap of 80 seconds has 2000 log points.
+ */
+LapData createLap(std::size_t logPointCount)
+{
+    auto telemetry = LapTelemetry{};
+    for (std::size_t index = 0; index < logPointCount; ++index) {
+        auto const offset = static_cast<float>(index) * 0.00001f;
+        telemetry.append(GpsPositionData{PositionData{52.0258333f + offset, 11.279166666f + offset},
+                                         Timestamp::fromMilliseconds(static_cast<std::int64_t>(index) * 40),
+                                         Date{"24.11.2024"},
+                                         VelocityData{20.0 + static_cast<double>(index % 100)}});
+    }
+    return LapData{{Timestamp{"00:00:30.000"}, Timestamp{"00:00:30.000"}, Timestamp{"00:00:20.000"}},
+                   std::move(telemetry)};
+}
+
 } // namespace
 
 CATCH_REGISTER_LISTENER(SqliteSessionDatabaseEventListener)
@@ -239,6 +256,25 @@ TEST_CASE_METHOD(TestFixture, "The SqlieSessionDatabase shall emit session detel
     REQUIRE(deletedIndex == indexToDelete);
 }
 
+TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase shall give a session view that loads the telemetry on demand")
+{
+    auto db = SqliteSessionDatabase{getTestDatabaseFile()};
+    setupTestDatabase(db);
+
+    auto const view = db.getSessionViewByIndex(0);
+    REQUIRE(view.has_value());
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    REQUIRE(view->getNumberOfLaps() == session1.getNumberOfLaps());
+    REQUIRE(view->getLap(0)->getLaptime() == session1.getLaps()[0].getLaptime());
+    REQUIRE_FALSE(view->isTelemetryLoaded(0));
+
+    REQUIRE(view->toSessionData() == session1);
+    REQUIRE(view->isTelemetryLoaded(0));
+    // NOLINTEND(bugprone-unchecked-optional-access)
+
+    REQUIRE_FALSE(db.getSessionViewByIndex(2).has_value());
+}
+
 TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase shall give the session meta data for a index.")
 {
     auto db = SqliteSessionDatabase{getTestDatabaseFile()};
@@ -257,6 +293,22 @@ TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase shall give the session
     CHECK(loadResult->getResultValue().value_or(SessionMetaData{}).getTrack() == session2.getTrack());
 }
 
+TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase shall share the track of session meta data on the same track")
+{
+    auto db = SqliteSessionDatabase{getTestDatabaseFile()};
+    setupTestDatabase(db);
+
+    auto loadResult0 = db.getSessionMetaDataByIndexAsync(0);
+    REQUIRE_COMPARE_WITH_TIMEOUT(loadResult0->getResult(), Rapid::System::Result::Ok, std::chrono::seconds{1});
+    auto loadResult1 = db.getSessionMetaDataByIndexAsync(1);
+    REQUIRE_COMPARE_WITH_TIMEOUT(loadResult1->getResult(), Rapid::System::Result::Ok, std::chrono::seconds{1});
+
+    auto const track0 = loadResult0->getResultValue().value_or(SessionMetaData{}).getTrack();
+    auto const track1 = loadResult1->getResultValue().value_or(SessionMetaData{}).getTrack();
+    REQUIRE(track0 == session1.getTrack());
+    REQUIRE(&track0.getSections() == &track1.getSections());
+}
+
 TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase shall give the session data for session meta data")
 {
     auto db = SqliteSessionDatabase{getTestDatabaseFile()};
@@ -270,3 +322,118 @@ TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase shall give the session
     REQUIRE_COMPARE_WITH_TIMEOUT(loadResult->getResult(), Rapid::System::Result::Ok, std::chrono::seconds{1});
     CHECK(loadResult->getResultValue().value_or(SessionData{}) == session2);
 }
+
+TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase shall store and read laps with many log points")
+{
+    auto db = SqliteSessionDatabase{getTestDatabaseFile()};
+    auto session = SessionData{session1.getTrack(), Date{"24.11.2024"}, Timestamp{"18:02:19.073"}};
+    session.addLaps({createLap(2000), createLap(1), createLap(0)});
+
+    auto storeResult = db.storeSession(session);
+    storeResult->waitForFinished();
+    REQUIRE(storeResult->getResult() == Result::Ok);
+
+    auto const readResult = db.getSessionByIndex(0);
+    REQUIRE(readResult.has_value());
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    REQUIRE(readResult->getNumberOfLaps() == 3);
+    REQUIRE(readResult->getLaps()[0].getTelemetry().size() == 2000);
+    REQUIRE(readResult.value() == session);
+    // NOLINTEND(bugprone-unchecked-optional-access)
+
+    // Appending a lap to the stored session reuses the cached statements.
+    session.addLap(createLap(150));
+    storeResult = db.storeSession(session);
+    storeResult->waitForFinished();
+    REQUIRE(storeResult->getResult() == Result::Ok);
+    REQUIRE(db.getSessionByIndex(0) == session);
+}
+
+TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase shall append laps to an opened session")
+{
+    auto db = SqliteSessionDatabase{getTestDatabaseFile()};
+    auto addedIndex = std::optional<std::size_t>{};
+    auto updateCount = std::size_t{0};
+    std::ignore = db.sessionAdded.connect([&addedIndex](std::size_t index) {
+        addedIndex = index;
+    });
+    std::ignore = db.sessionUpdated.connect([&updateCount](std::size_t) {
+        ++updateCount;
+    });
+    auto session = SessionData{session1.getTrack(), Date{"24.11.2024"}, Timestamp{"18:02:19.073"}};
+    session.addLaps({createLap(200), createLap(1), createLap(0)});
+
+    auto const openResult = db.openSession(session);
+    openResult->waitForFinished();
+    REQUIRE(openResult->getResult() == Result::Ok);
+    REQUIRE(openResult->getResultValue().has_value());
+    REQUIRE(addedIndex == 0);
+    REQUIRE(db.getSessionCount() == 1);
+    REQUIRE(db.getSessionByIndex(0).value_or(SessionData{}).getNumberOfLaps() == 0);
+
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    auto const sessionHandle = openResult->getResultValue().value();
+    auto appendResults = std::vector<std::shared_ptr<Rapid::System::AsyncResult>>{};
+    for (auto const& lap : session.getLaps()) {
+        appendResults.push_back(db.appendLap(sessionHandle, LapData{lap}));
+    }
+    for (auto const& appendResult : appendResults) {
+        appendResult->waitForFinished();
+        REQUIRE(appendResult->getResult() == Result::Ok);
+    }
+    REQUIRE(updateCount == 3);
+    REQUIRE(db.getSessionByIndex(0) == session);
+
+    // Opening the session again continues the stored session.
+    auto const reopenResult = db.openSession(session);
+    reopenResult->waitForFinished();
+    REQUIRE(reopenResult->getResultValue() == sessionHandle);
+    REQUIRE(db.getSessionCount() == 1);
+    // NOLINTEND(bugprone-unchecked-optional-access)
+
+    // Another database instance counts the stored laps for the first append.
+    auto db2 = SqliteSessionDatabase{getTestDatabaseFile()};
+    session.addLap(createLap(150));
+    auto const appendResult = db2.appendLap(sessionHandle, LapData{session.getLaps().back()});
+    appendResult->waitForFinished();
+    REQUIRE(appendResult->getResult() == Result::Ok);
+    REQUIRE(db.getSessionByIndex(0) == session);
+}
+
+TEST_CASE_METHOD(TestFixture, "The SqliteSessionDatabase store", "[.benchmark]")
+{
+    auto db = SqliteSessionDatabase{getTestDatabaseFile()};
+    auto const lap = createLap(2000);
+    auto sessionCount = std::int64_t{0};
+
+    BENCHMARK_ADVANCED("Store a session with a lap of 2000 log points")(Catch::Benchmark::Chronometer meter)
+    {
+        auto sessions = std::vector<SessionData>{};
+        sessions.reserve(static_cast<std::size_t>(meter.runs()));
+        for (int run = 0; run < meter.runs(); ++run) {
+            // Every session is stored as a new session.
+            sessions.emplace_back(session1.getTrack(), Date{"24.11.2024"}, Timestamp::fromMilliseconds(++sessionCount));
+            sessions.back().addLap(lap);
+        }
+        meter.measure([&](int run) {
+            auto storeResult = db.storeSession(sessions[static_cast<std::size_t>(run)]);
+            storeResult->waitForFinished();
+            return storeResult->getResult();
+        });
+    };
+
+    auto const openResult = db.openSession(SessionData{session1.getTrack(), Date{"25.11.2024"}, Timestamp{}});
+    openResult->waitForFinished();
+    auto const sessionHandle = openResult->getResultValue().value_or(0);
+
+    // The append doesn't read the stored laps, so the cost of a lap doesn't grow with the length of the session.
+    BENCHMARK_ADVANCED("Append a lap of 2000 log points to an opened session")(Catch::Benchmark::Chronometer meter)
+    {
+        auto laps = std::vector<LapData>(static_cast<std::size_t>(meter.runs()), lap);
+        meter.measure([&](int run) {
+            auto appendResult = db.appendLap(sessionHandle, std::move(laps[static_cast<std::size_t>(run)]));
+            appendResult->waitForFinished();
+            return appendResult->getResult();
+        });
+    };
+}
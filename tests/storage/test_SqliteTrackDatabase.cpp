@@ -6,6 +6,7 @@
 #include <catch2/catch_all.hpp>
 #include <chrono>
 #include <storage/private/Connection.hpp>
+#include <string>
 #include <testhelper/CompareHelper.hpp>
 #include <testhelper/SqliteDatabaseTestHelper.hpp>
 
@@ -164,6 +165,23 @@ TEST_CASE("The SqliteTrackDatabase shall save a track")
         REQUIRE(addedIndex == expectedIndex);
     }
 
+    SECTION("The SqliteTrackDatabase stores the topology and the pit lane line of a track")
+    {
+        auto hillclimb = Rapid::Common::TrackData{};
+        hillclimb.setTrackName("Hillclimb");
+        hillclimb.setStartline({52.1, 11.1});
+        hillclimb.setFinishline({52.2, 11.2});
+        hillclimb.setPitLaneLine(Rapid::Common::PositionData{52.15, 11.15});
+        hillclimb.setTopology(Rapid::Common::TrackTopology::PointToPoint);
+
+        auto trackDb = SqliteTrackDatabase{getTestDatabaseFile()};
+        auto const saveResult = trackDb.saveTrack(hillclimb);
+        REQUIRE_COMPARE_WITH_TIMEOUT(saveResult->getResult(), Result::Ok, std::chrono::seconds{1});
+        auto const tracks = trackDb.getTracks();
+        REQUIRE(tracks.size() == 3);
+        REQUIRE(tracks[2] == hillclimb);
+    }
+
     SECTION("The track added signal must be emit from all track database instances")
     {
         auto trackDb = SqliteTrackDatabase{getTestDatabaseFile()};
@@ -234,3 +252,44 @@ TEST_CASE("Get all tracks asynchronous")
     REQUIRE(result->getResultValue().value() == getDefaultTracks());
     // NOLINTEND(bugprone-unchecked-optional-access)
 }
+
+TEST_CASE("The SqliteTrackDatabase shall migrate a database without the topology and the pit lane line")
+{
+    // Rebuild the track table of the test database in the layout before the schema version was stored.
+    constexpr auto legacySchema = "PRAGMA user_version = 0;"
+                                  "PRAGMA foreign_keys = 0;"
+                                  "CREATE TABLE LegacyTrack (TrackId INTEGER NOT NULL UNIQUE, Name TEXT NOT NULL, "
+                                  "Finishline INTEGER NOT NULL, Startline INTEGER NULL, "
+                                  "PRIMARY KEY (TrackId AUTOINCREMENT));"
+                                  "INSERT INTO LegacyTrack SELECT TrackId, Name, Finishline, Startline FROM Track;"
+                                  "DROP TABLE Track;"
+                                  "ALTER TABLE LegacyTrack RENAME TO Track;";
+    auto const dbFile = getTestDatabaseFile();
+    auto* legacyHandle = static_cast<sqlite3*>(nullptr);
+    REQUIRE(sqlite3_open_v2(dbFile.c_str(), &legacyHandle, SQLITE_OPEN_READWRITE, nullptr) == SQLITE_OK);
+    auto const legacyResult = sqlite3_exec(legacyHandle, legacySchema, nullptr, nullptr, nullptr);
+    sqlite3_close(legacyHandle);
+    REQUIRE(legacyResult == SQLITE_OK);
+
+    auto trackDb = SqliteTrackDatabase{dbFile};
+    REQUIRE_THAT(trackDb.getTracks(), Catch::Matchers::UnorderedEquals(getDefaultTracks()));
+
+    auto hillclimb = Rapid::Common::TrackData{};
+    hillclimb.setTrackName("Hillclimb");
+    hillclimb.setStartline({52.1, 11.1});
+    hillclimb.setFinishline({52.2, 11.2});
+    hillclimb.setPitLaneLine(Rapid::Common::PositionData{52.15, 11.15});
+    hillclimb.setTopology(Rapid::Common::TrackTopology::PointToPoint);
+    auto const saveResult = trackDb.saveTrack(hillclimb);
+    REQUIRE_COMPARE_WITH_TIMEOUT(saveResult->getResult(), Result::Ok, std::chrono::seconds{1});
+    REQUIRE(trackDb.getTracks().back() == hillclimb);
+
+    auto userVersion = 0;
+    auto versionHandler = [](void* version, int, char** values, char**) -> int {
+        *static_cast<int*>(version) = std::stoi(values[0]);
+        return SQLITE_OK;
+    };
+    auto* dbCon = Private::Connection::connection(dbFile)->getRawHandle();
+    REQUIRE(sqlite3_exec(dbCon, "PRAGMA user_version", versionHandler, &userVersion, nullptr) == SQLITE_OK);
+    REQUIRE(userVersion == Private::Connection::SchemaVersion);
+}
@@ -99,4 +99,36 @@ TEST_CASE_METHOD(TestFixture,
         CHECK(response.getReturnType() == RequestReturnType::Json);
         REQUIRE(response.getReturnBody() == expReturnBody);
     }
+
+    SECTION("Provide the statistics of the session \"/activeSession/statistics\"")
+    {
+        auto request = RestRequest{RequestType::Get, "/activeSession/statistics"};
+        auto statistics = SessionStatistics{};
+        statistics.addLap(LapData{{Timestamp{"00:00:30.000"}, Timestamp{"00:00:31.000"}}});
+        // clang-format off
+        auto expReturnBody = std::string
+        {
+        "{"
+                "\"lapCount\":1,"
+                "\"bestLap\":\"00:01:01.000\","
+                "\"theoreticalBestLap\":\"00:01:01.000\","
+                "\"averageLap\":\"00:01:01.000\","
+                "\"rollingAverageLap\":\"00:01:01.000\","
+                "\"standardDeviation\":null,"
+                "\"lastLapPersonalBest\":true,"
+                "\"bestSectors\":[\"00:00:30.000\",\"00:00:31.000\"],"
+                "\"lastSectorsPersonalBest\":[true,true]"
+           "}"
+        };
+        // clang-format on
+        REQUIRE_CALL(activeSessionMock, getStatistics()).LR_RETURN(statistics);
+
+        endpoint.handleRestRequest(request);
+
+        REQUIRE(finishedSpy.getCount() == 1);
+        auto [result, response] = finishedSpy.at(0);
+        CHECK(result == RequestHandleResult::Ok);
+        CHECK(response.getReturnType() == RequestReturnType::Json);
+        REQUIRE(response.getReturnBody() == expReturnBody);
+    }
 }
@@ -14,13 +14,33 @@ using namespace Rapid::TestHelper;
 using namespace Rapid::Storage;
 using namespace Rapid::Common;
 
+namespace
+{
+constexpr auto SessionHandle = std::size_t{42};
+
+std::shared_ptr<OpenSessionResult> createOpenSessionResult(Rapid::System::Result result)
+{
+    auto openResult = std::make_shared<OpenSessionResult>();
+    openResult->setResultValue(SessionHandle);
+    openResult->setResult(result);
+    return openResult;
+}
+} // namespace
+
 class TestFixture
 {
 public:
+    TestFixture()
+    {
+        openSessionCall = NAMED_ALLOW_CALL(sdb, openSession(trompeloeil::_)).RETURN(openSessionResult);
+    }
+
     Laptimer lp{};
     PositionDateTimeProvider dp{};
     SessionDatabaseMock sdb{};
     ActiveSessionWorkflow actSessWf{dp, lp, sdb};
+    std::shared_ptr<OpenSessionResult> openSessionResult = createOpenSessionResult(Rapid::System::Result::Ok);
+    std::unique_ptr<trompeloeil::expectation> openSessionCall;
 };
 
 TEST_CASE_METHOD(TestFixture, "The ActiveSessionWorkflow shall be able to start and stop", "[ACTIVESESSION_WORKFLOW]")
@@ -55,7 +75,7 @@ TEST_CASE_METHOD(TestFixture,
         auto res = std::make_shared<Rapid::System::AsyncResult>();
         res->setResult(Rapid::System::Result::Ok);
 
-        REQUIRE_CALL(sdb, storeSession(trompeloeil::_)).WITH(_1.getNumberOfLaps() == 1).RETURN(res);
+        REQUIRE_CALL(sdb, appendLap(SessionHandle, trompeloeil::_)).WITH(_2 == expectedLap).RETURN(res);
 
         actSessWf.startActiveSession();
         lp.sectorTimes.emplace_back("00:23:13.123");
@@ -72,7 +92,9 @@ TEST_CASE_METHOD(TestFixture,
             Timestamp{"00:23:123.233"},
         }};
 
-        REQUIRE_CALL(sdb, storeSession(trompeloeil::_)).RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        REQUIRE_CALL(sdb, appendLap(SessionHandle, trompeloeil::_))
+            .WITH(_2 == expectedLap)
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
 
         actSessWf.startActiveSession();
 
@@ -92,7 +114,8 @@ TEST_CASE_METHOD(TestFixture,
         auto const expectedPos =
             GpsPositionData{PositionData{52.1, 11.3}, Timestamp{"00:00:00.000"}, Date{"01.01.1970"}, VelocityData{100}};
 
-        ALLOW_CALL(sdb, storeSession(trompeloeil::_)).RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        ALLOW_CALL(sdb, appendLap(trompeloeil::_, trompeloeil::_))
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
 
         actSessWf.startActiveSession();
         lp.lapStarted.emit();
@@ -107,6 +130,99 @@ TEST_CASE_METHOD(TestFixture,
         REQUIRE(session->getLap(0)->getPositions().at(0) == expectedPos);
         // NOLINTEND(bugprone-unchecked-optional-access)
     }
+
+    SECTION("Append only the finished lap to the opened session")
+    {
+        auto const firstLap = LapData{Timestamp{"00:01:32.000"}};
+        auto const secondLap = LapData{Timestamp{"00:01:30.000"}};
+
+        REQUIRE_CALL(sdb, openSession(trompeloeil::_))
+            .WITH(_1.getSessionDate() == dp.gpsPosition.get().getDate())
+            .RETURN(openSessionResult);
+        actSessWf.startActiveSession();
+
+        {
+            REQUIRE_CALL(sdb, appendLap(SessionHandle, trompeloeil::_))
+                .WITH(_2 == firstLap)
+                .RETURN(std::make_shared<Rapid::System::AsyncResult>());
+            lp.sectorTimes.emplace_back("00:01:32.000");
+            lp.lapFinished.emit();
+        }
+
+        REQUIRE_CALL(sdb, appendLap(SessionHandle, trompeloeil::_))
+            .WITH(_2 == secondLap)
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        lp.sectorTimes.emplace_back("00:01:30.000");
+        lp.lapFinished.emit();
+
+        REQUIRE(actSessWf.getSession().value_or(SessionData{}).getNumberOfLaps() == 2);
+    }
+
+    SECTION("Append the finished laps when the session is opened after the lap is finished")
+    {
+        auto const expectedLap = LapData{Timestamp{"00:01:32.000"}};
+        openSessionResult = std::make_shared<OpenSessionResult>();
+
+        actSessWf.startActiveSession();
+        lp.sectorTimes.emplace_back("00:01:32.000");
+        lp.lapFinished.emit();
+
+        REQUIRE_CALL(sdb, appendLap(SessionHandle, trompeloeil::_))
+            .WITH(_2 == expectedLap)
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        openSessionResult->setResultValue(SessionHandle);
+        openSessionResult->setResult(Rapid::System::Result::Ok);
+    }
+
+    SECTION("Append the finished laps when the session is stopped before it is opened")
+    {
+        auto const expectedLap = LapData{Timestamp{"00:01:32.000"}};
+        openSessionResult = std::make_shared<OpenSessionResult>();
+
+        actSessWf.startActiveSession();
+        lp.sectorTimes.emplace_back("00:01:32.000");
+        lp.lapFinished.emit();
+
+        {
+            // Storing the session would create a second session next to the opened one.
+            FORBID_CALL(sdb, storeSession(trompeloeil::_));
+            actSessWf.stopActiveSession();
+        }
+
+        REQUIRE_CALL(sdb, appendLap(SessionHandle, trompeloeil::_))
+            .WITH(_2 == expectedLap)
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        openSessionResult->setResultValue(SessionHandle);
+        openSessionResult->setResult(Rapid::System::Result::Ok);
+    }
+
+    SECTION("Store the whole session when the session is stopped and can't be opened")
+    {
+        openSessionResult = std::make_shared<OpenSessionResult>();
+
+        actSessWf.startActiveSession();
+        lp.sectorTimes.emplace_back("00:01:32.000");
+        lp.lapFinished.emit();
+        actSessWf.stopActiveSession();
+
+        REQUIRE_CALL(sdb, storeSession(trompeloeil::_))
+            .WITH(_1.getNumberOfLaps() == 1)
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        openSessionResult->setResult(Rapid::System::Result::Error);
+    }
+
+    SECTION("Store the whole session when the session can't be opened")
+    {
+        openSessionResult = createOpenSessionResult(Rapid::System::Result::Error);
+
+        REQUIRE_CALL(sdb, storeSession(trompeloeil::_))
+            .WITH(_1.getNumberOfLaps() == 1)
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
+
+        actSessWf.startActiveSession();
+        lp.sectorTimes.emplace_back("00:01:32.000");
+        lp.lapFinished.emit();
+    }
 }
 
 TEST_CASE_METHOD(TestFixture, "The ActiveSessionWorkflow shall emit finished signals", "[ACTIVESESSION_WORKFLOW]")
@@ -116,7 +232,8 @@ TEST_CASE_METHOD(TestFixture, "The ActiveSessionWorkflow shall emit finished sig
         auto expLapTimer = std::string{"00:23:13.123"};
         auto lapFinishedSpy = SignalSpy{actSessWf.lapFinished};
 
-        ALLOW_CALL(sdb, storeSession(trompeloeil::_)).RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        ALLOW_CALL(sdb, appendLap(trompeloeil::_, trompeloeil::_))
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
 
         actSessWf.startActiveSession();
         lp.sectorTimes.emplace_back(expLapTimer);
@@ -144,7 +261,8 @@ TEST_CASE_METHOD(TestFixture, "The ActiveSessionWorkflow shall update the proper
     {
         auto expectedLaptime = Timestamp{"00:00:12.123"};
 
-        ALLOW_CALL(sdb, storeSession(trompeloeil::_)).RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        ALLOW_CALL(sdb, appendLap(trompeloeil::_, trompeloeil::_))
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
 
         actSessWf.startActiveSession();
         lp.sectorTimes.emplace_back("00:00:12.123");
@@ -183,7 +301,8 @@ TEST_CASE_METHOD(TestFixture, "The ActiveSessionWorkflow shall update the proper
 
     SECTION("Update the lap counter when a lap is finished.")
     {
-        ALLOW_CALL(sdb, storeSession(trompeloeil::_)).RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        ALLOW_CALL(sdb, appendLap(trompeloeil::_, trompeloeil::_))
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
 
         actSessWf.startActiveSession();
 
@@ -220,3 +339,77 @@ TEST_CASE_METHOD(TestFixture,
         REQUIRE(lp.lastPostionDateTime == GpsPositionData{{}, {}, {}});
     }
 }
+
+TEST_CASE_METHOD(TestFixture,
+                 "The ActiveSessionWorkflow shall publish the delta to the reference lap",
+                 "[ACTIVESESSION_WORKFLOW]")
+{
+    // A straight to the north with a log point every 10 meter.
+    auto const projection = LocalProjection{Positions::getOscherslebenPositionStartFinishLine()};
+    auto const createPosition = [&projection](std::int64_t index, std::int64_t millisecondsPerPoint) {
+        return GpsPositionData{projection.unproject(LocalPoint{.x = 0.0f, .y = static_cast<float>(index) * 10.0f}),
+                               Timestamp::fromMilliseconds(index * millisecondsPerPoint),
+                               {}};
+    };
+    auto referencePositions = std::vector<GpsPositionData>{};
+    for (std::int64_t index = 0; index < 10; ++index) {
+        referencePositions.push_back(createPosition(index, 1000));
+    }
+
+    SECTION("Compare the current lap to a stored reference lap")
+    {
+        auto const referenceLap =
+            LapData{{Timestamp{"00:00:09.000"}}, LapTelemetry::fromPositions(referencePositions)};
+        actSessWf.setReferenceLap(referenceLap);
+        actSessWf.startActiveSession();
+        lp.lapStarted.emit();
+
+        dp.gpsPosition.set(createPosition(0, 1100));
+        dp.gpsPosition.set(createPosition(5, 1100));
+
+        REQUIRE(actSessWf.deltaTime.get() == 500);
+        REQUIRE(actSessWf.predictedLaptime.get() == Timestamp{"00:00:09.500"});
+    }
+
+    SECTION("Compare the current lap to the best lap of the session")
+    {
+        ALLOW_CALL(sdb, appendLap(trompeloeil::_, trompeloeil::_))
+            .RETURN(std::make_shared<Rapid::System::AsyncResult>());
+        actSessWf.startActiveSession();
+        lp.lapStarted.emit();
+        for (auto const& position : referencePositions) {
+            dp.gpsPosition.set(position);
+        }
+        lp.sectorTimes.emplace_back("00:00:09.000");
+        lp.lapFinished.emit();
+        lp.lapStarted.emit();
+
+        dp.gpsPosition.set(createPosition(0, 900));
+        dp.gpsPosition.set(createPosition(5, 900));
+
+        REQUIRE(actSessWf.deltaTime.get() == -500);
+        REQUIRE(actSessWf.predictedLaptime.get() == Timestamp{"00:00:08.500"});
+    }
+}
+
+TEST_CASE_METHOD(TestFixture,
+                 "The ActiveSessionWorkflow shall update the statistics of the session",
+                 "[ACTIVESESSION_WORKFLOW]")
+{
+    ALLOW_CALL(sdb, appendLap(trompeloeil::_, trompeloeil::_))
+        .RETURN(std::make_shared<Rapid::System::AsyncResult>());
+    actSessWf.startActiveSession();
+
+    lp.sectorTimes.emplace_back("00:01:32.000");
+    lp.lapFinished.emit();
+    lp.sectorTimes.emplace_back("00:01:30.000");
+    lp.lapFinished.emit();
+
+    auto const statistics = actSessWf.getStatistics();
+    REQUIRE(statistics.getLapCount() == 2);
+    REQUIRE(statistics.getBestLaptime() == Timestamp{"00:01:30.000"});
+    REQUIRE(statistics.isLastLapPersonalBest());
+
+    actSessWf.startActiveSession();
+    REQUIRE(actSessWf.getStatistics().getLapCount() == 0);
+}
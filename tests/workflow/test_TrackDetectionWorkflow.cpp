@@ -68,3 +68,26 @@ TEST_CASE("TrackDetectionWorkflow shall not emit 'trackDetected' when stopped.")
 
     REQUIRE(trackDetectedEmitted == false);
 }
+
+TEST_CASE("TrackDetectionWorkflow shall emit 'trackDetected' only once while the position stays on the track.")
+{
+    auto trackDetector = TrackDetection{500};
+    auto posInfoProvider = PositionDateTimeProvider{};
+    auto tdw = TrackDetectionWorkflow{trackDetector, posInfoProvider};
+    auto trackDetectedEmitted = std::uint32_t{0};
+
+    std::ignore = tdw.trackDetected.connect([&] {
+        ++trackDetectedEmitted;
+    });
+    tdw.setTracks({Tracks::getOscherslebenTrack()});
+    tdw.startDetection();
+
+    posInfoProvider.gpsPosition.set({{Positions::getOscherslebenPositionCamp()}, {}, {}});
+    posInfoProvider.gpsPosition.set({{Positions::getOscherslebenPositionStartFinishLine()}, {}, {}});
+    REQUIRE(trackDetectedEmitted == 1);
+
+    // Leaving the track and coming back detects the track again.
+    posInfoProvider.gpsPosition.set({{Rapid::Common::PositionData{48.0f, 2.0f}}, {}, {}});
+    posInfoProvider.gpsPosition.set({{Positions::getOscherslebenPositionCamp()}, {}, {}});
+    REQUIRE(trackDetectedEmitted == 2);
+}
@@ -24,3 +24,17 @@ TEST_CASE("The SessionAnalyzeWorkflow shall crate a LapListModel when a session
     REQUIRE(sa.lapListModel.get() != nullptr);
     REQUIRE(sa.lapListModel.get()->rowCount({}) == 2);
 }
+
+TEST_CASE("The SessionAnalyzeWorkflow shall create the lap models of a session view without loading the telemetry")
+{
+    auto const session = Sessions::getTestSession3();
+    auto const view = Rapid::Common::SessionView{
+        session, session.getLaps(), [](std::size_t) -> std::optional<Rapid::Common::LapTelemetry> {
+            return std::nullopt;
+        }};
+    auto sa = SessionAnalyzeWorkflow();
+    sa.setSession(view);
+    REQUIRE(sa.lapModel.get()->rowCount() == 2);
+    REQUIRE(sa.lapListModel.get()->rowCount({}) == 2);
+    REQUIRE_FALSE(view.isTelemetryLoaded(0));
+}